@@ -0,0 +1,1743 @@
+//!
+//! FILE          code\garden_assets.cpp
+//!
+//! AUTHORS
+//!               Ilya Akkuzin <gr3yknigh1@gmail.com>
+//!
+//! NOTICE        (c) Copyright 2025 by Ilya Akkuzin. All rights reserved.
+//!
+
+#include <ctype.h>  // isspace, isdigit
+#include <assert.h> // assert
+#include <stdio.h>  // FILE, fopen, fread, fseek, fclose
+
+#include <noc/noc.h>
+
+#include "garden_runtime.h"
+#include "garden_assets.h"
+
+GLenum
+gl_convert_shader_module_type_to_gl_enum(Shader_Module_Type type) {
+
+    if (type == Shader_Module_Type::Vertex) {
+        return GL_VERTEX_SHADER;
+    }
+
+    if (type == Shader_Module_Type::Fragment) {
+        return GL_FRAGMENT_SHADER;
+    }
+
+    return 0;
+}
+
+GLuint
+compile_shader_from_str8(const char *string, Shader_Module_Type type)
+{
+    GLenum gl_shader_type = gl_convert_shader_module_type_to_gl_enum(type);
+
+    GLuint id = glCreateShader(gl_shader_type);
+    glShaderSource(id, 1, &string, 0);
+    glCompileShader(id);
+
+    GLint status = GL_TRUE;
+    glGetShaderiv(id, GL_COMPILE_STATUS, &status);
+
+    if (status == GL_FALSE) {
+        //
+        // TODO(gr3yknigh1): Make Shader_Compiler struct with which you should report compile errors [2025/03/28]
+        //
+        GLint log_length = 0;
+        glGetShaderiv(id, GL_INFO_LOG_LENGTH, &log_length);
+        assert(log_length);
+
+        mm::Temp_Scope temp(mm::get_scratch_arena());
+
+        SizeU log_buffer_size = log_length + 1;
+        char *log_buffer = static_cast<char *>(mm::allocate(temp.arena, log_buffer_size));
+        assert(log_buffer);
+
+        glGetShaderInfoLog(id, (GLsizei)log_buffer_size, 0, log_buffer);
+
+        assert(false); // TODO(i.akkuzin): Implement DIE macro [2025/02/08]
+        /* DIE_MF("Failed to compile OpenGL shader! %s", logBuffer); */
+    }
+
+    return id;
+}
+
+GLuint
+link_shader_program(GLuint vertex_shader, GLuint fragment_shader)
+{
+    GLuint id = glCreateProgram();
+
+    glAttachShader(id, vertex_shader);
+    glAttachShader(id, fragment_shader);
+    glLinkProgram(id);
+
+    glValidateProgram(id);
+
+    GLint status = GL_TRUE;
+    glGetProgramiv(id, GL_LINK_STATUS, &status);
+
+    if (status == GL_FALSE) {
+        GLint log_length{0};
+        glGetProgramiv(id, GL_INFO_LOG_LENGTH, &log_length);
+
+        mm::Temp_Scope temp(mm::get_scratch_arena());
+
+        SizeU log_buffer_size = log_length + 1;
+        char *log_buffer = static_cast<char *>(mm::allocate(temp.arena, log_buffer_size));
+        assert(log_buffer);
+
+        glGetProgramInfoLog(id, (GLsizei)log_buffer_size, NULL, log_buffer);
+
+        assert(false); // TODO(i.akkuzin): Implement DIE macro [2025/02/08]
+        /* DIE_MF("Failed to link OpenGL program! %s", logBuffer); */
+    }
+
+    return id;
+}
+
+
+bool
+load_bitmap_picture_info_from_file(Bitmap_Picture *picture, FILE *file)
+{
+    // TODO(gr3yknigh1): Make sure that SEEK_SET is in position [2025/03/10]
+    fread(&picture->header, sizeof(picture->header), 1, file);
+    fread(&picture->dib_header, sizeof(picture->dib_header), 1, file);
+
+    // TODO(gr3yknigh1): Handle read errors [2025/03/10]
+    return true;
+}
+
+bool
+load_bitmap_picture_pixel_data_from_file(Bitmap_Picture *picture, FILE *file)
+{
+    fseek(file, picture->header.data_offset, SEEK_SET);
+    fread(picture->u.data, picture->header.file_size, 1, file);
+    fseek(file, 0, SEEK_SET);
+
+    // TODO(gr3yknigh1): Handle read errors [2025/03/10]
+    return true;
+}
+
+bool
+load_bitmap_picture_from_buffer(Bitmap_Picture *picture, Byte *data, SizeU data_size)
+{
+    if (data_size < sizeof(picture->header) + sizeof(picture->dib_header)) {
+        return false;
+    }
+
+    noc_memory_copy(&picture->header, data, sizeof(picture->header));
+    noc_memory_copy(&picture->dib_header, data + sizeof(picture->header), sizeof(picture->dib_header));
+
+    if (picture->header.data_offset >= data_size) {
+        return false;
+    }
+
+    picture->u.data = data + picture->header.data_offset;
+    return true;
+}
+
+void
+gl_make_texture_from_pixels(void *pixels, size32_t width, size32_t height, Color_Layout layout, GLenum internal_format)
+{
+    assert(layout == Color_Layout::BGRA_U8);
+
+    GLenum format = 0, type = 0;
+
+    if (layout == Color_Layout::BGRA_U8) {
+        format = GL_BGRA;
+        type = GL_UNSIGNED_BYTE;
+    }
+
+    // TODO(gr3yknigh1): Need to add support for more formats [2025/02/23]
+
+    assert(format && type); // NOTE(gr3yknigh1): Should not be zero [2025/02/23]
+    glTexImage2D(GL_TEXTURE_2D, 0, internal_format, width, height, 0, format, type, pixels);
+}
+
+static void
+tilemap_report_error(const char *buffer, SizeU buffer_size, SizeU offset, SizeU length, const char *expected)
+{
+    if (offset >= buffer_size) {
+        printf("E: [tilemap] Expected %s, got end of file\n", expected);
+        return;
+    }
+
+    Token_Location location = token_get_location(buffer, offset);
+    Str8_View text = buffer[offset] == '\n' ? Str8_View("end of line") : Str8_View(buffer + offset, length);
+
+    printf("E: [tilemap] %u:%u: Expected %s, got '%.*s'\n", location.line, location.column, expected, static_cast<int>(text.length), text.data);
+}
+
+static void
+tilemap_report_error(const Token_List *list, const Token *token, const char *expected)
+{
+    if (token == nullptr) {
+        tilemap_report_error(list->buffer, list->buffer_size, list->buffer_size, 0, expected);
+        return;
+    }
+
+    tilemap_report_error(list->buffer, list->buffer_size, token->offset, token->length, expected);
+}
+
+static const Token *
+tilemap_expect(const Token_List *list, const Token **cursor, Token_Kind kind, const char *expected)
+{
+    const Token *token = *cursor < list->tokens + list->count ? *cursor : nullptr;
+
+    if (token == nullptr || token->kind != kind) {
+        tilemap_report_error(list, token, expected);
+        return nullptr;
+    }
+
+    ++*cursor;
+    return token;
+}
+
+//!
+//! @brief Size of the buffer up to the end of first line, which has something except whitespace and comments.
+//!
+static SizeU
+tilemap_get_header_size(const char *buffer, SizeU buffer_size)
+{
+    SizeU line_begin = 0;
+
+    while (line_begin < buffer_size) {
+        const char *newline = static_cast<const char *>(noc_memory_find(buffer + line_begin, buffer_size - line_begin, '\n'));
+        SizeU line_end = newline != nullptr ? static_cast<SizeU>(newline - buffer) + 1 : buffer_size;
+
+        SizeU cursor = line_begin;
+        while (cursor < line_end && isspace(static_cast<unsigned char>(buffer[cursor]))) {
+            ++cursor;
+        }
+
+        bool is_comment = cursor + 1 < line_end && buffer[cursor] == '/' && buffer[cursor + 1] == '/';
+        if (cursor < line_end && !is_comment) {
+            return line_end;
+        }
+
+        line_begin = line_end;
+    }
+
+    return buffer_size;
+}
+
+bool
+parse_tilemap(const char *buffer, SizeU buffer_size, Tilemap *tilemap, Str8_View *image_path)
+{
+    static constexpr Str8_View s_tilemap_directive = "@tilemap";
+    static constexpr Str8_View s_tilemap_image_bmp_format = "bmp";
+
+    tilemap->indexes = nullptr;
+    tilemap->indexes_count = 0;
+
+    mm::Temp_Scope temp(mm::get_scratch_arena());
+
+    // NOTE(gr3yknigh1): Only header is tokenized. Tile indexes are the most of the file, they are decoded right into
+    // the tilemap by `parse_uint_list`. [2026/10/17]
+    Token_List list = tokenize(temp.arena, buffer, tilemap_get_header_size(buffer, buffer_size));
+
+    const Token *cursor = list.tokens;
+    while (cursor < list.tokens + list.count && cursor->kind == Token_Kind::Newline) {
+        ++cursor;
+    }
+
+    if (!tilemap_expect(&list, &cursor, Token_Kind::Directive, "@tilemap directive")) {
+        return false;
+    }
+
+    if (!token_is(&list, cursor - 1, Token_Kind::Directive, s_tilemap_directive)) {
+        tilemap_report_error(&list, cursor - 1, "@tilemap directive");
+        return false;
+    }
+
+    const Token *row_count = tilemap_expect(&list, &cursor, Token_Kind::Int, "row count");
+    const Token *col_count = row_count ? tilemap_expect(&list, &cursor, Token_Kind::Int, "column count") : nullptr;
+    const Token *path = col_count ? tilemap_expect(&list, &cursor, Token_Kind::String, "image path") : nullptr;
+    const Token *format = path ? tilemap_expect(&list, &cursor, Token_Kind::Ident, "image format") : nullptr;
+    const Token *tile_x = format ? tilemap_expect(&list, &cursor, Token_Kind::Int, "tile width in pixels") : nullptr;
+    const Token *tile_y = tile_x ? tilemap_expect(&list, &cursor, Token_Kind::Int, "tile height in pixels") : nullptr;
+
+    if (tile_y == nullptr) {
+        return false;
+    }
+
+    // TODO(gr3yknigh1): Generalize format validation [2025/02/24]
+    if (!str8_view_is_equals(token_get_text(&list, format), s_tilemap_image_bmp_format)) {
+        tilemap_report_error(&list, format, "image format 'bmp'");
+        return false;
+    }
+
+    tilemap->row_count = token_get_int(&list, row_count);
+    tilemap->col_count = token_get_int(&list, col_count);
+    tilemap->tile_x_pixel_count = token_get_int(&list, tile_x);
+    tilemap->tile_y_pixel_count = token_get_int(&list, tile_y);
+
+    if (tilemap->row_count <= 0 || tilemap->col_count <= 0) {
+        tilemap_report_error(&list, tilemap->row_count <= 0 ? row_count : col_count, "positive size of tilemap");
+        return false;
+    }
+
+    if (static_cast<Int64U>(tilemap->row_count) * static_cast<Int64U>(tilemap->col_count) > INT32_MAX) {
+        tilemap_report_error(&list, row_count, "tilemap with less than 2^31 tiles");
+        return false;
+    }
+
+    *image_path = token_get_text(&list, path);
+
+    tilemap->indexes_count = tilemap->row_count * tilemap->col_count;
+    tilemap->indexes = static_cast<int *>(mm::allocate(tilemap->indexes_count * sizeof(*tilemap->indexes)));
+    assert(tilemap->indexes);
+
+    // NOTE(gr3yknigh1): Rest of the header line belongs to indexes too, as it was before tokenizer. [2026/10/17]
+    SizeU indexes_offset = tile_y->offset + tile_y->length;
+
+    static_assert(sizeof(*tilemap->indexes) == sizeof(Int32U));
+    Uint_List_Parse_Result result = parse_uint_list(
+        buffer + indexes_offset, buffer_size - indexes_offset, reinterpret_cast<Int32U *>(tilemap->indexes), tilemap->indexes_count, INT32_MAX);
+
+    if (result.status == Parse_Status::Ok) {
+        return true;
+    }
+
+    SizeU error_offset = indexes_offset + result.error_offset;
+    SizeU error_length = 1;
+    while (error_offset + error_length < buffer_size && !isspace(static_cast<unsigned char>(buffer[error_offset + error_length]))) {
+        ++error_length;
+    }
+
+    switch (result.status) {
+    case Parse_Status::Unexpected_Character:
+        tilemap_report_error(buffer, buffer_size, error_offset, error_length, "tile index");
+        break;
+    case Parse_Status::Overflow:
+        tilemap_report_error(buffer, buffer_size, error_offset, error_length, "tile index less than 2^31");
+        break;
+    case Parse_Status::Too_Many_Values:
+        tilemap_report_error(buffer, buffer_size, error_offset, error_length, "end of tile indexes");
+        break;
+    case Parse_Status::Too_Few_Values:
+        printf("E: [tilemap] Expected (%lu) tile indexes, got (%lu)\n", static_cast<unsigned long>(tilemap->indexes_count), static_cast<unsigned long>(result.count));
+        break;
+    case Parse_Status::Ok:
+        break;
+    }
+
+    mm::deallocate(tilemap->indexes);
+    tilemap->indexes = nullptr;
+
+    return false;
+}
+
+//!
+//! @brief Keeps copy of image path, since `image_path_view` points into the file, which is released after parsing.
+//!
+static bool
+tilemap_copy_texture_path(Tilemap *tilemap, Str8_View image_path_view)
+{
+    // TODO(gr3yknigh1): Factor this out [2025/02/24]
+    assert(image_path_view.length && image_path_view.data);
+
+    tilemap->texture_path = static_cast<char *>(mm::allocate(image_path_view.length + 1, ALLOCATE_ZERO_MEMORY));
+
+    return tilemap->texture_path != nullptr &&
+           str8_view_copy_to_nullterminated(image_path_view, tilemap->texture_path, image_path_view.length + 1);
+}
+
+static bool
+tilemap_load_texture(Asset_Store *store, Tilemap *tilemap)
+{
+    assert(tilemap->texture_path);
+
+    tilemap->texture_asset = asset_load(store, Asset_Type::Texture, tilemap->texture_path);
+    assert(!tilemap->texture_asset.is_null());
+
+    return !tilemap->texture_asset.is_null();
+}
+
+bool
+load_tilemap_from_buffer(char *buffer, SizeU buffer_size, Tilemap *tilemap)
+{
+    Str8_View tilemap_image_path_view;
+    if (!parse_tilemap(buffer, buffer_size, tilemap, &tilemap_image_path_view)) {
+        return false;
+    }
+
+    return tilemap_copy_texture_path(tilemap, tilemap_image_path_view);
+}
+
+bool
+parse_tilemap_binary(Byte *data, SizeU data_size, Tilemap *tilemap, Str8_View *image_path)
+{
+    tilemap->indexes = nullptr;
+    tilemap->indexes_count = 0;
+
+    Tilemap_Binary_Header header;
+
+    if (data_size < sizeof(header)) {
+        printf("E: [tilemap] Binary tilemap is truncated, size (%lu)\n", static_cast<unsigned long>(data_size));
+        return false;
+    }
+
+    noc_memory_copy(&header, data, sizeof(header));
+
+    if (header.magic != TILEMAP_BINARY_MAGIC) {
+        printf("E: [tilemap] Expected binary tilemap magic (0x%08X), got (0x%08X)\n", TILEMAP_BINARY_MAGIC, header.magic);
+        return false;
+    }
+
+    if (header.version != TILEMAP_BINARY_VERSION) {
+        printf("E: [tilemap] Unsupported binary tilemap version (%u), expected (%u)\n", header.version, TILEMAP_BINARY_VERSION);
+        return false;
+    }
+
+    if (header.index_size != sizeof(Int32S) && header.index_size != sizeof(Int16U)) {
+        printf("E: [tilemap] Unsupported binary tilemap index size (%u)\n", header.index_size);
+        return false;
+    }
+
+    if (header.row_count <= 0 || header.col_count <= 0
+        || static_cast<Int64U>(header.row_count) * static_cast<Int64U>(header.col_count) != header.indexes_count) {
+        printf(
+            "E: [tilemap] Binary tilemap size (%dx%d) doesn't match indexes count (%lu)\n", header.row_count, header.col_count,
+            static_cast<unsigned long>(header.indexes_count));
+        return false;
+    }
+
+    bool is_path_in_file = static_cast<Int64U>(header.image_path_offset) + header.image_path_length <= data_size;
+    bool are_indexes_in_file = header.indexes_offset % TILEMAP_BINARY_ALIGNMENT == 0 && header.indexes_offset <= data_size
+        && header.indexes_count <= (data_size - header.indexes_offset) / header.index_size;
+
+    if (!is_path_in_file || !are_indexes_in_file) {
+        printf("E: [tilemap] Binary tilemap is truncated, size (%lu)\n", static_cast<unsigned long>(data_size));
+        return false;
+    }
+
+    tilemap->row_count = header.row_count;
+    tilemap->col_count = header.col_count;
+    tilemap->tile_x_pixel_count = header.tile_x_pixel_count;
+    tilemap->tile_y_pixel_count = header.tile_y_pixel_count;
+    tilemap->indexes_count = header.indexes_count;
+
+    *image_path = Str8_View(reinterpret_cast<const char *>(data) + header.image_path_offset, header.image_path_length);
+
+    if (header.index_size == sizeof(Int32S)) {
+        tilemap->indexes = reinterpret_cast<Int32S *>(data + header.indexes_offset);
+        return true;
+    }
+
+    tilemap->indexes = mm::allocate_structs<Int32S>(tilemap->indexes_count);
+    assert(tilemap->indexes);
+
+    const Int16U *compact_indexes = reinterpret_cast<const Int16U *>(data + header.indexes_offset);
+    for (SizeU index = 0; index < tilemap->indexes_count; ++index) {
+        tilemap->indexes[index] = compact_indexes[index];
+    }
+
+    return true;
+}
+
+bool
+save_tilemap_binary(const Tilemap *tilemap, Str8_View image_path, Int16U index_size, FILE *file)
+{
+    assert(tilemap && file);
+    assert(index_size == sizeof(Int32S) || index_size == sizeof(Int16U));
+
+    if (index_size == sizeof(Int16U)) {
+        for (SizeU index = 0; index < tilemap->indexes_count; ++index) {
+            if (tilemap->indexes[index] < 0 || tilemap->indexes[index] > UINT16_MAX) {
+                printf("E: [tilemap] Tile index (%d) doesn't fit into 2 bytes\n", tilemap->indexes[index]);
+                return false;
+            }
+        }
+    }
+
+    Tilemap_Binary_Header header{};
+    header.magic = TILEMAP_BINARY_MAGIC;
+    header.version = TILEMAP_BINARY_VERSION;
+    header.index_size = index_size;
+    header.row_count = tilemap->row_count;
+    header.col_count = tilemap->col_count;
+    header.tile_x_pixel_count = tilemap->tile_x_pixel_count;
+    header.tile_y_pixel_count = tilemap->tile_y_pixel_count;
+    header.image_path_offset = sizeof(header);
+    header.image_path_length = static_cast<Int32U>(image_path.length);
+    header.indexes_offset = NOC_ALIGN_TO(sizeof(header) + image_path.length, TILEMAP_BINARY_ALIGNMENT);
+    header.indexes_count = tilemap->indexes_count;
+
+    static constexpr Byte s_padding[TILEMAP_BINARY_ALIGNMENT] = {};
+    SizeU padding_size = header.indexes_offset - sizeof(header) - image_path.length;
+
+    bool result = fwrite(&header, sizeof(header), 1, file) == 1;
+    result = result && (image_path.length == 0 || fwrite(image_path.data, image_path.length, 1, file) == 1);
+    result = result && (padding_size == 0 || fwrite(s_padding, padding_size, 1, file) == 1);
+
+    if (index_size == sizeof(Int32S)) {
+        return result && fwrite(tilemap->indexes, sizeof(*tilemap->indexes), tilemap->indexes_count, file) == tilemap->indexes_count;
+    }
+
+    Int16U compact_indexes[1024];
+
+    for (SizeU offset = 0; result && offset < tilemap->indexes_count; offset += STATIC_ARRAY_COUNT(compact_indexes)) {
+        SizeU count = tilemap->indexes_count - offset;
+        count = count < STATIC_ARRAY_COUNT(compact_indexes) ? count : STATIC_ARRAY_COUNT(compact_indexes);
+
+        for (SizeU index = 0; index < count; ++index) {
+            compact_indexes[index] = static_cast<Int16U>(tilemap->indexes[offset + index]);
+        }
+
+        result = fwrite(compact_indexes, sizeof(*compact_indexes), count, file) == count;
+    }
+
+    return result;
+}
+
+static bool
+tilemap_is_in_buffer(const Tilemap *tilemap, const Byte *data, SizeU data_size)
+{
+    const Byte *indexes = reinterpret_cast<const Byte *>(tilemap->indexes);
+    return indexes >= data && indexes < data + data_size;
+}
+
+//!
+//! @brief Picks format by magic. Indexes of binary tilemap can point into the `data` (see `tilemap_is_in_buffer`).
+//!
+static bool
+load_tilemap_from_memory(Byte *data, SizeU data_size, Tilemap *tilemap)
+{
+    Int32U magic = 0;
+    if (data_size >= sizeof(magic)) {
+        noc_memory_copy(&magic, data, sizeof(magic));
+    }
+
+    bool result = false;
+
+    if (magic == TILEMAP_BINARY_MAGIC) {
+        Str8_View image_path;
+        result = parse_tilemap_binary(data, data_size, tilemap, &image_path) && tilemap_copy_texture_path(tilemap, image_path);
+    } else {
+        result = load_tilemap_from_buffer(reinterpret_cast<char *>(data), data_size, tilemap);
+    }
+
+    if (!result && tilemap->indexes != nullptr && !tilemap_is_in_buffer(tilemap, data, data_size)) {
+        mm::deallocate(tilemap->indexes);
+    }
+
+    if (!result && tilemap->texture_path != nullptr) {
+        mm::deallocate(tilemap->texture_path);
+    }
+
+    if (!result) {
+        tilemap->indexes = nullptr;
+        tilemap->texture_path = nullptr;
+    }
+
+    return result;
+}
+
+bool
+load_tilemap_from_file(const char *file_path, Tilemap *tilemap)
+{
+    SizeU data_size = 0;
+    Byte *data = static_cast<Byte *>(noc_native_map_file(file_path, &data_size));
+
+    if (data == nullptr) {
+        printf("E: [tilemap] Failed to map file '%s'\n", file_path);
+        return false;
+    }
+
+    bool result = load_tilemap_from_memory(data, data_size, tilemap);
+
+    //
+    // NOTE(gr3yknigh1): Indexes of `Int32S` tilemap are copied out, so the file isn't kept mapped. Mapping of file,
+    // which is hot-reloaded, breaks in both ways: on Linux file rewritten in place gives SIGBUS on pages, which weren't
+    // copied yet, and on Windows mapped file can't be rewritten at all. Converter also replaces file with rename, so
+    // watcher never sees half-written one. [2026/10/17]
+    //
+    if (result && tilemap_is_in_buffer(tilemap, data, data_size)) {
+        Int32S *indexes = mm::allocate_structs<Int32S>(tilemap->indexes_count);
+        assert(indexes);
+
+        noc_memory_copy(indexes, tilemap->indexes, tilemap->indexes_count * sizeof(*indexes));
+        tilemap->indexes = indexes;
+    }
+
+    [[maybe_unused]] bool is_unmapped = noc_native_unmap_file(data, data_size);
+    assert(is_unmapped);
+
+    return result;
+}
+
+static void asset_store_launch_workers(Asset_Store *store);
+static void asset_store_stop_workers(Asset_Store *store);
+
+static void
+asset_store_init(Asset_Store *store, Asset_Store_Place place)
+{
+    noxx::zero_type(store);
+
+    store->place = place;
+
+    store->assets = mm::allocate_structs<Asset>(Asset_Store::max_asset_count, ALLOCATE_ZERO_MEMORY);
+    store->generations = mm::allocate_structs<Int16U>(Asset_Store::max_asset_count, ALLOCATE_ZERO_MEMORY);
+    store->free_slots = mm::allocate_structs<Int16U>(Asset_Store::max_asset_count, ALLOCATE_ZERO_MEMORY);
+    store->live_slots = mm::allocate_structs<Int16U>(Asset_Store::max_asset_count, ALLOCATE_ZERO_MEMORY);
+    store->live_positions = mm::allocate_structs<Int16U>(Asset_Store::max_asset_count, ALLOCATE_ZERO_MEMORY);
+    assert(store->assets && store->generations && store->free_slots && store->live_slots && store->live_positions);
+
+    store->path_index = mm::allocate_structs<Asset_Handle>(Asset_Store::path_index_capacity, ALLOCATE_ZERO_MEMORY);
+    assert(store->path_index);
+
+    store->dirty_assets = mm::allocate_structs<Asset_Handle>(Asset_Store::max_asset_count, ALLOCATE_ZERO_MEMORY);
+    assert(store->dirty_assets);
+
+    asset_store_launch_workers(store);
+}
+
+bool
+make_asset_store_from_folder(Asset_Store *store, const char *folder_path)
+{
+    assert(store && folder_path);
+
+    asset_store_init(store, Asset_Store_Place::Folder);
+    store->u.folder = folder_path;
+
+    return true;
+}
+
+static bool
+asset_archive_validate(const Asset_Archive_Header *header, const Asset_Archive_Entry *entries, SizeU data_size)
+{
+    if (header->magic != ASSET_ARCHIVE_MAGIC || header->version != ASSET_ARCHIVE_VERSION) {
+        return false;
+    }
+
+    if (header->entries_offset % alignof(Asset_Archive_Entry) != 0 || header->entries_offset > data_size ||
+        header->entries_count > (data_size - header->entries_offset) / sizeof(Asset_Archive_Entry)) {
+        return false;
+    }
+
+    if (header->paths_offset > data_size || header->paths_size > data_size - header->paths_offset) {
+        return false;
+    }
+
+    for (Int32U entry_index = 0; entry_index < header->entries_count; ++entry_index) {
+        const Asset_Archive_Entry *entry = entries + entry_index;
+
+        // NOTE(gr3yknigh1): Payload is followed by zero byte, so it stays in the mapping too. [2026/10/17]
+        if (entry->offset >= data_size || entry->size >= data_size - entry->offset) {
+            return false;
+        }
+
+        if (entry->path_offset > header->paths_size || entry->path_length > header->paths_size - entry->path_offset) {
+            return false;
+        }
+
+        if (entry_index > 0 && entries[entry_index - 1].path_hash > entry->path_hash) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool
+make_asset_store_from_image(Asset_Store *store, const char *image_path)
+{
+    assert(store && image_path);
+
+    SizeU data_size = 0;
+    Byte *data = static_cast<Byte *>(noc_native_map_file(image_path, &data_size));
+
+    if (data == nullptr) {
+        printf("E: [asset_archive] Failed to map file '%s'\n", image_path);
+        return false;
+    }
+
+    Asset_Archive_Header header{};
+
+    if (data_size >= sizeof(header)) {
+        noc_memory_copy(&header, data, sizeof(header));
+    }
+
+    const Asset_Archive_Entry *entries = reinterpret_cast<const Asset_Archive_Entry *>(data + header.entries_offset);
+
+    if (data_size < sizeof(header) || !asset_archive_validate(&header, entries, data_size)) {
+        printf("E: [asset_archive] File '%s' isn't valid archive\n", image_path);
+
+        [[maybe_unused]] bool is_unmapped = noc_native_unmap_file(data, data_size);
+        assert(is_unmapped);
+
+        return false;
+    }
+
+    asset_store_init(store, Asset_Store_Place::Image);
+
+    Asset_Archive *archive = &store->u.image;
+    archive->data = data;
+    archive->size = data_size;
+    archive->entries = entries;
+    archive->entries_count = header.entries_count;
+    archive->paths = reinterpret_cast<const char *>(data + header.paths_offset);
+
+    return true;
+}
+
+bool
+asset_store_destroy(Asset_Store *store)
+{
+    assert(store);
+
+    asset_store_stop_workers(store);
+
+    for (Int32U live_index = 0; live_index < store->live_count; ++live_index) {
+        Asset *asset = store->assets + store->live_slots[live_index];
+
+        if (asset->location.type == Asset_Location_Type::File) {
+            asset->location.u.file.path.destroy();
+        }
+    }
+
+    mm::deallocate(store->assets);
+    mm::deallocate(store->generations);
+    mm::deallocate(store->free_slots);
+    mm::deallocate(store->live_slots);
+    mm::deallocate(store->live_positions);
+
+    mm::deallocate(store->path_index);
+    mm::deallocate(store->dirty_assets);
+
+    if (store->place == Asset_Store_Place::Image) {
+        [[maybe_unused]] bool is_unmapped = noc_native_unmap_file(store->u.image.data, store->u.image.size);
+        assert(is_unmapped);
+    }
+
+    noxx::zero_type(store);
+
+    return true;
+}
+
+Int64U
+asset_archive_hash_path(Str8_View path)
+{
+    Int64U hash = 0xCBF29CE484222325ULL;
+
+    for (SizeU index = 0; index < path.length; ++index) {
+        char c = path.data[index] == '\\' ? '/' : path.data[index];
+        hash ^= static_cast<Byte>(c);
+        hash *= 0x100000001B3ULL;
+    }
+
+    return hash;
+}
+
+static bool
+asset_archive_path_is_equals(Str8_View archive_path, Str8_View path)
+{
+    if (archive_path.length != path.length) {
+        return false;
+    }
+
+    for (SizeU index = 0; index < path.length; ++index) {
+        char c = path.data[index] == '\\' ? '/' : path.data[index];
+
+        if (archive_path.data[index] != c) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static const Asset_Archive_Entry *
+asset_archive_find_exact(const Asset_Archive *archive, Str8_View path)
+{
+    Int64U path_hash = asset_archive_hash_path(path);
+
+    Int32U low = 0, high = archive->entries_count;
+
+    while (low < high) {
+        Int32U middle = low + (high - low) / 2;
+
+        if (archive->entries[middle].path_hash < path_hash) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    for (; low < archive->entries_count && archive->entries[low].path_hash == path_hash; ++low) {
+        const Asset_Archive_Entry *entry = archive->entries + low;
+
+        if (asset_archive_path_is_equals(asset_archive_get_path(archive, entry), path)) {
+            return entry;
+        }
+    }
+
+    return nullptr;
+}
+
+const Asset_Archive_Entry *
+asset_archive_find(const Asset_Archive *archive, Str8_View path)
+{
+    assert(archive);
+
+    while (!path.empty()) {
+        const Asset_Archive_Entry *entry = asset_archive_find_exact(archive, path);
+
+        if (entry != nullptr) {
+            return entry;
+        }
+
+        SizeU separator_index = 0;
+        while (separator_index < path.length && path.data[separator_index] != '/' && path.data[separator_index] != '\\') {
+            ++separator_index;
+        }
+
+        if (separator_index == path.length) {
+            break;
+        }
+
+        path = Str8_View(path.data + separator_index + 1, path.length - separator_index - 1);
+    }
+
+    return nullptr;
+}
+
+Str8_View
+asset_archive_get_path(const Asset_Archive *archive, const Asset_Archive_Entry *entry)
+{
+    assert(archive && entry);
+    return Str8_View(archive->paths + entry->path_offset, entry->path_length);
+}
+
+static void
+asset_store_lock(std::atomic_flag *lock)
+{
+    while (lock->test_and_set(std::memory_order_acquire)) {
+        while (lock->test(std::memory_order_relaxed)) {
+        }
+    }
+}
+
+static void
+asset_store_unlock(std::atomic_flag *lock)
+{
+    lock->clear(std::memory_order_release);
+}
+
+static Asset_Handle
+asset_store_make_handle(Asset_Store *store, Int16U slot_index)
+{
+    return Asset_Handle{ static_cast<Int32U>(store->generations[slot_index]) << 16 | slot_index };
+}
+
+Asset *
+asset_store_get(Asset_Store *store, Asset_Handle handle)
+{
+    assert(store);
+
+    Int16U slot_index = handle.index();
+
+    //
+    // NOTE(gr3yknigh1): Generation of the slot changes only when it's taken first time (from zero, which no handle
+    // has) and when it's released, so this is safe without the lock as long as handle's owner doesn't release it
+    // concurrently. [2026/10/17]
+    //
+    if (handle.is_null() || slot_index >= Asset_Store::max_asset_count || store->generations[slot_index] != handle.generation()) {
+        return nullptr;
+    }
+
+    return store->assets + slot_index;
+}
+
+Asset_Handle
+asset_store_get_handle(Asset_Store *store, const Asset *asset)
+{
+    assert(store && asset >= store->assets && asset < store->assets + Asset_Store::max_asset_count);
+
+    return asset_store_make_handle(store, static_cast<Int16U>(asset - store->assets));
+}
+
+//!
+//! @brief Walks the probe sequence of `path_hash`. Should be called under `content_lock`.
+//!
+//! @return Slot with the asset of this path, or empty slot (first tombstone on the way, if any). Nullptr if table is
+//! full.
+//!
+static Asset_Handle *
+asset_store_probe_path_index(Asset_Store *store, Int64U path_hash, Str8_View file_path)
+{
+    constexpr Int64U mask = Asset_Store::path_index_capacity - 1;
+    static_assert((Asset_Store::path_index_capacity & mask) == 0, "Capacity should be power of two");
+
+    Asset_Handle *tombstone = nullptr;
+
+    for (Int64U probe_index = 0; probe_index < Asset_Store::path_index_capacity; ++probe_index) {
+        Asset_Handle *slot = store->path_index + ((path_hash + probe_index) & mask);
+
+        if (slot->is_null()) {
+            return tombstone != nullptr ? tombstone : slot;
+        }
+
+        Asset *asset = asset_store_get(store, *slot);
+
+        if (asset == nullptr) {
+            if (tombstone == nullptr) {
+                tombstone = slot;
+            }
+            continue;
+        }
+
+        const File_Info *file = &asset->location.u.file;
+
+        if (file->path_hash == path_hash && str8_view_is_equals(file_path, file->path)) {
+            return slot;
+        }
+    }
+
+    return tombstone;
+}
+
+Asset_Handle
+asset_store_find(Asset_Store *store, Str8_View file_path)
+{
+    assert(store);
+
+    Asset_Handle handle{};
+
+    asset_store_lock(&store->content_lock);
+
+    Asset_Handle *slot = asset_store_probe_path_index(store, str8_view_hash(file_path), file_path);
+
+    if (slot != nullptr && asset_store_get(store, *slot) != nullptr) {
+        handle = *slot;
+    }
+
+    asset_store_unlock(&store->content_lock);
+
+    return handle;
+}
+
+bool
+asset_store_mark_dirty(Asset_Store *store, Asset_Handle handle)
+{
+    assert(store);
+
+    //
+    // NOTE(gr3yknigh1): Under the lock, so asset can't be released in between. Released slot is zeroed, which clears
+    // the flag for the next asset in it. [2026/10/17]
+    //
+    asset_store_lock(&store->content_lock);
+
+    Asset *asset = asset_store_get(store, handle);
+    bool result = asset != nullptr && !asset->should_reload.test_and_set();
+
+    asset_store_unlock(&store->content_lock);
+
+    if (!result) {
+        return false;
+    }
+
+    Int64U tail = store->dirty_assets_tail.load(std::memory_order_relaxed);
+    assert(tail - store->dirty_assets_head.load(std::memory_order_acquire) < Asset_Store::max_asset_count);
+
+    store->dirty_assets[tail % Asset_Store::max_asset_count] = handle;
+    store->dirty_assets_tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+}
+
+Asset *
+asset_store_pop_dirty(Asset_Store *store)
+{
+    assert(store);
+
+    for (;;) {
+        Int64U head = store->dirty_assets_head.load(std::memory_order_relaxed);
+
+        if (head == store->dirty_assets_tail.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+
+        Asset_Handle handle = store->dirty_assets[head % Asset_Store::max_asset_count];
+        store->dirty_assets_head.store(head + 1, std::memory_order_release);
+
+        // NOTE(gr3yknigh1): Slots are released only by main thread, so asset can't go stale after this check. [2026/10/17]
+        Asset *asset = asset_store_get(store, handle);
+
+        if (asset == nullptr) {
+            continue;
+        }
+
+        //
+        // NOTE(gr3yknigh1): Clearing before reload, so the change which happens during reload will queue asset
+        // again. [2026/10/17]
+        //
+        asset->should_reload.clear();
+
+        return asset;
+    }
+}
+
+static void
+asset_store_release_content(Asset *asset)
+{
+    mm::deallocate(asset->content.data);
+    asset->content = mm::Buffer_View();
+}
+
+//!
+//! @brief I/O queue of the calling thread. Created on first use, workers destroy their queues at exit.
+//!
+static NOC_IO_Queue *
+asset_get_io_queue(void)
+{
+    thread_local NOC_IO_Queue *queue = nullptr;
+
+    if (queue == nullptr) {
+        queue = noc_io_queue_make(NOC_IO_BACKEND_DEFAULT);
+        assert(queue);
+    }
+
+    return queue;
+}
+
+static bool
+asset_is_read_whole(const Asset *asset)
+{
+    return asset->location.type == Asset_Location_Type::File &&
+           (asset->type == Asset_Type::Texture || asset->type == Asset_Type::Shader);
+}
+
+//!
+//! @brief Reads files of textures and shaders into allocated content with two batches: sizes, then contents. Tilemaps
+//! are read by `load_tilemap_from_file`. Assets, which failed to read, are left without content.
+//!
+static void
+asset_store_read_files(Asset **assets, SizeU assets_count)
+{
+    assert(assets_count <= Asset_Store::max_batch_count);
+
+    NOC_IO_Request requests[Asset_Store::max_batch_count];
+    Asset *request_assets[Asset_Store::max_batch_count];
+    SizeU requests_count = 0;
+
+    for (SizeU asset_index = 0; asset_index < assets_count; ++asset_index) {
+        Asset *asset = assets[asset_index];
+
+        if (!asset_is_read_whole(asset)) {
+            continue;
+        }
+
+        assert(asset->content.data == nullptr);
+
+        NOC_IO_Request *request = requests + requests_count;
+        noxx::zero_type(request);
+        request->path = asset->location.u.file.path.data;
+
+        request_assets[requests_count++] = asset;
+    }
+
+    if (requests_count == 0) {
+        return;
+    }
+
+    NOC_IO_Queue *queue = asset_get_io_queue();
+    noc_io_get_file_sizes(queue, requests, requests_count);
+
+    for (SizeU request_index = 0; request_index < requests_count; ++request_index) {
+        NOC_IO_Request *request = requests + request_index;
+
+        if (request->error != 0) {
+            continue;
+        }
+
+        // NOTE(gr3yknigh1): Zero byte after the content, so shader sources are C strings. [2026/10/17]
+        request->capacity = request->size;
+        request->buffer = static_cast<Byte *>(mm::allocate(request->capacity + 1));
+        assert(request->buffer);
+
+        request->buffer[request->capacity] = 0;
+    }
+
+    noc_io_read_files(queue, requests, requests_count);
+
+    for (SizeU request_index = 0; request_index < requests_count; ++request_index) {
+        NOC_IO_Request *request = requests + request_index;
+        Asset *asset = request_assets[request_index];
+
+        asset->content.data = request->buffer;
+        asset->location.u.file.size = request->size;
+
+        if (request->error == 0) {
+            asset->content.size = request->size;
+            continue;
+        }
+
+        printf("E: [asset] Failed to read file '%s' (%d)\n", request->path, request->error);
+        asset_store_release_content(asset);
+    }
+}
+
+//!
+//! @brief Loads asset from `data`, which outlives it (archive mapping). Content is borrowed from the `data` where
+//! possible (see `asset_location_contains`). Shaders aren't compiled and tilemap textures aren't loaded here (see
+//! `asset_finish`).
+//!
+static bool
+asset_load_from_memory(Asset *asset, Byte *data, SizeU data_size)
+{
+    if (asset->type == Asset_Type::Texture) {
+        Bitmap_Picture picture;
+        return load_bitmap_picture_from_buffer(&picture, data, data_size) && asset_from_bitmap_picture(asset, &picture);
+    }
+
+    if (asset->type == Asset_Type::Shader) {
+        asset->u.shader.source_code = reinterpret_cast<char *>(data);
+        asset->u.shader.source_code_size = data_size;
+        return true;
+    }
+
+    if (asset->type == Asset_Type::Tilemap) {
+        return load_tilemap_from_memory(data, data_size, &asset->u.tilemap);
+    }
+
+    return false;
+}
+
+static bool
+asset_location_contains(const Asset_Location *location, const void *pointer)
+{
+    if (location->type != Asset_Location_Type::Buffer) {
+        return false;
+    }
+
+    const Byte *byte_pointer = static_cast<const Byte *>(pointer);
+    const mm::Buffer_View *view = &location->u.buffer_view;
+
+    return byte_pointer >= view->data && byte_pointer < view->data + view->size;
+}
+
+//!
+//! @brief Points location of the new asset to the file, or to the archive entry for image stores.
+//!
+static bool
+asset_locate(Asset_Store *store, Asset *asset, Str8_View file_path)
+{
+    Asset_Location *location = &asset->location;
+
+    if (store->place == Asset_Store_Place::Image) {
+        const Asset_Archive *archive = &store->u.image;
+
+        const Asset_Archive_Entry *entry = asset_archive_find(archive, file_path);
+
+        if (entry == nullptr || entry->type != static_cast<Int32U>(asset->type)) {
+            printf("E: [asset] '%.*s' isn't in the archive\n", static_cast<int>(file_path.length), file_path.data);
+            return false;
+        }
+
+        location->type = Asset_Location_Type::Buffer;
+        location->u.buffer_view.data = archive->data + entry->offset;
+        location->u.buffer_view.size = entry->size;
+
+        return true;
+    }
+
+    location->type             = Asset_Location_Type::File;
+    location->u.file.path      = Str8(file_path.data, file_path.length) /*asset_store_resolve_file(file)*/;
+    location->u.file.handle    = nullptr; // NOTE(gr3yknigh1): Files are read in batches, handles aren't kept. [2026/10/17]
+    location->u.file.path_hash = str8_view_hash(location->u.file.path);
+
+    return true;
+}
+
+//!
+//! @brief CPU stage of loading: reads and decodes the content. Doesn't touch GL, so it runs on worker threads too.
+//! Content of textures and shaders can be read beforehand by `asset_store_read_files`.
+//!
+static bool
+asset_read(Asset *asset)
+{
+    Asset_Location *location = &asset->location;
+
+    if (location->type == Asset_Location_Type::Buffer) {
+        return asset_load_from_memory(asset, location->u.buffer_view.data, location->u.buffer_view.size);
+    }
+
+    if (location->type != Asset_Location_Type::File) {
+        return false;
+    }
+
+    if (asset->type == Asset_Type::Tilemap) {
+        return load_tilemap_from_file(location->u.file.path.data, &asset->u.tilemap);
+    }
+
+    if (asset->content.data == nullptr) {
+        asset_store_read_files(&asset, 1);
+    }
+
+    if (asset->content.data == nullptr) {
+        return false;
+    }
+
+    bool result = asset_load_from_memory(asset, asset->content.data, asset->content.size);
+
+    if (!result) {
+        asset_store_release_content(asset);
+    }
+
+    return result;
+}
+
+//!
+//! @brief Main thread stage of loading: compiles shaders (main thread owns GL context) and loads tilemap textures
+//! (workers never touch slots of the store).
+//!
+static bool
+asset_finish(Asset_Store *store, Asset *asset)
+{
+    if (asset->type == Asset_Type::Tilemap) {
+        return tilemap_load_texture(store, &asset->u.tilemap);
+    }
+
+    if (asset->type == Asset_Type::Shader) {
+        Shader_Compile_Result result = compile_shader(asset->u.shader.source_code, asset->u.shader.source_code_size);
+
+        //
+        // TODO(gr3yknigh1): Delete shader modules. They are no longer needed. [2025/03/28]
+        //
+
+        if (asset->u.shader.program_id != 0) {
+            glDeleteProgram(asset->u.shader.program_id); // @cleanup
+        }
+
+        Shader *shader = &asset->u.shader;
+        shader->program_id = result.shader_program_id;
+
+        if (shader->program_id == 0) {
+            return false;
+        }
+
+        shader->model_location = glGetUniformLocation(shader->program_id, "model");
+        shader->projection_location = glGetUniformLocation(shader->program_id, "projection");
+        shader->texture_location = glGetUniformLocation(shader->program_id, "u_texture");
+
+        return shader->model_location != -1 && shader->projection_location != -1 && shader->texture_location != -1;
+    }
+
+    return true;
+}
+
+//!
+//! @brief Publishes asset in path index, so watcher can find it. Archive assets aren't published, since there is
+//! nothing to watch.
+//!
+static void
+asset_store_publish(Asset_Store *store, Asset *asset)
+{
+    const Asset_Location *location = &asset->location;
+
+    if (location->type != Asset_Location_Type::File) {
+        return;
+    }
+
+    //
+    // NOTE(gr3yknigh1): Publishing after asset is fully initialized, because watcher thread reads the index. If path
+    // was already loaded, latest asset replaces previous one. [2026/10/17]
+    //
+    asset_store_lock(&store->content_lock);
+
+    Asset_Handle *slot = asset_store_probe_path_index(store, location->u.file.path_hash, location->u.file.path);
+    assert(slot && "Path index is full");
+    *slot = asset_store_get_handle(store, asset);
+
+    asset_store_unlock(&store->content_lock);
+}
+
+//!
+//! @brief Takes free slot (released ones first). Slots are zeroed on release, so asset comes zeroed.
+//!
+static Asset *
+asset_store_allocate_asset(Asset_Store *store, Asset_Type type)
+{
+    asset_store_lock(&store->content_lock);
+
+    Int16U slot_index = 0;
+
+    if (store->free_count > 0) {
+        slot_index = store->free_slots[--store->free_count];
+    } else {
+        assert(store->slots_count < Asset_Store::max_asset_count && "Asset store is full");
+
+        slot_index = static_cast<Int16U>(store->slots_count++);
+        store->generations[slot_index] = 1;
+    }
+
+    store->live_positions[slot_index] = static_cast<Int16U>(store->live_count);
+    store->live_slots[store->live_count++] = slot_index;
+
+    asset_store_unlock(&store->content_lock);
+
+    Asset *asset = store->assets + slot_index;
+    asset->type = type;
+
+    return asset;
+}
+
+Asset_Handle
+asset_load(Asset_Store *store, Asset_Type type, const Str8_View file_path)
+{
+    assert(store && !file_path.empty());
+
+    Asset *asset = asset_store_allocate_asset(store, type);
+
+    bool is_loaded = asset_locate(store, asset, file_path) && asset_read(asset) && asset_finish(store, asset);
+    assert(is_loaded);
+
+    if (is_loaded) {
+        asset->state = Asset_State::Loaded;
+        asset_store_publish(store, asset);
+    } else {
+        asset->state = Asset_State::LoadFailure;
+    }
+
+    return asset_store_get_handle(store, asset);
+}
+
+bool
+asset_reload(Asset_Store *store, Asset *asset)
+{
+    bool result = true;
+
+    assert(store && asset);
+    assert(asset->state != Asset_State::Loading);
+
+    if (asset->state == Asset_State::Loaded) {
+        result = asset_unload(store, asset);
+    }
+
+    result = result && asset_read(asset) && asset_finish(store, asset);
+
+    if (result) {
+        asset->state = Asset_State::Loaded;
+    }
+    return result;
+}
+
+//
+// Async loading:
+//
+
+static void
+asset_store_push_job(Asset_Store *store, Asset *asset)
+{
+    asset->state = Asset_State::Loading;
+    store->loading_count.fetch_add(1, std::memory_order_relaxed);
+
+    asset_store_lock(&store->jobs_lock);
+
+    assert(store->jobs_tail - store->jobs_head < Asset_Store::max_asset_count);
+    store->jobs[store->jobs_tail++ % Asset_Store::max_asset_count] = asset;
+
+    asset_store_unlock(&store->jobs_lock);
+
+    store->jobs_signal.fetch_add(1, std::memory_order_release);
+    store->jobs_signal.notify_one();
+}
+
+//!
+//! @brief Takes up to `capacity` queued jobs. Blocks while queue is empty. Returns zero when store is destroyed.
+//!
+static SizeU
+asset_store_pop_jobs(Asset_Store *store, Asset **assets, SizeU capacity)
+{
+    for (;;) {
+        Int32U signal = store->jobs_signal.load(std::memory_order_acquire);
+
+        asset_store_lock(&store->jobs_lock);
+
+        SizeU count = 0;
+        while (count < capacity && store->jobs_head != store->jobs_tail) {
+            assets[count++] = store->jobs[store->jobs_head++ % Asset_Store::max_asset_count];
+        }
+
+        asset_store_unlock(&store->jobs_lock);
+
+        if (count > 0) {
+            return count;
+        }
+
+        if (store->is_stopping.load(std::memory_order_acquire)) {
+            return 0;
+        }
+
+        store->jobs_signal.wait(signal, std::memory_order_acquire);
+    }
+}
+
+static void
+asset_worker_routine(Asset_Store *store)
+{
+    Asset *assets[Asset_Store::max_batch_count];
+
+    for (SizeU count = asset_store_pop_jobs(store, assets, Asset_Store::max_batch_count); count != 0;
+         count = asset_store_pop_jobs(store, assets, Asset_Store::max_batch_count)) {
+
+        asset_store_read_files(assets, count);
+
+        for (SizeU asset_index = 0; asset_index < count; ++asset_index) {
+            Asset *asset = assets[asset_index];
+
+            //
+            // NOTE(gr3yknigh1): State belongs to main thread, it's set by `asset_store_pop_completed`. [2026/10/17]
+            //
+            bool is_read = asset_read(asset);
+
+            asset_store_lock(&store->completed_lock);
+            assert(store->completed_tail - store->completed_head < Asset_Store::max_asset_count && "Completed ring is full");
+            store->completed_assets[store->completed_tail++ % Asset_Store::max_asset_count] = Asset_Completion{asset, is_read};
+            asset_store_unlock(&store->completed_lock);
+
+            store->loading_count.fetch_sub(1, std::memory_order_release);
+            store->loading_count.notify_all();
+        }
+    }
+
+    noc_io_queue_destroy(asset_get_io_queue());
+    mm::release_scratch_arena();
+    mm::pool_flush_thread_cache();
+}
+
+static void
+asset_store_launch_workers(Asset_Store *store)
+{
+    store->jobs = mm::allocate_structs<Asset *>(Asset_Store::max_asset_count, ALLOCATE_ZERO_MEMORY);
+    store->completed_assets = mm::allocate_structs<Asset_Completion>(Asset_Store::max_asset_count, ALLOCATE_ZERO_MEMORY);
+    assert(store->jobs && store->completed_assets);
+
+    // NOTE(gr3yknigh1): One core is left for main thread. [2026/10/17]
+    Int32U hardware_threads_count = std::thread::hardware_concurrency();
+    store->workers_count = hardware_threads_count > 1 ? hardware_threads_count - 1 : 1;
+
+    if (store->workers_count > Asset_Store::max_workers_count) {
+        store->workers_count = Asset_Store::max_workers_count;
+    }
+
+    for (Int32U worker_index = 0; worker_index < store->workers_count; ++worker_index) {
+        store->workers[worker_index] = std::thread(asset_worker_routine, store);
+    }
+}
+
+static void
+asset_store_stop_workers(Asset_Store *store)
+{
+    store->is_stopping.store(true, std::memory_order_release);
+    store->jobs_signal.fetch_add(1, std::memory_order_release);
+    store->jobs_signal.notify_all();
+
+    for (Int32U worker_index = 0; worker_index < store->workers_count; ++worker_index) {
+        store->workers[worker_index].join();
+    }
+
+    mm::deallocate(store->jobs);
+    mm::deallocate(store->completed_assets);
+}
+
+Asset_Handle
+asset_load_async(Asset_Store *store, Asset_Type type, const Str8_View file_path)
+{
+    assert(store && !file_path.empty());
+
+    Asset *asset = asset_store_allocate_asset(store, type);
+
+    if (asset_locate(store, asset, file_path)) {
+        asset_store_push_job(store, asset);
+    } else {
+        asset->state = Asset_State::LoadFailure;
+    }
+
+    return asset_store_get_handle(store, asset);
+}
+
+bool
+asset_reload_async(Asset_Store *store, Asset *asset)
+{
+    assert(store && asset);
+
+    if (asset->state == Asset_State::Loading) {
+        return false;
+    }
+
+    if (asset->state == Asset_State::Loaded && !asset_unload(store, asset)) {
+        return false;
+    }
+
+    asset_store_push_job(store, asset);
+
+    return true;
+}
+
+Asset *
+asset_store_pop_completed(Asset_Store *store)
+{
+    assert(store);
+
+    asset_store_lock(&store->completed_lock);
+
+    Asset_Completion completion = {};
+    if (store->completed_head != store->completed_tail) {
+        completion = store->completed_assets[store->completed_head++ % Asset_Store::max_asset_count];
+    }
+
+    asset_store_unlock(&store->completed_lock);
+
+    Asset *asset = completion.asset;
+    if (asset == nullptr) {
+        return nullptr;
+    }
+
+    if (completion.is_read && asset_finish(store, asset)) {
+        asset->state = Asset_State::Loaded;
+        asset_store_publish(store, asset);
+    } else {
+        asset->state = Asset_State::LoadFailure;
+    }
+
+    return asset;
+}
+
+void
+asset_store_wait_loading(Asset_Store *store)
+{
+    assert(store);
+
+    for (Int32U count = store->loading_count.load(std::memory_order_acquire); count != 0;
+         count = store->loading_count.load(std::memory_order_acquire)) {
+        store->loading_count.wait(count, std::memory_order_acquire);
+    }
+}
+
+bool
+asset_release(Asset_Store *store, Asset_Handle handle)
+{
+    assert(store);
+
+    Asset *asset = asset_store_get(store, handle);
+
+    if (asset == nullptr) {
+        return false;
+    }
+
+    assert(asset->state != Asset_State::Loading && "Asset is still read by workers");
+
+    if (asset->state == Asset_State::Loaded) {
+        [[maybe_unused]] bool is_unloaded = asset_unload(store, asset);
+        assert(is_unloaded);
+    }
+
+    if (asset->type == Asset_Type::Texture && asset->u.texture.id != 0) {
+        glDeleteTextures(1, &asset->u.texture.id);
+    } else if (asset->type == Asset_Type::Shader && asset->u.shader.program_id != 0) {
+        glDeleteProgram(asset->u.shader.program_id);
+    }
+
+    asset_store_lock(&store->content_lock);
+
+    if (asset->location.type == Asset_Location_Type::File) {
+        asset->location.u.file.path.destroy();
+    }
+
+    noxx::zero_type(asset);
+
+    Int16U slot_index = handle.index();
+
+    if (++store->generations[slot_index] == 0) {
+        store->generations[slot_index] = 1;
+    }
+
+    store->free_slots[store->free_count++] = slot_index;
+
+    Int16U live_position = store->live_positions[slot_index];
+    Int16U last_slot_index = store->live_slots[--store->live_count];
+
+    store->live_slots[live_position] = last_slot_index;
+    store->live_positions[last_slot_index] = live_position;
+
+    asset_store_unlock(&store->content_lock);
+
+    return true;
+}
+
+
+bool
+asset_from_bitmap_picture(Asset *asset, Bitmap_Picture *picture)
+{
+    //
+    // Copy image data to more generalized structure
+    //
+    asset->u.texture.width = picture->dib_header.width;
+    asset->u.texture.height = picture->dib_header.height;
+
+    asset->u.texture.layout = Color_Layout::Nothing;
+
+    if (picture->dib_header.compression_method ==  Bitmap_Picture_Compression_Method::Bitfields) {
+        asset->u.texture.layout = Color_Layout::BGRA_U8;
+    }
+
+    assert(asset->u.texture.layout != Color_Layout::Nothing);
+
+    asset->u.texture.pixels.data = picture->u.data;
+
+    return true;
+}
+
+
+bool
+asset_unload(Asset_Store *store, Asset *asset)
+{
+    assert(store && asset);
+    assert(asset->state == Asset_State::Loaded);
+
+    bool result = true;
+
+    if (asset->type == Asset_Type::Texture || asset->type == Asset_Type::Shader) {
+        asset_store_release_content(asset);
+    } else if (asset->type == Asset_Type::Tilemap) {
+        Tilemap *tilemap = &asset->u.tilemap;
+
+        //
+        // NOTE(gr3yknigh1): Texture is owned by the tilemap, reload loads the new one from (possibly changed) image
+        // path. [2026/10/17]
+        //
+        asset_release(store, tilemap->texture_asset);
+        tilemap->texture_asset = Asset_Handle{};
+
+        if (!asset_location_contains(&asset->location, tilemap->indexes)) {
+            mm::deallocate(tilemap->indexes);
+        }
+
+        mm::deallocate(tilemap->texture_path);
+        tilemap->texture_path = nullptr;
+    } else {
+        result = false;
+    }
+
+    if (result) {
+        asset->state = Asset_State::Unloaded;
+    } else {
+        asset->state = Asset_State::UnloadFailure;
+    }
+
+    return result;
+}
+
+Shader_Compile_Result
+compile_shader(char *source_code, SizeU file_size)
+{
+    constexpr static Str8_View s_begin_directive = "#begin";
+    constexpr static Str8_View s_vertex_literal = "vertex";
+    constexpr static Str8_View s_fragment_literal = "fragment";
+
+    mm::Temp_Scope temp(mm::get_scratch_arena());
+
+    // TODO(gr3yknigh1): Skip /**/ comments [2025/03/19]
+    Token_List list = tokenize(temp.arena, source_code, file_size);
+
+    Str8_View vertex_source{};
+    Str8_View fragment_source{};
+
+    for (SizeU token_index = 0; token_index < list.count; ++token_index) {
+        if (!token_is(&list, list.tokens + token_index, Token_Kind::Directive, s_begin_directive) || token_index + 1 >= list.count) {
+            continue;
+        }
+
+        const Token *stage = list.tokens + token_index + 1;
+        Str8_View *source = nullptr;
+
+        if (token_is(&list, stage, Token_Kind::Ident, s_vertex_literal)) {
+            source = &vertex_source;
+        } else if (token_is(&list, stage, Token_Kind::Ident, s_fragment_literal)) {
+            source = &fragment_source;
+        } else {
+            continue;
+        }
+
+        assert(source->empty());
+
+        //
+        // NOTE(gr3yknigh1): Source of the stage is the text from the first token after `#begin <stage>` line up to
+        // the next `#begin` (or end of file). [2026/10/17]
+        //
+        SizeU first_index = token_index + 2;
+        while (first_index < list.count && list.tokens[first_index].kind == Token_Kind::Newline) {
+            ++first_index;
+        }
+
+        SizeU next_index = first_index;
+        while (next_index < list.count && !token_is(&list, list.tokens + next_index, Token_Kind::Directive, s_begin_directive)) {
+            ++next_index;
+        }
+
+        SizeU source_begin = first_index < list.count ? list.tokens[first_index].offset : file_size;
+        SizeU source_end = next_index < list.count ? list.tokens[next_index].offset : file_size;
+
+        *source = Str8_View(source_code + source_begin, source_end - source_begin);
+        token_index = next_index - 1;
+    }
+
+    assert(!vertex_source.empty() && !fragment_source.empty());
+
+    char *vertex_source_buffer = static_cast<char *>(mm::allocate(temp.arena, vertex_source.length + 1));
+    noc_memory_zero(vertex_source_buffer, vertex_source.length + 1);
+    assert(str8_view_copy_to_nullterminated(vertex_source, vertex_source_buffer, vertex_source.length + 1));
+    GLuint vertex_module_id = compile_shader_from_str8(vertex_source_buffer, Shader_Module_Type::Vertex);
+    assert(vertex_module_id);
+
+    char *fragment_source_buffer = static_cast<char *>(mm::allocate(temp.arena, fragment_source.length + 1));
+    noc_memory_zero(fragment_source_buffer, fragment_source.length + 1);
+
+    assert(str8_view_copy_to_nullterminated(fragment_source, fragment_source_buffer, fragment_source.length + 1));
+    GLuint fragment_module_id = compile_shader_from_str8(fragment_source_buffer, Shader_Module_Type::Fragment);
+    assert(fragment_module_id);
+
+    Shader_Compile_Result result{};
+    result.shader_program_id = link_shader_program(vertex_module_id, fragment_module_id);
+
+    return result;
+}
+
+bool
+asset_image_send_to_gpu(Asset_Store *store, Asset *asset, int unit, Shader *shader)
+{
+    assert(asset->type == Asset_Type::Texture);
+
+    asset->u.texture.unit = unit;
+    glActiveTexture(GL_TEXTURE0 + asset->u.texture.unit);
+    if (asset->u.texture.id) {
+        glDeleteTextures(1, &asset->u.texture.id);
+    }
+    glGenTextures(1, &asset->u.texture.id);
+    glBindTexture(GL_TEXTURE_2D, asset->u.texture.id);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_MIRRORED_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_MIRRORED_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    gl_make_texture_from_pixels(
+        asset->u.texture.pixels.data, asset->u.texture.width, asset->u.texture.height,
+        asset->u.texture.layout, GL_RGBA8);
+    glGenerateMipmap(GL_TEXTURE_2D);
+
+    // NOTE: After loading atlas in GPU, we do not need to keep it in RAM.
+    [[maybe_unused]] bool is_unloaded = asset_unload(store, asset);
+    assert(is_unloaded);
+
+    if (shader) {
+        glUniform1i(shader->texture_location, asset->u.texture.unit);
+    }
+
+    return true;
+}
@@ -0,0 +1,587 @@
+//!
+//! This is shared asset code: asset store, loaders for media files and their GPU-side counterparts.
+//!
+//! FILE          code\garden_assets.h
+//!
+//! AUTHORS
+//!               Ilya Akkuzin <gr3yknigh1@gmail.com>
+//!
+//! NOTICE        (c) Copyright 2025 by Ilya Akkuzin. All rights reserved.
+//!
+#pragma once
+
+#include <atomic>   // std::atomic_flag, std::atomic
+#include <thread>   // std::thread
+
+#include <stdio.h>  // FILE
+
+#include <glad/glad.h>
+
+#include <noc/noc.h>
+
+#include "garden_runtime.h"
+
+typedef unsigned int size32_t;
+
+//
+// Media:
+//
+
+enum struct Bitmap_Picture_Header_Type : Int32U {
+    BitmapCoreHeader = 12,
+    Os22XBitmapHeader_S = 16,
+    BitmapInfoHeader = 40,
+    BitmapV2InfoHeader = 52,
+    BitmapV3InfoHeader = 56,
+    Os22XBitmapHeader = 64,
+    BitmapV4Header = 108,
+    BitmapV5Header = 124,
+};
+
+enum struct Bitmap_Picture_Compression_Method : Int32U {
+    RGB = 0,
+    RLE8 = 1,
+    RLE4 = 2,
+    Bitfields = 3,
+    JPEG = 4,
+    PNG = 5,
+    AlphaBitfields = 6,
+    CMYK = 11,
+    CMYKRLE8 = 12,
+    CMYKRLE4 = 13,
+};
+
+#pragma pack(push, 1)
+struct Bitmap_Picture_DIB_Header {
+    Bitmap_Picture_Header_Type header_size;
+    Int32U width;
+    Int32U height;
+    Int16U planes_count;
+    Int16U depth;
+    Bitmap_Picture_Compression_Method compression_method;
+    Int32U image_size;
+    Int32U x_pixel_per_meter;
+    Int32U y_pixel_per_meter;
+    Int32U color_used;
+    Int32U color_important;
+};
+#pragma pack(pop)
+
+#pragma pack(push, 1)
+struct Bitmap_Picture_Header {
+    Int16U type;
+    Int32U file_size;
+    Int16U reserved[2];
+    Int32U data_offset;
+};
+#pragma pack(pop)
+
+#pragma pack(push, 1)
+struct Color_BGRA_U8 {
+    Int8U b, g, r, a;
+};
+#pragma pack(pop)
+
+#pragma pack(push, 1)
+struct Bitmap_Picture {
+    Bitmap_Picture_Header header;
+    Bitmap_Picture_DIB_Header dib_header;
+
+    union {
+        void *data;
+        Color_BGRA_U8 *bgra;
+    } u;
+};
+#pragma pack(pop)
+
+bool load_bitmap_picture_info_from_file(Bitmap_Picture *picture, FILE *file);
+bool load_bitmap_picture_pixel_data_from_file(Bitmap_Picture *picture, FILE *file);
+
+//!
+//! @brief Reads headers and points pixels into the `data`, without copying.
+//!
+bool load_bitmap_picture_from_buffer(Bitmap_Picture *picture, Byte *data, SizeU data_size);
+
+
+//
+// Media:
+//
+
+enum struct Color_Layout {
+    Nothing,
+    BGRA_U8,
+};
+
+
+//
+// @pre
+//   - Bind target texture with glBindTexture(GL_TEXTURE_2D, ...);
+//
+void gl_make_texture_from_pixels(void *pixels, size32_t width, size32_t height, Color_Layout layout, GLenum internal_format);
+
+//
+// Assets:
+//
+
+enum struct Asset_Type {
+    Texture,
+    Shader,
+    Tilemap,
+    Count_
+};
+
+enum struct Asset_Store_Place {
+    //!
+    //! @brief That indicates, that `Asset_Store` represented by some kind of folder. Probably usefull for development[2025/04/06]
+    //!
+    Folder,
+
+    //!
+    //! @brief That indicates, that `Asset_Store` located inside the single file. Probably usefull only on exports.
+    //!
+    Image,
+};
+
+//!
+//! @brief Single file with all assets (see `garden_tools pack`). Header is followed by table of contents (entries
+//! sorted by `path_hash`) and blob of paths. Payloads start at offsets aligned to `ASSET_ARCHIVE_ALIGNMENT` and are
+//! followed by at least one zero byte. All fields are little-endian.
+//!
+struct Asset_Archive_Header {
+    Int32U magic;   //!< `ASSET_ARCHIVE_MAGIC`
+    Int16U version; //!< `ASSET_ARCHIVE_VERSION`
+    Int16U reserved;
+
+    Int32U entries_count;
+    Int32U paths_size;
+
+    Int64U entries_offset;
+    Int64U paths_offset;
+};
+
+EXPECT_TYPE_SIZE(Asset_Archive_Header, 32);
+
+struct Asset_Archive_Entry {
+    //!
+    //! @brief Hash of path relative to packed folder, with `/` separators (see `asset_archive_hash_path`).
+    //!
+    Int64U path_hash;
+    Int64U content_hash;
+
+    Int64U offset;
+    Int64U size;
+
+    Int32U path_offset; //!< Into paths blob.
+    Int32U path_length;
+
+    Int32U type; //!< `Asset_Type`
+    Int32U reserved;
+};
+
+EXPECT_TYPE_SIZE(Asset_Archive_Entry, 48);
+
+constexpr Int32U ASSET_ARCHIVE_MAGIC = 0x4B415047; // "GPAK"
+constexpr Int16U ASSET_ARCHIVE_VERSION = 1;
+constexpr SizeU  ASSET_ARCHIVE_ALIGNMENT = 4096;
+
+//!
+//! @brief Mapped archive.
+//!
+struct Asset_Archive {
+    Byte *data;
+    SizeU size;
+
+    const Asset_Archive_Entry *entries;
+    Int32U entries_count;
+
+    const char *paths;
+};
+
+//!
+//! @brief Hash of the path as archive stores it: backslashes are hashed as `/`.
+//!
+Int64U asset_archive_hash_path(Str8_View path);
+
+//!
+//! @brief Looks up entry by path. Leading folders, which are not in the archive, are skipped, so absolute paths (like
+//! ones written in tilemaps) resolve to the archive entries too.
+//!
+const Asset_Archive_Entry *asset_archive_find(const Asset_Archive *archive, Str8_View path);
+
+Str8_View asset_archive_get_path(const Asset_Archive *archive, const Asset_Archive_Entry *entry);
+
+//!
+//! @brief Result of CPU stage, which worker reports to main thread. Workers don't touch `Asset::state`.
+//!
+struct Asset_Completion {
+    Asset *asset;
+    bool is_read; //!< False if CPU stage failed, then asset is marked as `LoadFailure`.
+};
+
+struct Asset_Store {
+    static constexpr Int16U max_asset_count = 1024;
+
+    //!
+    //! @brief Power of two and twice as big as `max_asset_count`, so linear probing in `path_index` stays short.
+    //!
+    static constexpr Int32U path_index_capacity = 2 * max_asset_count;
+
+    //!
+    //! @brief Slot map of assets. Slots never move, so `Asset *` stays valid until the asset is released, but only
+    //! `Asset_Handle` tells whether it was (see `asset_store_get`). Released slots are reused first, so `slots_count`
+    //! (slots ever taken) stays as low as possible.
+    //!
+    Asset *assets;
+    Int16U *generations;
+    Int32U slots_count;
+
+    Int16U *free_slots;
+    Int32U free_count;
+
+    //!
+    //! @brief Dense array of taken slots, so iteration over live assets (see `FOR_EACH_ASSET`) is a linear walk.
+    //! `live_positions` maps slot to it's position in `live_slots` for swap-removal.
+    //!
+    Int16U *live_slots;
+    Int16U *live_positions;
+    Int32U live_count;
+
+    //!
+    //! @brief Open addressing table: hash of file path -> asset. Handles of released assets are left as tombstones,
+    //! which are reused by insertion.
+    //!
+    Asset_Handle *path_index;
+
+    //!
+    //! @brief Ring of assets, which should be reloaded. Single producer (watcher thread), single consumer (main
+    //! thread). Asset is pushed only when it's `should_reload` flag gets set, so ring has no duplicates and can't
+    //! overflow.
+    //!
+    Asset_Handle *dirty_assets;
+    std::atomic<Int64U> dirty_assets_head;
+    std::atomic<Int64U> dirty_assets_tail;
+
+    //!
+    //! @brief Guards slot map and `path_index`, since watcher thread looks up paths, while main thread loads and
+    //! releases assets.
+    //!
+    std::atomic_flag content_lock;
+
+    //
+    // Async loading (see `asset_load_async`):
+    //
+
+    static constexpr Int32U max_workers_count = 4;
+
+    std::thread workers[max_workers_count];
+    Int32U workers_count;
+
+    std::atomic<bool> is_stopping;
+
+    //!
+    //! @brief Ring of assets waiting for the CPU stage. Asset is queued only while it's not `Loading`, so ring can't
+    //! overflow. Guarded by `jobs_lock`, workers sleep on `jobs_signal`.
+    //!
+    Asset **jobs;
+    Int64U jobs_head;
+    Int64U jobs_tail;
+    std::atomic_flag jobs_lock;
+    std::atomic<Int32U> jobs_signal;
+
+    //!
+    //! @brief Ring of assets, which CPU stage is done. Drained by main thread (see `asset_store_pop_completed`). Asset
+    //! is here only once per load, so ring can't overflow either.
+    //!
+    Asset_Completion *completed_assets;
+    Int64U completed_head;
+    Int64U completed_tail;
+    std::atomic_flag completed_lock;
+
+    //!
+    //! @brief Count of assets, which are queued or being read by workers.
+    //!
+    std::atomic<Int32U> loading_count;
+
+    //!
+    //! @brief Worker takes up to this much queued assets at once, so their files are read with single batch (see
+    //! `noc_io_read_files`).
+    //!
+    static constexpr Int32U max_batch_count = 64;
+
+    // TODO(gr3yknigh1): Support for utf-8 or wide paths? [2025/03/06]
+
+    Asset_Store_Place place;
+
+    union {
+        const char *folder;
+        Asset_Archive image;
+    } u;
+};
+
+static_assert(Asset_Store::max_asset_count <= (1 << SPRITE_SORT_KEY_SLOT_BITS), "Slot index should fit into sprite sort key");
+
+#if !defined(FOR_EACH_ASSET)
+    //!
+    //! @note Main thread only, while nothing is loading (workers take slots for tilemap textures). Don't release
+    //! assets while iterating.
+    //!
+    #define FOR_EACH_ASSET(IT, ASSET_STORE_PTR) \
+        for (Int32U IT##_index = 0; IT##_index < (ASSET_STORE_PTR)->live_count; ++IT##_index) \
+            if (Asset *IT = (ASSET_STORE_PTR)->assets + (ASSET_STORE_PTR)->live_slots[IT##_index]; true)
+#endif
+
+struct Reload_Context {
+    Asset_Store *store;
+
+    //
+    // NOTE(gr3yknigh1): Found no place for this. Think about it later, if it becomes a problem [2025/03/10]
+    //
+    std::atomic_flag should_reload_gameplay;
+};
+
+enum struct Asset_Location_Type {
+    None,
+    File,
+    Buffer,
+};
+
+struct File_Info {
+    FILE *handle;
+    SizeU size;
+    Str8 path;
+    Int64U path_hash;
+
+    ~File_Info(void) noexcept {}
+};
+
+struct Asset_Location {
+    Asset_Location_Type type;
+
+    union Location_Union {
+        File_Info file;
+        mm::Buffer_View buffer_view;
+
+        ~Location_Union(void) noexcept {}
+    } u;
+
+    ~Asset_Location(void) noexcept {}
+};
+
+
+bool make_asset_store_from_folder(Asset_Store *store, const char *folder_path);
+
+//!
+//! @brief Maps the archive once. Assets of this store are `Asset_Location_Type::Buffer` views into the mapping, their
+//! content isn't copied where loaders allow it (pixels, tilemap indexes).
+//!
+bool make_asset_store_from_image(Asset_Store *store, const char *image_path);
+bool asset_store_destroy(Asset_Store *store);
+
+//!
+//! @return Nullptr if handle is null or stale.
+//!
+Asset *asset_store_get(Asset_Store *store, Asset_Handle handle);
+Asset_Handle asset_store_get_handle(Asset_Store *store, const Asset *asset);
+
+//!
+//! @brief Looks up asset loaded from the file. If file was loaded several times, returns the latest asset. Safe to
+//! call from watcher thread.
+//!
+Asset_Handle asset_store_find(Asset_Store *store, Str8_View file_path);
+
+//!
+//! @brief Sets `should_reload` flag of the asset and pushes it in the dirty list. Call only from watcher thread.
+//!
+//! @return False if asset was already in the dirty list or handle is stale.
+//!
+bool asset_store_mark_dirty(Asset_Store *store, Asset_Handle handle);
+
+//!
+//! @brief Pops next asset from the dirty list and clears it's `should_reload` flag. Assets, which were released since
+//! they got in the list, are skipped. Call only from main thread.
+//!
+//! @return Nullptr if there is nothing to reload.
+//!
+Asset *asset_store_pop_dirty(Asset_Store *store);
+
+struct Texture {
+    int width;
+    int height;
+    Color_Layout layout;
+
+    GLuint unit;
+    GLuint id;
+
+    union {
+        void *data;
+        Color_BGRA_U8 *bgra_u8;
+    } pixels;
+};
+
+enum struct Asset_State {
+    NotLoaded,
+    Loading, //!< Queued or being read by worker (see `asset_load_async`).
+    LoadFailure,
+    Loaded,
+    UnloadFailure,
+    Unloaded
+};
+
+
+enum struct Shader_Module_Type {
+    Vertex,
+    Fragment,
+
+    Count_
+};
+
+struct Shader_Module {
+    GLuint id;
+};
+
+struct Shader {
+    GLuint program_id;
+    char *source_code;
+    SizeU source_code_size;
+
+    Shader_Module modules[static_cast<SizeU>(Shader_Module_Type::Count_)];
+
+    //
+    // NOTE(gr3yknigh1): Uniforms, which runtime sets, are looked up once after program is linked. [2026/10/17]
+    //
+    GLint model_location;
+    GLint projection_location;
+    GLint texture_location;
+};
+
+//
+// OpenGL API wrappers
+//
+GLuint compile_shader_from_str8(const char *string, Shader_Module_Type type);
+GLuint link_shader_program(GLuint vertex_shader, GLuint fragment_shader);
+
+struct Asset {
+    Asset_Type type;
+    Asset_Location location;
+    Asset_State state;
+
+    std::atomic_flag should_reload;
+
+    //!
+    //! @brief Allocated file content (textures and shaders), which `u` points into. Each asset has it's own allocation,
+    //! so content is released on unload independently. Empty for archive assets, they borrow content from the mapping.
+    //!
+    mm::Buffer_View content;
+
+    union {
+        Texture texture;
+        Shader shader;
+        Tilemap tilemap;
+    } u;
+
+    ~Asset(void) noexcept {}
+};
+
+Asset_Handle asset_load(Asset_Store *store, Asset_Type type, const Str8_View file_path);
+
+//!
+//! @brief Queues asset for loading on worker threads and returns it right away in `Asset_State::Loading`. File I/O and
+//! decoding happen on workers, main thread stage (shader compilation, tilemap texture) is done by
+//! `asset_store_pop_completed`.
+//!
+Asset_Handle asset_load_async(Asset_Store *store, Asset_Type type, const Str8_View file_path);
+
+//!
+//! @brief Unloads asset and queues it like `asset_load_async`. Returns false if asset is still loading.
+//!
+bool asset_reload_async(Asset_Store *store, Asset *asset);
+
+//!
+//! @brief Finishes loading of the next asset, which workers are done with. Call only from main thread. Returned asset
+//! is `Loaded` or `LoadFailure`, textures still have to be sent to GPU by the caller. Nullptr if there are none.
+//!
+Asset *asset_store_pop_completed(Asset_Store *store);
+
+//!
+//! @brief Blocks until workers are done with all queued assets. They still have to be popped.
+//!
+void asset_store_wait_loading(Asset_Store *store);
+
+//!
+//! @brief Unloads the asset, frees it's GPU objects and gives the slot back to the store. Handle (and any copy of it)
+//! becomes stale. Asset shouldn't be `Loading`. Call only from main thread.
+//!
+//! @return False if handle is already stale.
+//!
+bool asset_release(Asset_Store *store, Asset_Handle handle);
+
+// helper
+//!
+//! @brief Reads `@tilemap` header and tile indexes. Errors are printed with location in the source.
+//!
+//! @param image_path Receives path of tilemap image. Points into the `buffer`.
+//!
+bool parse_tilemap(const char *buffer, SizeU buffer_size, Tilemap *tilemap, Str8_View *image_path);
+bool load_tilemap_from_buffer(char *buffer, SizeU buffer_size, Tilemap *tilemap);
+
+//!
+//! @brief Binary tilemap (see `save_tilemap_binary`). Header is followed by image path, index array starts at
+//! `indexes_offset`, which is aligned to `TILEMAP_BINARY_ALIGNMENT`. So when file is mapped, indexes are used in place.
+//! All fields are little-endian.
+//!
+struct Tilemap_Binary_Header {
+    Int32U magic;      //!< `TILEMAP_BINARY_MAGIC`, text tilemaps never start with it.
+    Int16U version;    //!< `TILEMAP_BINARY_VERSION`
+    Int16U index_size; //!< 4 for `Int32S` indexes, 2 for `Int16U` ones.
+
+    Int32S row_count;
+    Int32S col_count;
+    Int32S tile_x_pixel_count;
+    Int32S tile_y_pixel_count;
+
+    Int32U image_path_offset;
+    Int32U image_path_length;
+
+    Int64U indexes_offset;
+    Int64U indexes_count;
+};
+
+EXPECT_TYPE_SIZE(Tilemap_Binary_Header, 48);
+
+constexpr Int32U TILEMAP_BINARY_MAGIC = 0x424D5447; // "GTMB"
+constexpr Int16U TILEMAP_BINARY_VERSION = 1;
+constexpr SizeU  TILEMAP_BINARY_ALIGNMENT = 4096;
+
+//!
+//! @brief Validates header and points `tilemap->indexes` into the `data` (`Int32S` indexes) or widens them into
+//! allocated array (`Int16U` indexes).
+//!
+//! @param image_path Receives path of tilemap image. Points into the `data`.
+//!
+bool parse_tilemap_binary(Byte *data, SizeU data_size, Tilemap *tilemap, Str8_View *image_path);
+
+//!
+//! @param index_size 4 or 2. Latter is allowed only if every index fits into `Int16U`.
+//!
+bool save_tilemap_binary(const Tilemap *tilemap, Str8_View image_path, Int16U index_size, FILE *file);
+
+//!
+//! @brief Maps the file and picks format by magic. Indexes of binary tilemaps are copied as is (no parsing), text ones
+//! are parsed right from the mapping. Mapping is released before return, so file can be rewritten while the game
+//! runs. Texture isn't loaded, only its path is kept (see `Tilemap::texture_path`).
+//!
+bool load_tilemap_from_file(const char *file_path, Tilemap *tilemap);
+bool asset_image_send_to_gpu(Asset_Store *store, Asset *asset, int unit, Shader *shader);
+
+bool shader_bind(Shader *shader);
+
+bool asset_from_bitmap_picture(Asset *asset, Bitmap_Picture *picture);
+
+bool asset_reload(Asset_Store *store, Asset *asset);
+bool asset_unload(Asset_Store *store, Asset *asset);
+
+struct Shader_Compile_Result {
+    GLuint shader_program_id;
+};
+
+Shader_Compile_Result compile_shader(char *source_code, SizeU file_size);
@@ -0,0 +1,1267 @@
+//!
+//! This is micro-benchmarks of the runtime code.
+//!
+//! Built as separate executable from the same unity build (like gameplay module), but with `GARDEN_BENCHMARK_CODE=1`.
+//! Run without arguments to execute all benchmarks, or pass names of benchmarks to run only them.
+//!
+//! FILE          code\garden_benchmark.cpp
+//!
+//! AUTHORS
+//!               Ilya Akkuzin <gr3yknigh1@gmail.com>
+//!
+//! NOTICE        (c) Copyright 2025 by Ilya Akkuzin. All rights reserved.
+//!
+#include <assert.h> // assert
+#include <stdio.h>  // printf
+#include <stdlib.h> // qsort
+
+#include <chrono> // std::chrono::milliseconds
+#include <thread>
+
+#include <noc/noc.h>
+
+#include "garden_runtime.h"
+
+typedef void (* benchmark_routine_t)(void);
+
+struct Benchmark {
+    const char *name;
+    benchmark_routine_t routine;
+};
+
+static Float64
+benchmark_counter_to_ms(Int64S counter)
+{
+    return static_cast<Float64>(counter) * 1000.0 / static_cast<Float64>(perf_get_counter_frequency());
+}
+
+static Float64
+benchmark_counter_to_ns(Int64S counter)
+{
+    return static_cast<Float64>(counter) * 1000.0 * 1000.0 * 1000.0 / static_cast<Float64>(perf_get_counter_frequency());
+}
+
+//
+// Block allocator:
+//
+
+//!
+//! @brief Fills allocator with one allocation of `allocation_size` per block, then iterates and resets all blocks.
+//! If allocation doesn't divide the block, rest of the block is too small for the next one.
+//!
+static void
+benchmark_block_allocator_run(Int64U blocks_count, SizeU block_size, SizeU allocation_size, bool is_fixed)
+{
+    mm::Block_Allocator allocator = is_fixed
+        ? mm::make_block_allocator(blocks_count, block_size, block_size, blocks_count)
+        : mm::make_block_allocator(blocks_count, block_size);
+
+    Int64S fill_begin = perf_get_counter();
+    for (Int64U block_index = 0; block_index < blocks_count; ++block_index) {
+        [[maybe_unused]] void *data = mm::allocate(&allocator, allocation_size);
+        assert(data);
+    }
+    Int64S fill_counter = perf_get_counter() - fill_begin;
+
+    Int64U visited_count = 0;
+
+    Int64S iterate_begin = perf_get_counter();
+    for (void *it = mm::first(&allocator); it != nullptr; it = mm::next(&allocator, it)) {
+        ++visited_count;
+    }
+    Int64S iterate_counter = perf_get_counter() - iterate_begin;
+
+    Int64S reset_begin = perf_get_counter();
+    for (void *it = mm::first(&allocator); it != nullptr; it = mm::next(&allocator, it)) {
+        [[maybe_unused]] bool is_reset = mm::reset(&allocator, it);
+        assert(is_reset);
+    }
+    Int64S reset_counter = perf_get_counter() - reset_begin;
+
+    printf(
+        "PERF: [block_allocator/%s] blocks = (%lu) size = (%zu/%zu) fill = (%.3f ms) iterate = (%.3f ms, %.2f ns/block, %lu visited) reset = (%.3f ms, %.2f ns/block)\n",
+        is_fixed ? "fixed" : "variable", blocks_count, allocation_size, block_size, benchmark_counter_to_ms(fill_counter),
+        benchmark_counter_to_ms(iterate_counter), benchmark_counter_to_ns(iterate_counter) / blocks_count, visited_count,
+        benchmark_counter_to_ms(reset_counter), benchmark_counter_to_ns(reset_counter) / blocks_count);
+
+    if (visited_count != blocks_count || allocator.blocks.count != blocks_count) {
+        printf(
+            "E: [block_allocator/%s] Visited (%lu) of (%lu) blocks, but (%lu) were filled!\n", is_fixed ? "fixed" : "variable",
+            visited_count, allocator.blocks.count, blocks_count);
+    }
+
+    [[maybe_unused]] bool is_destroyed = mm::destroy_block_allocator(&allocator);
+    assert(is_destroyed);
+}
+
+//!
+//! @brief Only first allocation in variable-size block has owner. Memory before others is payload of previous
+//! allocation, so it must not be taken for block header.
+//!
+static void
+benchmark_block_allocator_check_owner(void)
+{
+    mm::Block_Allocator allocator = mm::make_block_allocator(1, 64);
+
+    void *first_data = mm::allocate(&allocator, 16);
+    void *second_data = mm::allocate(&allocator, 16);
+
+    [[maybe_unused]] bool is_owner_found = mm::get_owner_block(&allocator, first_data) != nullptr &&
+                                           mm::get_owner_block(&allocator, second_data) == nullptr &&
+                                           !mm::reset(&allocator, second_data);
+    assert(is_owner_found);
+
+    [[maybe_unused]] bool is_destroyed = mm::destroy_block_allocator(&allocator);
+    assert(is_destroyed);
+}
+
+static void
+benchmark_block_allocator(void)
+{
+    Int64U blocks_counts[] = { 1000, 10000, 100000 };
+
+    for (SizeU count_index = 0; count_index < STATIC_ARRAY_COUNT(blocks_counts); ++count_index) {
+        benchmark_block_allocator_run(blocks_counts[count_index], 64, 64, true);
+    }
+
+    for (SizeU count_index = 0; count_index < STATIC_ARRAY_COUNT(blocks_counts); ++count_index) {
+        benchmark_block_allocator_run(blocks_counts[count_index], 64, 64, false);
+    }
+
+    // NOTE(gr3yknigh1): Allocations, which don't divide the block, leave blocks not full. [2026/10/17]
+    for (SizeU count_index = 0; count_index < STATIC_ARRAY_COUNT(blocks_counts); ++count_index) {
+        benchmark_block_allocator_run(blocks_counts[count_index], 4096, 3000, false);
+    }
+
+    benchmark_block_allocator_check_owner();
+}
+
+//
+// Pool allocator:
+//
+
+typedef void *(* benchmark_allocate_t)(SizeU size);
+typedef void (* benchmark_deallocate_t)(void *data);
+
+static void *
+benchmark_pool_allocate(SizeU size)
+{
+    return mm::allocate(size);
+}
+
+static void
+benchmark_pool_deallocate(void *data)
+{
+    mm::deallocate(data);
+}
+
+static void *
+benchmark_libc_allocate(SizeU size)
+{
+    return noc_allocate(size);
+}
+
+static void
+benchmark_libc_deallocate(void *data)
+{
+    noc_free(data);
+}
+
+//!
+//! @brief Keeps window of live small allocations and replaces them in round robin, like strings and list nodes do.
+//!
+static void
+benchmark_small_objects_churn(benchmark_allocate_t allocate_routine, benchmark_deallocate_t deallocate_routine, Int64U operations_count)
+{
+    constexpr SizeU window_size = 256;
+    void *window[window_size] = {};
+
+    Int64U seed = 0x9E3779B97F4A7C15ULL;
+
+    for (Int64U operation_index = 0; operation_index < operations_count; ++operation_index) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        SizeU slot = operation_index % window_size;
+        if (window[slot] != nullptr) {
+            deallocate_routine(window[slot]);
+        }
+
+        window[slot] = allocate_routine(16 + seed % 240);
+    }
+
+    for (SizeU slot = 0; slot < window_size; ++slot) {
+        if (window[slot] != nullptr) {
+            deallocate_routine(window[slot]);
+        }
+    }
+}
+
+static void
+benchmark_pool_allocator_run(const char *name, benchmark_allocate_t allocate_routine, benchmark_deallocate_t deallocate_routine, Int64U threads_count)
+{
+    constexpr Int64U operations_count = 1000000;
+
+    Int64S begin = perf_get_counter();
+
+    std::thread threads[8];
+    assert(threads_count <= STATIC_ARRAY_COUNT(threads));
+
+    for (Int64U thread_index = 0; thread_index < threads_count; ++thread_index) {
+        threads[thread_index] = std::thread([=]() {
+            benchmark_small_objects_churn(allocate_routine, deallocate_routine, operations_count);
+            mm::pool_flush_thread_cache();
+        });
+    }
+
+    for (Int64U thread_index = 0; thread_index < threads_count; ++thread_index) {
+        threads[thread_index].join();
+    }
+
+    Int64S counter = perf_get_counter() - begin;
+
+    printf("PERF: [pool_allocator/%s] threads = (%lu) operations = (%lu) time = (%.3f ms, %.2f ns/operation)\n",
+        name, threads_count, operations_count * threads_count, benchmark_counter_to_ms(counter),
+        benchmark_counter_to_ns(counter) / operations_count);
+}
+
+static void
+benchmark_pool_allocator(void)
+{
+    Int64U threads_counts[] = { 1, 4 };
+
+    for (SizeU count_index = 0; count_index < STATIC_ARRAY_COUNT(threads_counts); ++count_index) {
+        benchmark_pool_allocator_run("pool", benchmark_pool_allocate, benchmark_pool_deallocate, threads_counts[count_index]);
+        benchmark_pool_allocator_run("libc", benchmark_libc_allocate, benchmark_libc_deallocate, threads_counts[count_index]);
+    }
+}
+
+//
+// String comparison:
+//
+
+//
+// NOTE(gr3yknigh1): Reference is the scalar loop, which was used by `str*_is_equals` before vectorization. [2026/10/17]
+//
+static bool
+benchmark_str16_is_equals_scalar(Str16_View a, Str8_View b)
+{
+    if (a.length != b.length) {
+        return false;
+    }
+
+    for (size_t i = 0; i < a.length; ++i) {
+        if (static_cast<Int32U>(a.data[i]) != static_cast<Byte>(b.data[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool
+benchmark_str8_is_equals_scalar(Str8_View a, Str8_View b)
+{
+    if (a.length != b.length) {
+        return false;
+    }
+
+    for (size_t i = 0; i < a.length; ++i) {
+        if (a.data[i] != b.data[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool
+benchmark_str16_is_equals_simd(Str16_View a, Str8_View b)
+{
+    return str16_view_is_equals(a, b);
+}
+
+static bool
+benchmark_str8_is_equals_simd(Str8_View a, Str8_View b)
+{
+    return str8_view_is_equals(a, b);
+}
+
+// NOTE(gr3yknigh1): Called through volatile pointers, otherwise compiler hoists comparisons out of the loop. [2026/10/17]
+static bool (*volatile benchmark_str16_is_equals_routines[])(Str16_View, Str8_View) = {
+    benchmark_str16_is_equals_scalar, benchmark_str16_is_equals_simd,
+};
+
+static bool (*volatile benchmark_str8_is_equals_routines[])(Str8_View, Str8_View) = {
+    benchmark_str8_is_equals_scalar, benchmark_str8_is_equals_simd,
+};
+
+static size_t (*volatile benchmark_str8_get_length_routine)(const char *) = str8_get_length;
+
+//!
+//! @brief Like `asset_watch_routine`, looks up path of changed file in table of asset paths. Paths in table have the
+//! same length and prefix, so each comparison goes through the whole string.
+//!
+static void
+benchmark_str_compare_run(const char *name, SizeU path_length)
+{
+    constexpr SizeU paths_count = 64;
+    constexpr Int64U lookups_count = 20000;
+
+    static char paths[paths_count][512];
+    static wchar_t changed_path[512];
+    assert(path_length + 1 < STATIC_ARRAY_COUNT(changed_path));
+
+    for (SizeU path_index = 0; path_index < paths_count; ++path_index) {
+        for (SizeU index = 0; index < path_length; ++index) {
+            paths[path_index][index] = static_cast<char>('a' + index % 26);
+        }
+        paths[path_index][path_length - 1] = static_cast<char>('0' + path_index % 10);
+        paths[path_index][path_length - 2] = static_cast<char>('0' + path_index / 10);
+        paths[path_index][path_length] = 0;
+    }
+
+    for (SizeU index = 0; index <= path_length; ++index) {
+        changed_path[index] = static_cast<wchar_t>(paths[paths_count - 1][index]);
+    }
+
+    Str16_View changed_view(changed_path);
+    assert(changed_view.length == path_length);
+
+    Int64U found_count = 0;
+
+    Int64S counters[5] = {};
+
+    for (SizeU routine_index = 0; routine_index < 2; ++routine_index) {
+        Int64S begin = perf_get_counter();
+        for (Int64U lookup_index = 0; lookup_index < lookups_count; ++lookup_index) {
+            for (SizeU path_index = 0; path_index < paths_count; ++path_index) {
+                found_count += benchmark_str16_is_equals_routines[routine_index](changed_view, Str8_View(paths[path_index], path_length));
+            }
+        }
+        counters[routine_index] = perf_get_counter() - begin;
+    }
+
+    for (SizeU routine_index = 0; routine_index < 2; ++routine_index) {
+        Int64S begin = perf_get_counter();
+        for (Int64U lookup_index = 0; lookup_index < lookups_count; ++lookup_index) {
+            for (SizeU path_index = 0; path_index < paths_count; ++path_index) {
+                found_count += benchmark_str8_is_equals_routines[routine_index](Str8_View(paths[paths_count - 1], path_length), Str8_View(paths[path_index], path_length));
+            }
+        }
+        counters[2 + routine_index] = perf_get_counter() - begin;
+    }
+
+    Int64S length_begin = perf_get_counter();
+    for (Int64U lookup_index = 0; lookup_index < lookups_count; ++lookup_index) {
+        for (SizeU path_index = 0; path_index < paths_count; ++path_index) {
+            found_count += benchmark_str8_get_length_routine(paths[path_index]) == path_length;
+        }
+    }
+    counters[4] = perf_get_counter() - length_begin;
+
+    assert(found_count == lookups_count * 2 + lookups_count * 2 + lookups_count * paths_count);
+
+    constexpr Int64U comparisons_count = lookups_count * paths_count;
+
+    printf(
+        "PERF: [str_compare/%s] length = (%lu) str16_vs_str8 = (scalar %.2f ns, simd %.2f ns) str8 = (scalar %.2f ns, simd %.2f ns) str8_length = (%.2f ns)\n",
+        name, path_length,
+        benchmark_counter_to_ns(counters[0]) / comparisons_count, benchmark_counter_to_ns(counters[1]) / comparisons_count,
+        benchmark_counter_to_ns(counters[2]) / comparisons_count, benchmark_counter_to_ns(counters[3]) / comparisons_count,
+        benchmark_counter_to_ns(counters[4]) / comparisons_count);
+}
+
+static void
+benchmark_str_compare(void)
+{
+    benchmark_str_compare_run("short", 24);
+    benchmark_str_compare_run("long", 220);
+}
+
+//
+// Tilemap parsing:
+//
+
+//!
+//! @brief Reference parser, which calls lexer for each character (like `load_tilemap_from_buffer` did before
+//! tokenizer). Only tile indexes are parsed, header is expected to be on the first line.
+//!
+//! @return Count of parsed indexes, at most `indexes_count`.
+//!
+static SizeU
+benchmark_tilemap_parse_with_lexer(char *buffer, SizeU buffer_size, int *indexes, SizeU indexes_count)
+{
+    Lexer lexer = make_lexer(buffer, buffer_size);
+    lexer_skip_until_endline(&lexer);
+
+    SizeU filled_count = 0;
+
+    while (!lexer_is_end(&lexer) && filled_count < indexes_count) {
+        lexer_skip_whitespace(&lexer);
+
+        if (isdigit(lexer.lexeme)) {
+            lexer_parse_int(&lexer, indexes + filled_count++);
+            continue;
+        }
+
+        lexer_advance(&lexer);
+    }
+
+    return filled_count;
+}
+
+//!
+//! @brief Text tilemap with pseudo-random indexes in `[0, index_limit)`. Free with `mm::deallocate`.
+//!
+static char *
+benchmark_generate_tilemap(Int32S side_count, Int32U index_limit, SizeU *size)
+{
+    SizeU indexes_count = static_cast<SizeU>(side_count) * static_cast<SizeU>(side_count);
+
+    SizeU buffer_capacity = indexes_count * 11 + 256;
+    char *buffer = static_cast<char *>(mm::allocate(buffer_capacity));
+    assert(buffer);
+
+    SizeU buffer_size = static_cast<SizeU>(sprintf(buffer, "@tilemap %d %d \"demo-tilemap.bmp\" bmp 16 16\n", side_count, side_count));
+
+    Int64U seed = 0x9E3779B97F4A7C15ULL;
+    for (Int32S row_index = 0; row_index < side_count; ++row_index) {
+        for (Int32S col_index = 0; col_index < side_count; ++col_index) {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+
+            char digits[10];
+            SizeU digits_count = 0;
+
+            Int32U index = static_cast<Int32U>(seed % index_limit);
+            do {
+                digits[digits_count++] = static_cast<char>('0' + index % 10);
+                index /= 10;
+            } while (index);
+
+            while (digits_count) {
+                buffer[buffer_size++] = digits[--digits_count];
+            }
+            buffer[buffer_size++] = col_index + 1 < side_count ? ' ' : '\n';
+        }
+    }
+    buffer[buffer_size] = 0;
+
+    *size = buffer_size;
+    return buffer;
+}
+
+static void
+benchmark_tilemap_parse_run(Int32S side_count, Int32U index_limit)
+{
+    SizeU indexes_count = static_cast<SizeU>(side_count) * static_cast<SizeU>(side_count);
+
+    SizeU buffer_size = 0;
+    char *buffer = benchmark_generate_tilemap(side_count, index_limit, &buffer_size);
+
+    int *reference_indexes = mm::allocate_structs<int>(indexes_count);
+
+    Int64S lexer_begin = perf_get_counter();
+    [[maybe_unused]] SizeU reference_count = benchmark_tilemap_parse_with_lexer(buffer, buffer_size, reference_indexes, indexes_count);
+    Int64S lexer_counter = perf_get_counter() - lexer_begin;
+
+    assert(reference_count == indexes_count);
+
+    SizeU tokens_count = 0;
+    Int64S tokenize_counter = 0;
+    {
+        mm::Temp_Scope temp(mm::get_scratch_arena());
+
+        Int64S tokenize_begin = perf_get_counter();
+        Token_List tokens = tokenize(temp.arena, buffer, buffer_size);
+        tokenize_counter = perf_get_counter() - tokenize_begin;
+
+        tokens_count = tokens.count;
+    }
+
+    Tilemap tilemap{};
+    Str8_View image_path{};
+
+    Int64S parse_begin = perf_get_counter();
+    [[maybe_unused]] bool is_parsed = parse_tilemap(buffer, buffer_size, &tilemap, &image_path);
+    Int64S parse_counter = perf_get_counter() - parse_begin;
+
+    assert(is_parsed);
+    assert(tilemap.indexes_count == indexes_count);
+    assert(noc_memory_is_equals(tilemap.indexes, reference_indexes, indexes_count * sizeof(*reference_indexes)));
+    assert(str8_view_is_equals(image_path, "demo-tilemap.bmp"));
+
+    // NOTE(gr3yknigh1): Errors of bulk parser, one value less than buffer has and one value with lower limit. [2026/10/17]
+    Uint_List_Parse_Result result = parse_uint_list(buffer, buffer_size, reinterpret_cast<Int32U *>(tilemap.indexes), 0, INT32_MAX);
+    assert(result.status == Parse_Status::Unexpected_Character && result.error_offset == 0);
+
+    const char *indexes_text = static_cast<const char *>(noc_memory_find(buffer, buffer_size, '\n')) + 1;
+    SizeU indexes_text_size = buffer_size - static_cast<SizeU>(indexes_text - buffer);
+
+    result = parse_uint_list(indexes_text, indexes_text_size, reinterpret_cast<Int32U *>(tilemap.indexes), indexes_count - 1, INT32_MAX);
+    assert(result.status == Parse_Status::Too_Many_Values && result.count == indexes_count - 1);
+
+    result = parse_uint_list(indexes_text, indexes_text_size, reinterpret_cast<Int32U *>(tilemap.indexes), indexes_count + 1, INT32_MAX);
+    assert(result.status == Parse_Status::Too_Few_Values && result.count == indexes_count);
+
+    result = parse_uint_list(indexes_text, indexes_text_size, reinterpret_cast<Int32U *>(tilemap.indexes), indexes_count, index_limit - 2);
+    assert(result.status == Parse_Status::Overflow);
+
+    printf(
+        "PERF: [tilemap_parse] size = (%dx%d, %.2f MiB) lexer = (%.3f ms) tokenize = (%.3f ms, %lu tokens) parse = (%.3f ms, %.2f GiB/s, %.1fx lexer)\n",
+        side_count, side_count, static_cast<Float64>(buffer_size) / MEGABYTES(1), benchmark_counter_to_ms(lexer_counter),
+        benchmark_counter_to_ms(tokenize_counter), tokens_count, benchmark_counter_to_ms(parse_counter),
+        static_cast<Float64>(buffer_size) / GIGABYTES(1) / (benchmark_counter_to_ms(parse_counter) / 1000.0),
+        static_cast<Float64>(lexer_counter) / static_cast<Float64>(parse_counter));
+
+    mm::deallocate(tilemap.indexes);
+    mm::deallocate(reference_indexes);
+    mm::deallocate(buffer);
+}
+
+static void
+benchmark_tilemap_parse(void)
+{
+    benchmark_tilemap_parse_run(256, 12);
+    benchmark_tilemap_parse_run(2048, 12);
+    benchmark_tilemap_parse_run(2048, 100000);
+    benchmark_tilemap_parse_run(4096, 4096);
+}
+
+//
+// Tilemap loading:
+//
+
+static void
+benchmark_tilemap_load_run(Int32S side_count)
+{
+    static constexpr const char *s_text_path = "garden_benchmark_tilemap.tp";
+    static constexpr const char *s_binary_path = "garden_benchmark_tilemap.tpb";
+
+    SizeU text_size = 0;
+    char *text = benchmark_generate_tilemap(side_count, side_count, &text_size);
+
+    FILE *text_file = fopen(s_text_path, "wb");
+    assert(text_file);
+    fwrite(text, text_size, 1, text_file);
+    fclose(text_file);
+
+    Tilemap source{};
+    Str8_View source_image_path{};
+    [[maybe_unused]] bool is_parsed = parse_tilemap(text, text_size, &source, &source_image_path);
+    assert(is_parsed);
+
+    FILE *binary_file = fopen(s_binary_path, "wb");
+    assert(binary_file);
+    [[maybe_unused]] bool is_saved = save_tilemap_binary(&source, source_image_path, sizeof(Int32S), binary_file);
+    assert(is_saved);
+    fclose(binary_file);
+
+    //
+    // NOTE(gr3yknigh1): Loaders without texture (it needs GL context). Files are likely in page cache, so it's
+    // mapping and parsing cost only. [2026/10/17]
+    //
+    Int64S text_begin = perf_get_counter();
+
+    SizeU mapped_text_size = 0;
+    char *mapped_text = static_cast<char *>(noc_native_map_file(s_text_path, &mapped_text_size));
+    assert(mapped_text && mapped_text_size == text_size);
+
+    Tilemap text_tilemap{};
+    Str8_View image_path{};
+    is_parsed = parse_tilemap(mapped_text, mapped_text_size, &text_tilemap, &image_path);
+    assert(is_parsed);
+
+    Int64S text_counter = perf_get_counter() - text_begin;
+
+    Int64S binary_begin = perf_get_counter();
+
+    SizeU mapped_binary_size = 0;
+    Byte *mapped_binary = static_cast<Byte *>(noc_native_map_file(s_binary_path, &mapped_binary_size));
+    assert(mapped_binary);
+
+    Tilemap binary_tilemap{};
+    is_parsed = parse_tilemap_binary(mapped_binary, mapped_binary_size, &binary_tilemap, &image_path);
+    assert(is_parsed && reinterpret_cast<Byte *>(binary_tilemap.indexes) > mapped_binary);
+
+    Int64S binary_counter = perf_get_counter() - binary_begin;
+
+    // NOTE(gr3yknigh1): Pages of binary tilemap are read on first access. [2026/10/17]
+    Int64S touch_begin = perf_get_counter();
+    [[maybe_unused]] bool is_equal = noc_memory_is_equals(binary_tilemap.indexes, text_tilemap.indexes, text_tilemap.indexes_count * sizeof(*text_tilemap.indexes));
+    Int64S touch_counter = perf_get_counter() - touch_begin;
+
+    assert(is_equal);
+
+    assert(binary_tilemap.indexes_count == text_tilemap.indexes_count);
+    assert(str8_view_is_equals(image_path, "demo-tilemap.bmp"));
+
+    // NOTE(gr3yknigh1): Header which claims more indexes than file has. [2026/10/17]
+    Tilemap truncated_tilemap{};
+    is_parsed = parse_tilemap_binary(mapped_binary, mapped_binary_size - 1, &truncated_tilemap, &image_path);
+    assert(!is_parsed && truncated_tilemap.indexes == nullptr);
+
+    printf(
+        "PERF: [tilemap_load] size = (%dx%d) text = (%.2f MiB, %.3f ms) binary = (%.2f MiB, %.3f ms, first access %.3f ms)\n",
+        side_count, side_count, static_cast<Float64>(text_size) / MEGABYTES(1), benchmark_counter_to_ms(text_counter),
+        static_cast<Float64>(mapped_binary_size) / MEGABYTES(1), benchmark_counter_to_ms(binary_counter),
+        benchmark_counter_to_ms(touch_counter));
+
+    [[maybe_unused]] bool is_unmapped = noc_native_unmap_file(mapped_text, mapped_text_size);
+    assert(is_unmapped);
+    is_unmapped = noc_native_unmap_file(mapped_binary, mapped_binary_size);
+    assert(is_unmapped);
+
+    mm::deallocate(text_tilemap.indexes);
+    mm::deallocate(source.indexes);
+    mm::deallocate(text);
+
+    remove(s_text_path);
+    remove(s_binary_path);
+}
+
+static void
+benchmark_tilemap_load(void)
+{
+    benchmark_tilemap_load_run(256);
+    benchmark_tilemap_load_run(4096);
+}
+
+//
+// Tilemap drawing:
+//
+
+static void
+benchmark_tilemap_draw_run(Int32S side_count, Vertex_Format format)
+{
+    Tilemap tilemap{};
+    tilemap.row_count = side_count;
+    tilemap.col_count = side_count;
+    tilemap.tile_x_pixel_count = 32;
+    tilemap.tile_y_pixel_count = 32;
+    tilemap.indexes_count = static_cast<SizeU>(tilemap.tiles_count());
+    tilemap.indexes = mm::allocate_structs<Int32S>(tilemap.indexes_count);
+    assert(tilemap.indexes);
+
+    for (SizeU index = 0; index < tilemap.indexes_count; ++index) {
+        tilemap.indexes[index] = static_cast<Int32S>(index % 64);
+    }
+
+    Atlas atlas{ 512, 512 };
+    Color4 color{ 255, 255, 255, 255 };
+
+    //
+    // NOTE(gr3yknigh1): Without chunks whole map is generated and uploaded each frame. [2026/10/17]
+    //
+    Int32U full_capacity = static_cast<Int32U>(tilemap.tiles_count()) * TILEMAP_VERTEX_COUNT_PER_TILE;
+    Vertex *full_vertexes = mm::allocate_structs<Vertex>(full_capacity);
+    assert(full_vertexes);
+
+    Int64S full_begin = perf_get_counter();
+    Int32U full_count = generate_geometry_from_tilemap(full_vertexes, full_capacity, &tilemap, 100, 100, color, &atlas);
+    Int64S full_counter = perf_get_counter() - full_begin;
+
+    Tilemap_Geometry geometry{};
+
+    Int64S build_begin = perf_get_counter();
+    [[maybe_unused]] bool is_made = make_tilemap_geometry(&geometry, &tilemap, 100, 100, color, &atlas, format);
+    Int64S build_counter = perf_get_counter() - build_begin;
+
+    assert(is_made && geometry.vertexes_count / QUAD_VERTEX_COUNT == full_count / TILEMAP_VERTEX_COUNT_PER_TILE);
+
+    SizeU vertex_size = vertex_format_get_size(format);
+    SizeU geometry_size = geometry.vertexes_count * vertex_size + geometry.indexes_count * sizeof(*geometry.indexes);
+
+    Int32U ranges_capacity = geometry.chunk_row_count * geometry.chunk_col_count;
+    Tilemap_Draw_Range *ranges = mm::allocate_structs<Tilemap_Draw_Range>(ranges_capacity);
+    assert(ranges);
+
+    //
+    // NOTE(gr3yknigh1): View, which covers whole map, gets every tile. Indexed quad draws as many indexes as
+    // non-indexed one has vertexes. [2026/10/17]
+    //
+    Rect_F32 whole_view{ 0, 0, 200 + side_count * TILEMAP_TILE_SIZE, 200 + side_count * TILEMAP_TILE_SIZE };
+    Int32U whole_ranges_count = tilemap_geometry_cull(&geometry, whole_view, ranges, ranges_capacity);
+
+    Int32U whole_count = 0;
+    for (Int32U range_index = 0; range_index < whole_ranges_count; ++range_index) {
+        whole_count += ranges[range_index].indexes_count;
+    }
+    assert(whole_count == full_count);
+
+    //
+    // NOTE(gr3yknigh1): Camera pans over the map with 1280x720 viewport. [2026/10/17]
+    //
+    constexpr Int32U frames_count = 1000;
+
+    Camera camera = make_camera(Camera_ViewMode::Orthogonal);
+    Int64U visible_count = 0;
+
+    Int64S cull_begin = perf_get_counter();
+
+    for (Int32U frame_index = 0; frame_index < frames_count; ++frame_index) {
+        camera.position.x = -static_cast<Float32>(frame_index) * side_count * TILEMAP_TILE_SIZE / frames_count;
+        camera.position.y = camera.position.x / 2;
+
+        Int32U ranges_count = tilemap_geometry_cull(&geometry, camera_get_view_rect(&camera, 1280, 720), ranges, ranges_capacity);
+
+        for (Int32U range_index = 0; range_index < ranges_count; ++range_index) {
+            visible_count += ranges[range_index].indexes_count / QUAD_INDEX_COUNT * QUAD_VERTEX_COUNT;
+        }
+    }
+
+    Int64S cull_counter = perf_get_counter() - cull_begin;
+
+    //
+    // NOTE(gr3yknigh1): Tiles change each frame (planting, watering), only they are generated and uploaded
+    // again. [2026/10/17]
+    //
+    constexpr Int32U edit_frames_count = 100;
+    constexpr Int32U edits_per_frame = 256;
+
+    Int64U edit_seed = 0x9E3779B97F4A7C15ULL;
+    SizeU dirty_size = 0;
+
+    Int64S edit_begin = perf_get_counter();
+
+    for (Int32U frame_index = 0; frame_index < edit_frames_count; ++frame_index) {
+        for (Int32U edit_index = 0; edit_index < edits_per_frame; ++edit_index) {
+            edit_seed = edit_seed * 6364136223846793005ULL + 1442695040888963407ULL;
+
+            Int32S col_index = static_cast<Int32S>((edit_seed >> 33) % static_cast<Int64U>(side_count));
+            Int32S row_index = static_cast<Int32S>((edit_seed >> 13) % static_cast<Int64U>(side_count));
+
+            tilemap_set_tile(&geometry, &tilemap, col_index, row_index, static_cast<Int32S>(edit_seed >> 58));
+        }
+
+        Int32U dirty_ranges_count = tilemap_geometry_flush_dirty(&geometry);
+
+        for (Int32U range_index = 0; range_index < dirty_ranges_count; ++range_index) {
+            dirty_size += geometry.dirty_ranges[range_index].size;
+        }
+    }
+
+    Int64S edit_counter = perf_get_counter() - edit_begin;
+
+    // NOTE(gr3yknigh1): More edits than dirty list holds mark whole geometry dirty. [2026/10/17]
+    for (Int32U edit_index = 0; edit_index <= TILEMAP_MAX_DIRTY_TILES && static_cast<Int32S>(edit_index) < tilemap.tiles_count(); ++edit_index) {
+        Int32S tile_offset = static_cast<Int32S>(edit_index);
+        tilemap_set_tile(&geometry, &tilemap, tile_offset % side_count, tile_offset / side_count, tilemap.indexes[tile_offset] + 1);
+    }
+
+    [[maybe_unused]] Int32U overflow_ranges_count = tilemap_geometry_flush_dirty(&geometry);
+    assert(overflow_ranges_count == 1 && geometry.dirty_ranges[0].size == geometry.vertexes_count * vertex_size);
+
+    // NOTE(gr3yknigh1): Patched geometry should be the same as generated from scratch. [2026/10/17]
+    Tilemap_Geometry expected_geometry{};
+    is_made = make_tilemap_geometry(&expected_geometry, &tilemap, 100, 100, color, &atlas, format);
+    assert(is_made && noc_memory_is_equals(expected_geometry.vertexes.data, geometry.vertexes.data, geometry.vertexes_count * vertex_size));
+    tilemap_geometry_destroy(&expected_geometry);
+
+    printf(
+        "PERF: [tilemap_draw] size = (%dx%d) format = (%s) full = (%.3f ms, %.2f MiB per frame) chunked = (%.2f MiB, build %.3f ms, cull %.3f us, %.2f MiB per frame) edits = (%u per frame, %.3f us, %.2f KiB per frame)\n",
+        side_count, side_count, format == Vertex_Format::Packed ? "packed" : "regular", benchmark_counter_to_ms(full_counter),
+        static_cast<Float64>(full_count) * sizeof(Vertex) / MEGABYTES(1), static_cast<Float64>(geometry_size) / MEGABYTES(1),
+        benchmark_counter_to_ms(build_counter), benchmark_counter_to_ns(cull_counter) / 1000.0 / frames_count,
+        static_cast<Float64>(visible_count) / frames_count * vertex_size / MEGABYTES(1), edits_per_frame,
+        benchmark_counter_to_ns(edit_counter) / 1000.0 / edit_frames_count,
+        static_cast<Float64>(dirty_size) / edit_frames_count / KILOBYTES(1));
+
+    tilemap_geometry_destroy(&geometry);
+
+    mm::deallocate(ranges);
+    mm::deallocate(full_vertexes);
+    mm::deallocate(tilemap.indexes);
+}
+
+static void
+benchmark_tilemap_draw(void)
+{
+    benchmark_tilemap_draw_run(64, Vertex_Format::Regular);
+    benchmark_tilemap_draw_run(64, Vertex_Format::Packed);
+    benchmark_tilemap_draw_run(1024, Vertex_Format::Regular);
+    benchmark_tilemap_draw_run(1024, Vertex_Format::Packed);
+}
+
+//
+// Tilemap generation:
+//
+
+static void
+benchmark_tilemap_fill_indexes(Tilemap *tilemap, Int32S row_count, Int32S col_count, Int32U index_limit)
+{
+    tilemap->row_count = row_count;
+    tilemap->col_count = col_count;
+    tilemap->tile_x_pixel_count = 32;
+    tilemap->tile_y_pixel_count = 32;
+    tilemap->indexes_count = static_cast<SizeU>(tilemap->tiles_count());
+    tilemap->indexes = mm::allocate_structs<Int32S>(tilemap->indexes_count);
+    assert(tilemap->indexes);
+
+    Int64U seed = 0x2545F4914F6CDD1DULL;
+
+    for (SizeU index = 0; index < tilemap->indexes_count; ++index) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        tilemap->indexes[index] = static_cast<Int32S>((seed >> 33) % index_limit);
+    }
+}
+
+//!
+//! @brief SIMD generation should match the scalar one (`generate_quad_with_atlas` for each tile) byte by byte, in both
+//! vertex formats and for shapes, which don't fill whole lanes (narrow chunks, tails).
+//!
+static void
+benchmark_tilemap_generate_check(Int32S row_count, Int32S col_count, Vertex_Format format)
+{
+    Tilemap tilemap{};
+    benchmark_tilemap_fill_indexes(&tilemap, row_count, col_count, 64);
+
+    // NOTE(gr3yknigh1): Indexes, which are out of the UV table, take the slow path. [2026/10/17]
+    tilemap.indexes[0] = -1;
+    tilemap.indexes[tilemap.indexes_count - 1] = static_cast<Int32S>(TILEMAP_UV_TABLE_MAX_COUNT) + 5;
+
+    Atlas atlas{ 512, 512 };
+    Color4 color{ 255, 128, 64, 32 };
+
+    NOC_Memory_SIMD_Level supported_level = noc_memory_get_simd_level();
+    noc_memory_set_simd_level(NOC_MEMORY_SIMD_LEVEL_NONE);
+
+    Tilemap_Geometry expected{};
+    [[maybe_unused]] bool is_made = make_tilemap_geometry(&expected, &tilemap, 100, 200, color, &atlas, format);
+    assert(is_made);
+
+    // NOTE(gr3yknigh1): There is only SSE2 kernel, higher levels run it too. [2026/10/17]
+    if (supported_level != NOC_MEMORY_SIMD_LEVEL_NONE) {
+        noc_memory_set_simd_level(NOC_MEMORY_SIMD_LEVEL_SSE2);
+
+        Tilemap_Geometry actual{};
+        is_made = make_tilemap_geometry(&actual, &tilemap, 100, 200, color, &atlas, format);
+
+        [[maybe_unused]] bool is_equal = is_made && actual.vertexes_count == expected.vertexes_count &&
+            noc_memory_is_equals(expected.vertexes.data, actual.vertexes.data, expected.vertexes_count * vertex_format_get_size(format));
+        assert(is_equal);
+
+        tilemap_geometry_destroy(&actual);
+    }
+
+    noc_memory_set_simd_level(supported_level);
+
+    tilemap_geometry_destroy(&expected);
+    mm::deallocate(tilemap.indexes);
+}
+
+//!
+//! @brief Takes the best of few regenerations of whole geometry, so only generation is measured: vertexes are already
+//! touched by `make_tilemap_geometry` and UV table is made beforehand.
+//!
+static Int64S
+benchmark_tilemap_generate_measure(Tilemap_Geometry *geometry, Tilemap *tilemap, const Tilemap_UV_Table *table)
+{
+    constexpr Int32S repeat_count = 5;
+
+    Int64S best_counter = INT64_MAX;
+
+    for (Int32S repeat_index = 0; repeat_index < repeat_count; ++repeat_index) {
+        Int64S begin = perf_get_counter();
+        tilemap_geometry_generate(geometry, tilemap, table);
+        best_counter = glm::min(best_counter, perf_get_counter() - begin);
+    }
+
+    return best_counter;
+}
+
+static void
+benchmark_tilemap_generate_run(Int32S side_count, Vertex_Format format)
+{
+    Tilemap tilemap{};
+    benchmark_tilemap_fill_indexes(&tilemap, side_count, side_count, 256);
+
+    Atlas atlas{ 512, 512 };
+    Color4 color{ 255, 255, 255, 255 };
+
+    NOC_Memory_SIMD_Level supported_level = noc_memory_get_simd_level();
+    noc_memory_set_simd_level(NOC_MEMORY_SIMD_LEVEL_NONE);
+
+    Tilemap_Geometry geometry{};
+    [[maybe_unused]] bool is_made = make_tilemap_geometry(&geometry, &tilemap, 100, 100, color, &atlas, format);
+    assert(is_made);
+
+    Tilemap_UV_Table table{};
+    is_made = make_tilemap_uv_table(&table, &tilemap, &atlas);
+    assert(is_made);
+
+    SizeU vertexes_size = geometry.vertexes_count * vertex_format_get_size(format);
+
+    void *expected = mm::allocate(vertexes_size);
+    assert(expected);
+    noc_memory_copy(expected, geometry.vertexes.data, vertexes_size);
+
+    Int64S scalar_counter = benchmark_tilemap_generate_measure(&geometry, &tilemap, &table);
+
+    printf(
+        "PERF: [tilemap_generate] size = (%dx%d) format = (%s) vertexes = (%.2f MiB) scalar = (%.3f ms)", side_count,
+        side_count, format == Vertex_Format::Packed ? "packed" : "regular",
+        static_cast<Float64>(vertexes_size) / MEGABYTES(1), benchmark_counter_to_ms(scalar_counter));
+
+    if (supported_level != NOC_MEMORY_SIMD_LEVEL_NONE) {
+        noc_memory_set_simd_level(NOC_MEMORY_SIMD_LEVEL_SSE2);
+
+        Int64S simd_counter = benchmark_tilemap_generate_measure(&geometry, &tilemap, &table);
+
+        if (noc_memory_is_equals(expected, geometry.vertexes.data, vertexes_size)) {
+            printf(
+                " sse2 = (%.3f ms, x%.2f)", benchmark_counter_to_ms(simd_counter),
+                static_cast<Float64>(scalar_counter) / static_cast<Float64>(simd_counter));
+        } else {
+            printf(" sse2 = (output differs from scalar)");
+        }
+    }
+
+    printf("\n");
+
+    noc_memory_set_simd_level(supported_level);
+
+    mm::deallocate(expected);
+    tilemap_uv_table_destroy(&table);
+    tilemap_geometry_destroy(&geometry);
+    mm::deallocate(tilemap.indexes);
+}
+
+static void
+benchmark_tilemap_generate(void)
+{
+    Vertex_Format formats[] = { Vertex_Format::Regular, Vertex_Format::Packed };
+
+    for (SizeU format_index = 0; format_index < STATIC_ARRAY_COUNT(formats); ++format_index) {
+        benchmark_tilemap_generate_check(1, 1, formats[format_index]);
+        benchmark_tilemap_generate_check(3, 5, formats[format_index]);
+        benchmark_tilemap_generate_check(21, 21, formats[format_index]);
+        benchmark_tilemap_generate_check(33, 7, formats[format_index]);
+        benchmark_tilemap_generate_check(17, 35, formats[format_index]);
+    }
+
+    for (SizeU format_index = 0; format_index < STATIC_ARRAY_COUNT(formats); ++format_index) {
+        benchmark_tilemap_generate_run(256, formats[format_index]);
+        benchmark_tilemap_generate_run(2048, formats[format_index]);
+    }
+}
+
+//
+// Sprite batching:
+//
+
+static int
+benchmark_compare_sort_items(const void *a, const void *b)
+{
+    Int64U x = static_cast<const Sort_Item *>(a)->key;
+    Int64U y = static_cast<const Sort_Item *>(b)->key;
+    return (x > y) - (x < y);
+}
+
+static void
+benchmark_sprite_batch_run(Int32U sprites_count)
+{
+    constexpr Int32U layers_count = 4;
+    constexpr Int32U shaders_count = 2;
+    constexpr Int32U textures_count = 8;
+
+    Sprite_Batch batch{};
+    [[maybe_unused]] bool is_made = make_sprite_batch(&batch, sprites_count);
+    assert(is_made);
+
+    Sort_Item *qsort_items = mm::allocate_structs<Sort_Item>(sprites_count);
+    assert(qsort_items);
+
+    //
+    // NOTE(gr3yknigh1): Handles are not backed by a store, batch only needs their slots. [2026/10/17]
+    //
+    Int64U seed = 0x9E3779B97F4A7C15ULL;
+
+    for (Int32U sprite_index = 0; sprite_index < sprites_count; ++sprite_index) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        Sprite sprite{};
+        sprite.rect = { static_cast<Float32>(seed % 1024), static_cast<Float32>((seed >> 10) % 1024), 32, 32 };
+        sprite.location = { 0, 0, 32, 32 };
+        sprite.atlas = { 256, 256 };
+        sprite.color = { 255, 255, 255, 255 };
+        sprite.layer = static_cast<Int8U>((seed >> 20) % layers_count);
+        sprite.depth = static_cast<Float32>(static_cast<Int32S>((seed >> 24) % 2048) - 1024) * 0.5f;
+        sprite.shader = { (1u << 16) | static_cast<Int32U>(1 + (seed >> 36) % shaders_count) };
+        sprite.texture = { (1u << 16) | static_cast<Int32U>(16 + (seed >> 40) % textures_count) };
+
+        [[maybe_unused]] bool is_pushed = sprite_batch_push(&batch, &sprite);
+        assert(is_pushed);
+    }
+
+    [[maybe_unused]] Sprite overflow{};
+    assert(!sprite_batch_push(&batch, &overflow));
+
+    noc_memory_copy(qsort_items, batch.items, sprites_count * sizeof(Sort_Item));
+
+    Int64S build_begin = perf_get_counter();
+    Int32U draws_count = sprite_batch_build(&batch);
+    Int64S build_counter = perf_get_counter() - build_begin;
+
+    Int64S qsort_begin = perf_get_counter();
+    qsort(qsort_items, sprites_count, sizeof(Sort_Item), benchmark_compare_sort_items);
+    Int64S qsort_counter = perf_get_counter() - qsort_begin;
+
+    //
+    // NOTE(gr3yknigh1): Keys are unique only up to equal depth, so order is checked by keys, and payload of equal keys
+    // should go in order of push (sort is stable). [2026/10/17]
+    //
+    noc_memory_copy(batch.scratch_items, batch.items, sprites_count * sizeof(Sort_Item));
+
+    Int64S radix_begin = perf_get_counter();
+    const Sort_Item *sorted_items = radix_sort(batch.scratch_items, batch.items, sprites_count);
+    Int64S radix_counter = perf_get_counter() - radix_begin;
+
+    [[maybe_unused]] Int32U misordered_count = 0;
+
+    for (Int32U sorted_index = 0; sorted_index < sprites_count; ++sorted_index) {
+        bool is_ordered = sorted_items[sorted_index].key == qsort_items[sorted_index].key &&
+                          (sorted_index == 0 || sorted_items[sorted_index - 1].key < sorted_items[sorted_index].key ||
+                           sorted_items[sorted_index - 1].value < sorted_items[sorted_index].value);
+
+        misordered_count += is_ordered ? 0 : 1;
+    }
+
+    assert(misordered_count == 0);
+
+    assert(draws_count == batch.draws_count && draws_count <= layers_count * shaders_count * textures_count);
+
+    Int32U indexes_count = 0;
+
+    for (Int32U draw_index = 0; draw_index < draws_count; ++draw_index) {
+        const Sprite_Draw *draw = batch.draws + draw_index;
+
+        assert(draw->first_index == indexes_count);
+        assert(draw_index == 0 || !(batch.draws[draw_index - 1].state == draw->state));
+
+        indexes_count += draw->indexes_count;
+    }
+
+    assert(indexes_count == sprites_count * QUAD_INDEX_COUNT);
+
+    printf(
+        "PERF: [sprite_batch] sprites = (%u) draws = (%u) build = (%.3f ms) sort = (radix %.3f ms, qsort %.3f ms)\n",
+        sprites_count, draws_count, benchmark_counter_to_ms(build_counter), benchmark_counter_to_ms(radix_counter),
+        benchmark_counter_to_ms(qsort_counter));
+
+    sprite_batch_reset(&batch);
+    assert(sprite_batch_build(&batch) == 0);
+
+    mm::deallocate(qsort_items);
+    sprite_batch_destroy(&batch);
+}
+
+static void
+benchmark_sprite_batch(void)
+{
+    benchmark_sprite_batch_run(1);
+    benchmark_sprite_batch_run(10000);
+    benchmark_sprite_batch_run(100000);
+}
+
+//
+// Asset loading:
+//
+
+//!
+//! @brief Writes BGRA bitmap with bitfields (the only layout `asset_from_bitmap_picture` accepts).
+//!
+static void
+benchmark_write_bitmap(const char *path, Int32U side_count)
+{
+    constexpr Int32U masks_size = 3 * sizeof(Int32U);
+
+    Bitmap_Picture picture{};
+    picture.header.type = 0x4D42; // "BM"
+    picture.header.data_offset = sizeof(picture.header) + sizeof(picture.dib_header) + masks_size;
+    picture.dib_header.header_size = Bitmap_Picture_Header_Type::BitmapInfoHeader;
+    picture.dib_header.width = side_count;
+    picture.dib_header.height = side_count;
+    picture.dib_header.planes_count = 1;
+    picture.dib_header.depth = 32;
+    picture.dib_header.compression_method = Bitmap_Picture_Compression_Method::Bitfields;
+    picture.dib_header.image_size = side_count * side_count * sizeof(Color_BGRA_U8);
+    picture.header.file_size = picture.header.data_offset + picture.dib_header.image_size;
+
+    Int32U masks[3] = { 0x00FF0000, 0x0000FF00, 0x000000FF };
+
+    Color_BGRA_U8 *pixels = mm::allocate_structs<Color_BGRA_U8>(side_count * side_count);
+    assert(pixels);
+
+    for (Int32U pixel_index = 0; pixel_index < side_count * side_count; ++pixel_index) {
+        pixels[pixel_index] = { static_cast<Int8U>(pixel_index), static_cast<Int8U>(pixel_index >> 8), 0, 255 };
+    }
+
+    FILE *file = fopen(path, "wb");
+    assert(file);
+    fwrite(&picture.header, sizeof(picture.header), 1, file);
+    fwrite(&picture.dib_header, sizeof(picture.dib_header), 1, file);
+    fwrite(masks, sizeof(masks), 1, file);
+    fwrite(pixels, picture.dib_header.image_size, 1, file);
+    fclose(file);
+
+    mm::deallocate(pixels);
+}
+
+static void
+benchmark_asset_load_run(Int32U atlases_count, Int32U side_count)
+{
+    static char s_paths[Asset_Store::max_asset_count / 2][32];
+    assert(atlases_count <= STATIC_ARRAY_COUNT(s_paths));
+
+    for (Int32U atlas_index = 0; atlas_index < atlases_count; ++atlas_index) {
+        snprintf(s_paths[atlas_index], sizeof(s_paths[atlas_index]), "garden_benchmark_atlas_%u.bmp", atlas_index);
+        benchmark_write_bitmap(s_paths[atlas_index], side_count);
+    }
+
+    Asset_Store store;
+    [[maybe_unused]] bool is_made = make_asset_store_from_folder(&store, ".");
+    assert(is_made);
+
+    Asset_Handle *atlases = mm::allocate_structs<Asset_Handle>(atlases_count);
+    assert(atlases);
+
+    //
+    // NOTE(gr3yknigh1): Synchronous loading blocks the frame for the whole time. [2026/10/17]
+    //
+    Int64S sync_begin = perf_get_counter();
+
+    for (Int32U atlas_index = 0; atlas_index < atlases_count; ++atlas_index) {
+        atlases[atlas_index] = asset_load(&store, Asset_Type::Texture, s_paths[atlas_index]);
+    }
+
+    Int64S sync_counter = perf_get_counter() - sync_begin;
+
+    for (Int32U atlas_index = 0; atlas_index < atlases_count; ++atlas_index) {
+        Asset *atlas = asset_store_get(&store, atlases[atlas_index]);
+        assert(atlas && atlas->u.texture.width == static_cast<int>(side_count));
+        [[maybe_unused]] bool is_unloaded = asset_unload(&store, atlas);
+        assert(is_unloaded);
+    }
+
+    //
+    // NOTE(gr3yknigh1): Main thread only polls completions each frame, frame work is simulated with sleep. [2026/10/17]
+    //
+    Int64S async_begin = perf_get_counter();
+
+    for (Int32U atlas_index = 0; atlas_index < atlases_count; ++atlas_index) {
+        [[maybe_unused]] bool is_queued = asset_reload_async(&store, asset_store_get(&store, atlases[atlas_index]));
+        assert(is_queued);
+    }
+
+    Int64S frame_max_counter = 0;
+    Int32U frames_count = 0;
+    Int32U completed_count = 0;
+
+    while (completed_count < atlases_count) {
+        Int64S frame_begin = perf_get_counter();
+
+        for (Asset *it = asset_store_pop_completed(&store); it != nullptr; it = asset_store_pop_completed(&store)) {
+            assert(it->state == Asset_State::Loaded && it->u.texture.width == static_cast<int>(side_count));
+            ++completed_count;
+        }
+
+        Int64S frame_counter = perf_get_counter() - frame_begin;
+        frame_max_counter = frame_counter > frame_max_counter ? frame_counter : frame_max_counter;
+        ++frames_count;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    Int64S async_counter = perf_get_counter() - async_begin;
+
+    printf(
+        "PERF: [asset_load] atlases = (%u x %ux%u) sync = (%.3f ms blocked) async = (%.3f ms total, %u frames, max main thread %.3f ms) workers = (%u)\n",
+        atlases_count, side_count, side_count, benchmark_counter_to_ms(sync_counter), benchmark_counter_to_ms(async_counter),
+        frames_count, benchmark_counter_to_ms(frame_max_counter), store.workers_count);
+
+    //
+    // NOTE(gr3yknigh1): Released slots are reused, handles to them go stale. [2026/10/17]
+    //
+    Int32U slots_count = store.slots_count;
+
+    for (Int32U atlas_index = 0; atlas_index < atlases_count; ++atlas_index) {
+        Asset_Handle released = atlases[atlas_index];
+
+        [[maybe_unused]] bool is_released = asset_release(&store, released);
+        assert(is_released && !asset_release(&store, released) && asset_store_get(&store, released) == nullptr);
+        assert(asset_store_find(&store, s_paths[atlas_index]).is_null());
+
+        atlases[atlas_index] = asset_load(&store, Asset_Type::Texture, s_paths[atlas_index]);
+        assert(atlases[atlas_index].index() == released.index() && atlases[atlas_index] != released);
+        assert(asset_store_find(&store, s_paths[atlas_index]) == atlases[atlas_index]);
+    }
+
+    [[maybe_unused]] bool is_slots_reused = store.slots_count == slots_count && store.live_count == atlases_count;
+    assert(is_slots_reused);
+
+    Int32U loaded_count = 0;
+    FOR_EACH_ASSET(it, &store) {
+        loaded_count += it->state == Asset_State::Loaded ? 1 : 0;
+    }
+    assert(loaded_count == atlases_count);
+
+    [[maybe_unused]] bool is_destroyed = asset_store_destroy(&store);
+    assert(is_destroyed);
+
+    for (Int32U atlas_index = 0; atlas_index < atlases_count; ++atlas_index) {
+        remove(s_paths[atlas_index]);
+    }
+
+    mm::deallocate(atlases);
+}
+
+static void
+benchmark_asset_load(void)
+{
+    benchmark_asset_load_run(4, 512);
+    benchmark_asset_load_run(4, 2048);
+
+    // NOTE(gr3yknigh1): Many small files, which workers read in batches (see `noc_io_read_files`). [2026/10/17]
+    benchmark_asset_load_run(384, 32);
+}
+
+static Benchmark benchmarks[] = {
+    { "block_allocator", benchmark_block_allocator },
+    { "pool_allocator", benchmark_pool_allocator },
+    { "str_compare", benchmark_str_compare },
+    { "tilemap_parse", benchmark_tilemap_parse },
+    { "tilemap_load", benchmark_tilemap_load },
+    { "tilemap_draw", benchmark_tilemap_draw },
+    { "tilemap_generate", benchmark_tilemap_generate },
+    { "sprite_batch", benchmark_sprite_batch },
+    { "asset_load", benchmark_asset_load },
+};
+
+int
+main(int argc, char **argv)
+{
+    for (SizeU benchmark_index = 0; benchmark_index < STATIC_ARRAY_COUNT(benchmarks); ++benchmark_index) {
+        Benchmark *benchmark = benchmarks + benchmark_index;
+
+        bool should_run = argc <= 1;
+
+        for (int arg_index = 1; arg_index < argc; ++arg_index) {
+            if (str8_view_is_equals(argv[arg_index], benchmark->name)) {
+                should_run = true;
+                break;
+            }
+        }
+
+        if (should_run) {
+            benchmark->routine();
+        }
+    }
+
+    return 0;
+}
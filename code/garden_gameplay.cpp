@@ -5,6 +5,14 @@
 #include "garden_runtime.h"
 #include "garden_gameplay.h"
 
+//!
+//! @brief Layers of sprites (see `Sprite::layer`).
+//!
+enum Game_Layer : Int8U {
+    GAME_LAYER_GROUND = 0,
+    GAME_LAYER_ENTITIES = 1,
+};
+
 struct Game_Context {
     Float32 player_x, player_y, player_w, player_h;
     Float32 player_speed;
@@ -20,7 +28,7 @@ float absolute(float x);
 void normalize_vector2f(float *x, float *y);
 
 
-extern "C" __declspec(dllexport) void *
+GAME_EXPORT void *
 game_on_init(Platform_Context *platform)
 {
     Game_Context *game = mm::allocate_struct<Game_Context>(&platform->persist_arena, ALLOCATE_NO_OPTS);
@@ -36,13 +44,13 @@ game_on_init(Platform_Context *platform)
 }
 
 
-extern "C" __declspec(dllexport) void
+GAME_EXPORT void
 game_on_load([[maybe_unused]] Platform_Context *platform, Game_Context *game)
 {
     game->player_speed = 100;
 }
 
-extern "C" __declspec(dllexport) void
+GAME_EXPORT void
 game_on_tick(Platform_Context *platform, Game_Context *game, float delta_time)
 {
     Float32 x_direction = 0, y_direction = 0;
@@ -79,15 +87,21 @@ game_on_tick(Platform_Context *platform, Game_Context *game, float delta_time)
 }
 
 
-extern "C" __declspec(dllexport) void
+GAME_EXPORT void
 game_on_draw(Platform_Context *platform, Game_Context *game, [[maybe_unused]] float delta_time)
 {
-    // XXX
-    Color4 rect_color = { 255, 255, 255, 255  };
-    Atlas atlas = { 32, 32 };
+    Sprite player{};
+    player.rect = { game->player_x, game->player_y, game->player_w, game->player_h };
+    player.location = game->atlas_location;
+    player.atlas = { 32, 32 }; // XXX
+    player.color = { 255, 255, 255, 255 };
+    player.layer = GAME_LAYER_ENTITIES;
+    player.depth = -game->player_y; // NOTE(gr3yknigh1): Lower entities are closer to the camera. [2026/10/17]
+    player.texture = platform->atlas_texture;
+    player.shader = platform->basic_shader;
 
-    platform->vertexes = mm::allocate_structs<Vertex>(&platform->vertexes_arena, 6);
-    platform->vertexes_count = generate_rect_with_atlas(platform->vertexes, game->player_x, game->player_y, game->player_w, game->player_h, game->atlas_location, &atlas, rect_color);
+    [[maybe_unused]] bool is_pushed = sprite_batch_push(&platform->sprite_batch, &player);
+    assert(is_pushed);
 
 
     #if 0
@@ -114,7 +128,7 @@ game_on_draw(Platform_Context *platform, Game_Context *game, [[maybe_unused]] fl
     #endif
 }
 
-extern "C" __declspec(dllexport) void
+GAME_EXPORT void
 game_on_fini([[maybe_unused]] Platform_Context *platform, [[maybe_unused]] Game_Context *game)
 {
 }
@@ -30,4 +30,10 @@ typedef void (Game_On_Fini_Fn_Type)(Platform_Context *platform, Game_Context *ga
 #define GAME_ON_DRAW_FN_NAME "game_on_draw"
 #define GAME_ON_FINI_FN_NAME "game_on_fini"
 
+#if defined(NOC_DETECT_PLATFORM_WINDOWS)
+    #define GAME_EXPORT extern "C" __declspec(dllexport)
+#else
+    #define GAME_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
 #endif // GARDEN_GAMEPLAY_H
@@ -9,12 +9,20 @@
 
 #include <ctype.h>  // isspace
 
+#include <noc/detect.h>
+
+#if NOC_DETECT_ARCH_X86_64
+    #include <emmintrin.h>
+#endif
+
 #include <cassert>
+#include <cinttypes> // PRIu64, PRId64
 #include <cstdlib>
 #include <cstring>
 
+#include <atomic>
+#include <bit>
 #include <memory>
-#include <list>
 #include <unordered_map>
 #include <thread>
 
@@ -71,9 +79,107 @@ generate_rect_with_atlas(
     return count;
 }
 
+Int32U
+generate_quad_with_atlas(
+    Vertex *vertexes, Float32 x, Float32 y, Float32 width, Float32 height, Rect_F32 location, Atlas *atlas, Color4 color)
+{
+    Float32 s0 = (location.x + 0) / atlas->x_pixel_count;
+    Float32 t0 = (location.y + 0) / atlas->y_pixel_count;
+    Float32 s1 = (location.x + location.width) / atlas->x_pixel_count;
+    Float32 t1 = (location.y + location.height) / atlas->y_pixel_count;
+
+    packed_rgba_t packed_color = pack_rgba_to_int(color.r, color.g, color.b, color.a);
+
+    vertexes[0] = {x + 0,     y + 0,      s0, t0, packed_color}; // bottom-left
+    vertexes[1] = {x + width, y + 0,      s1, t0, packed_color}; // bottom-right
+    vertexes[2] = {x + width, y + height, s1, t1, packed_color}; // top-right
+    vertexes[3] = {x + 0,     y + height, s0, t1, packed_color}; // top-left
+
+    return QUAD_VERTEX_COUNT;
+}
+
+void
+generate_quad_indexes(Int32U *indexes, Int32U quads_count)
+{
+    assert(indexes);
+
+    for (Int32U quad_index = 0; quad_index < quads_count; ++quad_index) {
+        Int32U first_vertex = quad_index * QUAD_VERTEX_COUNT;
+
+        // NOTE(gr3yknigh1): Same triangles as `generate_rect` makes. [2026/10/17]
+        *indexes++ = first_vertex + 0;
+        *indexes++ = first_vertex + 1;
+        *indexes++ = first_vertex + 2;
+        *indexes++ = first_vertex + 0;
+        *indexes++ = first_vertex + 2;
+        *indexes++ = first_vertex + 3;
+    }
+}
+
+static Int16U
+pack_unorm16(Float32 value)
+{
+    return static_cast<Int16U>(glm::clamp(value, 0.0f, 1.0f) * 65535.0f + 0.5f);
+}
+
+void
+pack_vertexes(Packed_Vertex *packed, const Vertex *vertexes, Int32U vertexes_count, Float32 origin_x, Float32 origin_y)
+{
+    assert(packed && vertexes);
+
+    for (Int32U vertex_index = 0; vertex_index < vertexes_count; ++vertex_index) {
+        const Vertex *vertex = vertexes + vertex_index;
+
+        Float32 x = vertex->x - origin_x;
+        Float32 y = vertex->y - origin_y;
+        assert(x >= 0 && x <= 65535 && y >= 0 && y <= 65535);
+
+        packed[vertex_index].x = static_cast<Int16U>(x + 0.5f);
+        packed[vertex_index].y = static_cast<Int16U>(y + 0.5f);
+        packed[vertex_index].s = pack_unorm16(vertex->s);
+        packed[vertex_index].t = pack_unorm16(vertex->t);
+        packed[vertex_index].color = vertex->color;
+    }
+}
+
+static Rect_F32
+tilemap_get_tile_location_of_index(Tilemap *tilemap, Int32S tile_index_value)
+{
+    Float32 tile_index = static_cast<Float32>(tile_index_value);
+
+    Rect_F32 tile_location{};
+    tile_location.x = floorf(tile_index / tilemap->col_count) * static_cast<Float32>(tilemap->tile_x_pixel_count);
+    tile_location.y = floorf(fmodf(tile_index, static_cast<Float32>(tilemap->col_count))) * static_cast<Float32>(tilemap->tile_y_pixel_count);
+    tile_location.width = static_cast<Float32>(tilemap->tile_x_pixel_count);
+    tile_location.height = static_cast<Float32>(tilemap->tile_y_pixel_count);
+
+    return tile_location;
+}
+
+static Rect_F32
+tilemap_get_tile_location(Tilemap *tilemap, int col_index, int row_index)
+{
+    int tile_index_offset = get_offset_from_coords_of_2d_grid_array_rm(static_cast<int>(tilemap->col_count), col_index, row_index);
+    return tilemap_get_tile_location_of_index(tilemap, tilemap->indexes[tile_index_offset]);
+}
+
+static Int32U
+generate_geometry_from_tile(
+    Vertex *vertexes, Tilemap *tilemap, int col_index, int row_index, Float32 origin_x, Float32 origin_y,
+    Color4 color, Atlas *atlas)
+{
+    Float32 tile_x = origin_x + col_index * TILEMAP_TILE_SIZE; // tilemap->tile_x_pixel_count;
+    Float32 tile_y = origin_y + row_index * TILEMAP_TILE_SIZE; // tilemap->tile_y_pixel_count;
+
+    return generate_rect_with_atlas(
+        vertexes, tile_x, tile_y, TILEMAP_TILE_SIZE, TILEMAP_TILE_SIZE
+        /* static_cast<Float32>(x_pixel_count), static_cast<Float32>(y_pixel_count) */,
+        tilemap_get_tile_location(tilemap, col_index, row_index), atlas, color);
+}
+
 Int32U
 generate_geometry_from_tilemap(
-    Vertex *vertexes, Int32U vertexes_capacity,
+    Vertex *vertexes, [[maybe_unused]] Int32U vertexes_capacity,
     Tilemap *tilemap, Float32 origin_x, Float32 origin_y,
     Color4 color, Atlas *atlas)
 {
@@ -87,380 +193,2745 @@ generate_geometry_from_tilemap(
             //! @todo(gr3yknigh1): Improve error handling [2025/04/24] #refactor #error_handling
             assert(vertex_count < vertexes_capacity);
 
-            Float32 tile_x = origin_x + col_index * 100; // tilemap->tile_x_pixel_count;
-            Float32 tile_y = origin_y + row_index * 100; // tilemap->tile_y_pixel_count;
-
-            int tile_index_offset = get_offset_from_coords_of_2d_grid_array_rm(static_cast<int>(tilemap->col_count), col_index, row_index);
-            Float32 tile_index = static_cast<Float32>(tilemap->indexes[tile_index_offset]);
-
-            Rect_F32 tile_location{};
-            tile_location.x = floorf(tile_index / tilemap->col_count) * static_cast<Float32>(tilemap->tile_x_pixel_count);
-            tile_location.y = floorf(fmodf(tile_index, static_cast<Float32>(tilemap->col_count))) * static_cast<Float32>(tilemap->tile_y_pixel_count);
-            tile_location.width = static_cast<Float32>(tilemap->tile_x_pixel_count);
-            tile_location.height = static_cast<Float32>(tilemap->tile_y_pixel_count);
-
-            vertex_count += generate_rect_with_atlas(
-                vertexes + vertex_count, tile_x, tile_y, 100, 100
-                /* static_cast<Float32>(x_pixel_count), static_cast<Float32>(y_pixel_count) */,
-                tile_location, atlas, color);
+            vertex_count += generate_geometry_from_tile(
+                vertexes + vertex_count, tilemap, col_index, row_index, origin_x, origin_y, color, atlas);
         }
     }
 
     return vertex_count;
 }
 
-int
-get_offset_from_coords_of_2d_grid_array_rm(int width, int x, int y)
-{
-    return width * y + x;
-}
+//
+// Tilemap generation with SIMD:
+//
 
-mm::Fixed_Arena
-mm::make_static_arena(SizeU capacity)
+static void
+tilemap_compute_uv(Float32 *uv, Tilemap *tilemap, const Atlas *atlas, Int32S tile_index)
 {
-    Fixed_Arena arena;
+    Rect_F32 location = tilemap_get_tile_location_of_index(tilemap, tile_index);
 
-    arena.data     = allocate(capacity);
-    arena.capacity = capacity;
-    arena.occupied = 0;
+    // NOTE(gr3yknigh1): Same expressions as in `generate_quad_with_atlas`, so results are bit-exact. [2026/10/17]
+    uv[0] = (location.x + 0) / atlas->x_pixel_count;
+    uv[1] = (location.y + 0) / atlas->y_pixel_count;
+    uv[2] = (location.x + location.width) / atlas->x_pixel_count;
+    uv[3] = (location.y + location.height) / atlas->y_pixel_count;
+}
 
-    return arena;
+static void
+tilemap_pack_uv(Int16U *packed_uv, const Float32 *uv)
+{
+    for (Int32U component_index = 0; component_index < 4; ++component_index) {
+        packed_uv[component_index] = pack_unorm16(uv[component_index]);
+    }
 }
 
-Lexer
-make_lexer(Char8 *buffer, SizeU buffer_size)
+bool
+make_tilemap_uv_table(Tilemap_UV_Table *table, Tilemap *tilemap, Atlas *atlas)
 {
-    Lexer lexer;
+    assert(table && tilemap && atlas);
 
-    lexer.cursor = buffer;
-    lexer.lexeme = *buffer;
+    Int32S max_tile_index = 0;
 
-    lexer.buffer = buffer;
-    lexer.buffer_size = buffer_size;
+    for (SizeU index = 0; index < tilemap->indexes_count; ++index) {
+        max_tile_index = glm::max(max_tile_index, tilemap->indexes[index]);
+    }
 
-    return lexer;
+    table->count = glm::min(static_cast<Int32U>(max_tile_index) + 1, TILEMAP_UV_TABLE_MAX_COUNT);
+    table->uvs = mm::allocate_structs<Float32>(static_cast<Int64U>(table->count) * 4);
+    table->packed_uvs = mm::allocate_structs<Int16U>(static_cast<Int64U>(table->count) * 4);
+
+    if (table->uvs == nullptr || table->packed_uvs == nullptr) {
+        tilemap_uv_table_destroy(table);
+        return false;
+    }
+
+    for (Int32U tile_index = 0; tile_index < table->count; ++tile_index) {
+        tilemap_compute_uv(table->uvs + tile_index * 4, tilemap, atlas, static_cast<Int32S>(tile_index));
+        tilemap_pack_uv(table->packed_uvs + tile_index * 4, table->uvs + tile_index * 4);
+    }
+
+    return true;
 }
 
 void
-lexer_advance(Lexer *lexer, int32_t count)
+tilemap_uv_table_destroy(Tilemap_UV_Table *table)
 {
-    size_t cursor_index = lexer->cursor - lexer->buffer;
+    assert(table);
 
-    if (lexer_is_end(lexer) && cursor_index + count < lexer->buffer_size) {
-        return;
-    }
+    mm::deallocate(table->uvs);
+    mm::deallocate(table->packed_uvs);
+    *table = {};
+}
 
-    while (count > 0) {
-        lexer->cursor++;
-        --count;
+struct Tilemap_Generation {
+    Tilemap_Geometry *geometry;
+    Tilemap *tilemap;
+    const Tilemap_UV_Table *table;
+
+    bool is_streaming; //!< Use non-temporal stores.
+};
+
+//!
+//! @param[in] scratch Where UVs are computed, if tile index is out of the table. Should be 16 bytes aligned.
+//!
+static inline const Float32 *
+tilemap_generation_get_uv(const Tilemap_Generation *generation, Int32S tile_index, Float32 *scratch)
+{
+    if (static_cast<Int32U>(tile_index) < generation->table->count) {
+        return generation->table->uvs + static_cast<SizeU>(tile_index) * 4;
     }
 
-    lexer->lexeme = *(lexer->cursor);
+    tilemap_compute_uv(scratch, generation->tilemap, &generation->geometry->atlas, tile_index);
+    return scratch;
 }
 
-char
-lexer_peek(Lexer *lexer, int32_t offset)
+static inline const Int16U *
+tilemap_generation_get_packed_uv(const Tilemap_Generation *generation, Int32S tile_index, Int16U *scratch)
 {
-    size_t cursor_index = lexer->cursor - lexer->buffer;
+    if (static_cast<Int32U>(tile_index) < generation->table->count) {
+        return generation->table->packed_uvs + static_cast<SizeU>(tile_index) * 4;
+    }
 
-    // TODO(gr3yknigh1): Maybe make it signed? [2025/02/23]
-    if (cursor_index + offset < lexer->buffer_size) {
-        char *peek = lexer->cursor + offset;
-        return *peek;
+    alignas(16) Float32 uv[4];
+    tilemap_compute_uv(uv, generation->tilemap, &generation->geometry->atlas, tile_index);
+    tilemap_pack_uv(scratch, uv);
+    return scratch;
+}
+
+#if NOC_DETECT_ARCH_X86_64
+
+//
+// NOTE(gr3yknigh1): Kernels generate 4 neighbour tiles of one row at a time. Quads of tiles in a chunk row are stored
+// one after another, so each kernel writes contiguous run. `Vertex` quad is 80 bytes (5 vectors) and `Packed_Vertex`
+// quad is 48 bytes (3 vectors), so if geometry starts at 16 byte boundary, every quad does too. [2026/10/17]
+//
+
+//!
+//! @brief Big geometry goes around the cache (like in `noc_memory_set`), it's read only once, when uploaded to GPU.
+//!
+static inline void
+tilemap_store_sse2(__m128 *output, __m128 value, bool is_streaming)
+{
+    if (is_streaming) {
+        _mm_stream_ps(reinterpret_cast<Float32 *>(output), value);
+    } else {
+        _mm_store_ps(reinterpret_cast<Float32 *>(output), value);
     }
+}
 
-    return 0;
+//!
+//! @brief Checks 4 tile indexes against the UV table at once, so UVs of all lanes are loaded from the table without
+//! checking each one. Table has no more than `TILEMAP_UV_TABLE_MAX_COUNT` entries, so signed compare is enough.
+//!
+static inline bool
+tilemap_is_in_table_sse2(__m128i tile_indexes, __m128i table_count)
+{
+    __m128i is_not_negative = _mm_cmpgt_epi32(tile_indexes, _mm_set1_epi32(-1));
+    __m128i is_below_count = _mm_cmplt_epi32(tile_indexes, table_count);
+
+    return _mm_movemask_epi8(_mm_and_si128(is_not_negative, is_below_count)) == 0xFFFF;
 }
 
-Str8_View
-lexer_peek_view(Lexer *lexer, int32_t offset)
+//!
+//! @brief Writes `Vertex` quad as 5 vectors: `r0 c | r1 c | r2 c | r3 c`, where each record is position and UV of
+//! the corner.
+//!
+//! @param[in] position Corners of the tile: `x, y, x1, y1`.
+//! @param[in] uv `s0, t0, s1, t1`.
+//!
+static inline void
+tilemap_store_quad_sse2(__m128 *output, __m128 position, __m128 uv, __m128 color, bool is_streaming)
 {
-    size_t cursor_index = lexer->cursor - lexer->buffer;
+    // NOTE(gr3yknigh1): Same corners as `generate_quad_with_atlas` makes. [2026/10/17]
+    __m128 r0 = _mm_shuffle_ps(position, uv, _MM_SHUFFLE(1, 0, 1, 0)); // bottom-left
+    __m128 r1 = _mm_shuffle_ps(position, uv, _MM_SHUFFLE(1, 2, 1, 2)); // bottom-right
+    __m128 r2 = _mm_shuffle_ps(position, uv, _MM_SHUFFLE(3, 2, 3, 2)); // top-right
+    __m128 r3 = _mm_shuffle_ps(position, uv, _MM_SHUFFLE(3, 0, 3, 0)); // top-left
+
+    __m128 c_r1 = _mm_shuffle_ps(color, r1, _MM_SHUFFLE(0, 0, 0, 0)); // c c r1.0 r1.0
+    __m128 r1_c = _mm_shuffle_ps(r1, color, _MM_SHUFFLE(0, 0, 3, 3)); // r1.3 r1.3 c c
+    __m128 c_r3 = _mm_shuffle_ps(color, r3, _MM_SHUFFLE(0, 0, 0, 0)); // c c r3.0 r3.0
+    __m128 r3_c = _mm_shuffle_ps(r3, color, _MM_SHUFFLE(0, 0, 3, 3)); // r3.3 r3.3 c c
+
+    tilemap_store_sse2(output + 0, r0, is_streaming);
+    tilemap_store_sse2(output + 1, _mm_shuffle_ps(c_r1, r1, _MM_SHUFFLE(2, 1, 2, 0)), is_streaming);
+    tilemap_store_sse2(output + 2, _mm_shuffle_ps(r1_c, r2, _MM_SHUFFLE(1, 0, 2, 0)), is_streaming);
+    tilemap_store_sse2(output + 3, _mm_shuffle_ps(r2, c_r3, _MM_SHUFFLE(2, 0, 3, 2)), is_streaming);
+    tilemap_store_sse2(output + 4, _mm_shuffle_ps(r3, r3_c, _MM_SHUFFLE(2, 0, 2, 1)), is_streaming);
+}
 
-    // TODO(gr3yknigh1): Maybe make it signed? [2025/02/23]
-    if (cursor_index + offset < lexer->buffer_size) {
-        if (offset < 0) {
-            return Str8_View(lexer->cursor + offset, -offset);
-        } else if (offset > 0) {
-            return Str8_View(lexer->cursor, offset);
+//!
+//! @brief Generates `Vertex` quads of tiles `[first_col; first_col + count)` of the row, 4 at a time. Indexes of all 4
+//! tiles are checked against the UV table at once and UVs are loaded from it directly. Only if some index is out of
+//! the table, lanes take `tilemap_generation_get_uv`.
+//!
+//! @return Count of generated tiles.
+//!
+static Int32S
+tilemap_generate_span_sse2(
+    Vertex *vertexes, const Tilemap_Generation *generation, Int32S row_index, Int32S first_col, Int32S count)
+{
+    constexpr Int32S lanes_count = 4;
+
+    const Tilemap_Geometry *geometry = generation->geometry;
+    const Int32S *tile_indexes = generation->tilemap->indexes + row_index * generation->tilemap->col_count;
+
+    Int32S tiles_count = count / lanes_count * lanes_count;
+
+    // NOTE(gr3yknigh1): Same expressions as `tilemap_geometry_generate_tile` computes, so results are bit-exact. [2026/10/17]
+    Float32 y = geometry->origin_y + row_index * TILEMAP_TILE_SIZE;
+
+    __m128 origin_x = _mm_set1_ps(geometry->origin_x);
+    __m128 tile_size = _mm_set1_ps(TILEMAP_TILE_SIZE);
+    __m128 color = _mm_castsi128_ps(_mm_set1_epi32(static_cast<Int32S>(
+        pack_rgba_to_int(geometry->color.r, geometry->color.g, geometry->color.b, geometry->color.a))));
+
+    __m128i cols = _mm_add_epi32(_mm_set1_epi32(first_col), _mm_setr_epi32(0, 1, 2, 3));
+    __m128i table_count = _mm_set1_epi32(static_cast<Int32S>(generation->table->count));
+
+    __m128 *output = reinterpret_cast<__m128 *>(vertexes);
+
+    for (Int32S tile = 0; tile < tiles_count; tile += lanes_count) {
+        __m128 p0 = _mm_add_ps(origin_x, _mm_mul_ps(_mm_cvtepi32_ps(cols), tile_size));
+        __m128 p1 = _mm_set1_ps(y);
+        __m128 p2 = _mm_add_ps(p0, tile_size);
+        __m128 p3 = _mm_set1_ps(y + TILEMAP_TILE_SIZE);
+        _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+
+        __m128 positions[lanes_count] = { p0, p1, p2, p3 };
+
+        const Int32S *lane_indexes = tile_indexes + first_col + tile;
+
+        if (tilemap_is_in_table_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(lane_indexes)), table_count)) {
+            const Float32 *table_uvs = generation->table->uvs;
+
+            // NOTE(gr3yknigh1): Each quad is stored right after it's UV load. When all 4 UVs were loaded upfront,
+            // compiler interleaved stores of different quads, and non-temporal stores went ~2 times slower. [2026/10/17]
+            for (Int32S lane_index = 0; lane_index < lanes_count; ++lane_index) {
+                __m128 uv = _mm_load_ps(table_uvs + static_cast<SizeU>(lane_indexes[lane_index]) * 4);
+                tilemap_store_quad_sse2(output + lane_index * 5, positions[lane_index], uv, color, generation->is_streaming);
+            }
+        } else {
+            for (Int32S lane_index = 0; lane_index < lanes_count; ++lane_index) {
+                alignas(16) Float32 scratch[4];
+                __m128 uv = _mm_load_ps(tilemap_generation_get_uv(generation, lane_indexes[lane_index], scratch));
+                tilemap_store_quad_sse2(output + lane_index * 5, positions[lane_index], uv, color, generation->is_streaming);
+            }
         }
+
+        output += 5 * lanes_count;
+
+        cols = _mm_add_epi32(cols, _mm_set1_epi32(lanes_count));
     }
 
-    return Str8_View();  // do a better job next time
+    return tiles_count;
 }
 
-bool
-lexer_check_peeked(Lexer *lexer, const char *s)
+//!
+//! @brief Narrows 32-bit lanes, which fit into `Int16U`, to 16 bits. SSE2 has only signed saturation, so values are
+//! biased into signed range and back.
+//!
+static inline __m128i
+tilemap_pack_u16_sse2(__m128i low, __m128i high)
 {
-    Str8_View sv{s};
-    return lexer_check_peeked(lexer, sv);
+    __m128i bias = _mm_set1_epi32(32768);
+    __m128i packed = _mm_packs_epi32(_mm_sub_epi32(low, bias), _mm_sub_epi32(high, bias));
+
+    return _mm_xor_si128(packed, _mm_set1_epi16(static_cast<Int16S>(0x8000)));
 }
 
-bool
-lexer_check_peeked(Lexer *lexer, Str8_View sv)
+//!
+//! @brief Writes `Packed_Vertex` quad as 3 vectors: `xy0 st0 c xy1 | st1 c xy2 st2 | c xy3 st3 c`.
+//!
+//! @param[in] position 16-bit corners of the tile in low half: `x, y, x1, y1`.
+//! @param[in] uv 16-bit UVs in low half: `s0, t0, s1, t1`.
+//!
+static inline void
+tilemap_store_packed_quad_sse2(__m128 *output, __m128i position, __m128i uv, __m128i color, bool is_streaming)
 {
-    Str8_View peek_view{lexer_peek_view(lexer, static_cast<int32_t>(sv.length))};
-    return str8_view_is_equals(peek_view, sv);
+    // NOTE(gr3yknigh1): Words of corners in order of `generate_quad_with_atlas`: (x, y) (x1, y) (x1, y1) (x, y1). [2026/10/17]
+    __m128i xy = _mm_unpacklo_epi64(position, position);
+    xy = _mm_shufflehi_epi16(_mm_shufflelo_epi16(xy, _MM_SHUFFLE(1, 2, 1, 0)), _MM_SHUFFLE(3, 0, 3, 2));
+
+    __m128i st = _mm_unpacklo_epi64(uv, uv);
+    st = _mm_shufflehi_epi16(_mm_shufflelo_epi16(st, _MM_SHUFFLE(1, 2, 1, 0)), _MM_SHUFFLE(3, 0, 3, 2));
+
+    __m128 xy_st_low = _mm_castsi128_ps(_mm_unpacklo_epi32(xy, st));      // xy0 st0 xy1 st1
+    __m128 xy_st_high = _mm_castsi128_ps(_mm_unpackhi_epi32(xy, st));     // xy2 st2 xy3 st3
+    __m128 c_xy_low = _mm_castsi128_ps(_mm_unpacklo_epi32(color, xy));    // c xy0 c xy1
+    __m128 c_xy_high = _mm_castsi128_ps(_mm_unpackhi_epi32(color, xy));   // c xy2 c xy3
+    __m128 st_c_low = _mm_castsi128_ps(_mm_unpacklo_epi32(st, color));    // st0 c st1 c
+    __m128 st_c_high = _mm_castsi128_ps(_mm_unpackhi_epi32(st, color));   // st2 c st3 c
+
+    tilemap_store_sse2(output + 0, _mm_shuffle_ps(xy_st_low, c_xy_low, _MM_SHUFFLE(3, 2, 1, 0)), is_streaming);
+    tilemap_store_sse2(output + 1, _mm_shuffle_ps(st_c_low, xy_st_high, _MM_SHUFFLE(1, 0, 3, 2)), is_streaming);
+    tilemap_store_sse2(output + 2, _mm_shuffle_ps(c_xy_high, st_c_high, _MM_SHUFFLE(3, 2, 3, 2)), is_streaming);
 }
 
-Str8_View
-lexer_skip_until(Lexer *lexer, char c)
+//!
+//! @brief Same as `tilemap_generate_span_sse2`, but writes `Packed_Vertex` quads relative to `origin` (bounds of the
+//! chunk), like `pack_vertexes` does.
+//!
+static Int32S
+tilemap_generate_packed_span_sse2(
+    Packed_Vertex *vertexes, const Tilemap_Generation *generation, Int32S row_index, Int32S first_col, Int32S count,
+    Rect_F32 origin)
 {
-    Str8_View ret{};
+    constexpr Int32S lanes_count = 4;
 
-    ret.data = lexer->cursor;
+    const Tilemap_Geometry *geometry = generation->geometry;
+    const Int32S *tile_indexes = generation->tilemap->indexes + row_index * generation->tilemap->col_count;
 
-    while (!lexer_is_end(lexer) && lexer->lexeme != c) {
-        lexer_advance(lexer);
-        ret.length++;
+    Int32S tiles_count = count / lanes_count * lanes_count;
+
+    Float32 y = geometry->origin_y + row_index * TILEMAP_TILE_SIZE;
+
+    __m128 origin_x = _mm_set1_ps(geometry->origin_x);
+    __m128 tile_size = _mm_set1_ps(TILEMAP_TILE_SIZE);
+    __m128 half = _mm_set1_ps(0.5f);
+    __m128 chunk_x = _mm_set1_ps(origin.x);
+    __m128i color = _mm_set1_epi32(static_cast<Int32S>(
+        pack_rgba_to_int(geometry->color.r, geometry->color.g, geometry->color.b, geometry->color.a)));
+
+    // NOTE(gr3yknigh1): Rows of the span share `y`, so it's rounded once. [2026/10/17]
+    __m128i y0 = _mm_cvttps_epi32(_mm_add_ps(_mm_sub_ps(_mm_set1_ps(y), _mm_set1_ps(origin.y)), half));
+    __m128i y1 = _mm_cvttps_epi32(_mm_add_ps(_mm_sub_ps(_mm_set1_ps(y + TILEMAP_TILE_SIZE), _mm_set1_ps(origin.y)), half));
+
+    __m128i cols = _mm_add_epi32(_mm_set1_epi32(first_col), _mm_setr_epi32(0, 1, 2, 3));
+    __m128i table_count = _mm_set1_epi32(static_cast<Int32S>(generation->table->count));
+
+    __m128 *output = reinterpret_cast<__m128 *>(vertexes);
+
+    for (Int32S tile = 0; tile < tiles_count; tile += lanes_count) {
+        const Int32S *lane_indexes = tile_indexes + first_col + tile;
+
+        __m128i uvs[lanes_count];
+
+        if (tilemap_is_in_table_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(lane_indexes)), table_count)) {
+            const Int16U *table_uvs = generation->table->packed_uvs;
+
+            uvs[0] = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(table_uvs + static_cast<SizeU>(lane_indexes[0]) * 4));
+            uvs[1] = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(table_uvs + static_cast<SizeU>(lane_indexes[1]) * 4));
+            uvs[2] = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(table_uvs + static_cast<SizeU>(lane_indexes[2]) * 4));
+            uvs[3] = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(table_uvs + static_cast<SizeU>(lane_indexes[3]) * 4));
+        } else {
+            for (Int32S lane_index = 0; lane_index < lanes_count; ++lane_index) {
+                alignas(16) Int16U scratch[4];
+                const Int16U *uv = tilemap_generation_get_packed_uv(generation, lane_indexes[lane_index], scratch);
+                uvs[lane_index] = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(uv));
+            }
+        }
+
+        __m128 xs = _mm_add_ps(origin_x, _mm_mul_ps(_mm_cvtepi32_ps(cols), tile_size));
+        __m128 x1s = _mm_add_ps(xs, tile_size);
+
+        __m128i x0 = _mm_cvttps_epi32(_mm_add_ps(_mm_sub_ps(xs, chunk_x), half));
+        __m128i x1 = _mm_cvttps_epi32(_mm_add_ps(_mm_sub_ps(x1s, chunk_x), half));
+
+        __m128i xy0_low = _mm_unpacklo_epi32(x0, y0);  // x0.0 y0 x0.1 y0
+        __m128i xy1_low = _mm_unpacklo_epi32(x1, y1);  // x1.0 y1 x1.1 y1
+        __m128i xy0_high = _mm_unpackhi_epi32(x0, y0); // x0.2 y0 x0.3 y0
+        __m128i xy1_high = _mm_unpackhi_epi32(x1, y1); // x1.2 y1 x1.3 y1
+
+        __m128i positions01 = tilemap_pack_u16_sse2(_mm_unpacklo_epi64(xy0_low, xy1_low), _mm_unpackhi_epi64(xy0_low, xy1_low));
+        __m128i positions23 = tilemap_pack_u16_sse2(_mm_unpacklo_epi64(xy0_high, xy1_high), _mm_unpackhi_epi64(xy0_high, xy1_high));
+
+        tilemap_store_packed_quad_sse2(output + 0, positions01, uvs[0], color, generation->is_streaming);
+        tilemap_store_packed_quad_sse2(output + 3, _mm_unpackhi_epi64(positions01, positions01), uvs[1], color, generation->is_streaming);
+        tilemap_store_packed_quad_sse2(output + 6, positions23, uvs[2], color, generation->is_streaming);
+        tilemap_store_packed_quad_sse2(output + 9, _mm_unpackhi_epi64(positions23, positions23), uvs[3], color, generation->is_streaming);
+        output += 3 * lanes_count;
+
+        cols = _mm_add_epi32(cols, _mm_set1_epi32(lanes_count));
     }
 
-    return ret;
+    return tiles_count;
 }
 
-Str8_View
-lexer_skip_until(Lexer *lexer, Str8_View sv)
+#endif // NOC_DETECT_ARCH_X86_64
+
+static const Tilemap_Chunk *
+tilemap_geometry_get_chunk(const Tilemap_Geometry *geometry, Int32S col_index, Int32S row_index)
 {
-    Str8_View ret{};
+    Int32S chunk_col = col_index / TILEMAP_CHUNK_TILE_COUNT;
+    Int32S chunk_row = row_index / TILEMAP_CHUNK_TILE_COUNT;
 
-    if (sv.empty()) {
-        return ret;
+    return geometry->chunks + chunk_row * geometry->chunk_col_count + chunk_col;
+}
+
+static Int32U
+tilemap_geometry_get_first_vertex(const Tilemap_Geometry *geometry, Int32S col_index, Int32S row_index)
+{
+    const Tilemap_Chunk *chunk = tilemap_geometry_get_chunk(geometry, col_index, row_index);
+
+    Int32S chunk_col = col_index / TILEMAP_CHUNK_TILE_COUNT;
+    Int32S chunk_width = glm::min(TILEMAP_CHUNK_TILE_COUNT, geometry->col_count - chunk_col * TILEMAP_CHUNK_TILE_COUNT);
+
+    Int32S tile_in_chunk = (row_index % TILEMAP_CHUNK_TILE_COUNT) * chunk_width + col_index % TILEMAP_CHUNK_TILE_COUNT;
+
+    return chunk->first_vertex + static_cast<Int32U>(tile_in_chunk) * QUAD_VERTEX_COUNT;
+}
+
+//!
+//! @brief Writes quad of the tile in the geometry's format. Chunk of the tile should have bounds already.
+//!
+static void
+tilemap_geometry_generate_tile(Tilemap_Geometry *geometry, Tilemap *tilemap, Int32S col_index, Int32S row_index)
+{
+    Float32 tile_x = geometry->origin_x + col_index * TILEMAP_TILE_SIZE;
+    Float32 tile_y = geometry->origin_y + row_index * TILEMAP_TILE_SIZE;
+
+    Int32U first_vertex = tilemap_geometry_get_first_vertex(geometry, col_index, row_index);
+
+    Vertex quad[QUAD_VERTEX_COUNT];
+    generate_quad_with_atlas(
+        quad, tile_x, tile_y, TILEMAP_TILE_SIZE, TILEMAP_TILE_SIZE, tilemap_get_tile_location(tilemap, col_index, row_index),
+        &geometry->atlas, geometry->color);
+
+    if (geometry->format == Vertex_Format::Packed) {
+        const Tilemap_Chunk *chunk = tilemap_geometry_get_chunk(geometry, col_index, row_index);
+        pack_vertexes(geometry->vertexes.packed + first_vertex, quad, QUAD_VERTEX_COUNT, chunk->bounds.x, chunk->bounds.y);
+    } else {
+        noc_memory_copy(geometry->vertexes.regular + first_vertex, quad, sizeof(quad));
     }
+}
 
-    ret.data = lexer->cursor;
+//!
+//! @brief Writes quads of tiles `[first_col; end_col)` of the row, which should be in single chunk. Tiles are taken by
+//! SIMD kernel 4 at a time, rest is generated one by one (see `tilemap_geometry_generate_tile`).
+//!
+static void
+tilemap_generate_span(
+    const Tilemap_Generation *generation, [[maybe_unused]] const Tilemap_Chunk *chunk, Int32S row_index, Int32S first_col,
+    Int32S end_col)
+{
+    Tilemap_Geometry *geometry = generation->geometry;
 
-    while (!lexer_is_end(lexer) && !lexer_check_peeked(lexer, sv)) {
-        lexer_advance(lexer);
-        ret.length++;
+    Int32S generated_count = 0;
+
+#if NOC_DETECT_ARCH_X86_64
+    if (noc_memory_get_simd_level() != NOC_MEMORY_SIMD_LEVEL_NONE) {
+        Int32U first_vertex = tilemap_geometry_get_first_vertex(geometry, first_col, row_index);
+
+        if (geometry->format == Vertex_Format::Packed) {
+            generated_count = tilemap_generate_packed_span_sse2(
+                geometry->vertexes.packed + first_vertex, generation, row_index, first_col, end_col - first_col,
+                chunk->bounds);
+        } else {
+            generated_count = tilemap_generate_span_sse2(
+                geometry->vertexes.regular + first_vertex, generation, row_index, first_col, end_col - first_col);
+        }
     }
+#endif
 
-    return ret;
+    for (Int32S col_index = first_col + generated_count; col_index < end_col; ++col_index) {
+        tilemap_geometry_generate_tile(geometry, generation->tilemap, col_index, row_index);
+    }
 }
 
-
-Str8_View
-lexer_skip_until_endline(Lexer *lexer)
+bool
+make_tilemap_geometry(
+    Tilemap_Geometry *geometry, Tilemap *tilemap, Float32 origin_x, Float32 origin_y, Color4 color, Atlas *atlas,
+    Vertex_Format format)
 {
-    Str8_View ret;
+    assert(geometry && tilemap && atlas);
 
-    ret.data = lexer->cursor;
+    noxx::zero_type(geometry);
 
-    bool is_crlf = false;
+    geometry->format = format;
 
-    while (!lexer_is_end(lexer) && !lexer_is_endline(lexer, &is_crlf)) {
-        lexer_advance(lexer);
-        ret.length++;
+    geometry->chunk_row_count = (tilemap->row_count + TILEMAP_CHUNK_TILE_COUNT - 1) / TILEMAP_CHUNK_TILE_COUNT;
+    geometry->chunk_col_count = (tilemap->col_count + TILEMAP_CHUNK_TILE_COUNT - 1) / TILEMAP_CHUNK_TILE_COUNT;
+
+    geometry->row_count = tilemap->row_count;
+    geometry->col_count = tilemap->col_count;
+    geometry->origin_x = origin_x;
+    geometry->origin_y = origin_y;
+    geometry->color = color;
+    geometry->atlas = *atlas;
+
+    geometry->chunks = mm::allocate_structs<Tilemap_Chunk>(geometry->chunk_row_count * geometry->chunk_col_count);
+    geometry->vertexes.data = mm::allocate(tilemap->tiles_count() * QUAD_VERTEX_COUNT * vertex_format_get_size(format));
+    geometry->indexes = mm::allocate_structs<Int32U>(tilemap->tiles_count() * QUAD_INDEX_COUNT);
+
+    geometry->dirty_marks = mm::allocate_structs<Int64U>((tilemap->tiles_count() + 63) / 64, ALLOCATE_ZERO_MEMORY);
+    geometry->dirty_tiles = mm::allocate_structs<Int32U>(TILEMAP_MAX_DIRTY_TILES);
+    geometry->dirty_ranges = mm::allocate_structs<Tilemap_Dirty_Range>(TILEMAP_MAX_DIRTY_TILES);
+
+    if (geometry->chunks == nullptr || geometry->vertexes.data == nullptr || geometry->indexes == nullptr ||
+        geometry->dirty_marks == nullptr || geometry->dirty_tiles == nullptr || geometry->dirty_ranges == nullptr) {
+        tilemap_geometry_destroy(geometry);
+        return false;
     }
 
-    if (is_crlf) {
-        lexer_advance(lexer);
-        lexer_advance(lexer);
-    } else {
-        lexer_advance(lexer);
+    // NOTE(gr3yknigh1): SIMD kernels store whole vectors, quads are multiple of 16 bytes in both formats. [2026/10/17]
+    assert(reinterpret_cast<SizeU>(geometry->vertexes.data) % 16 == 0);
+
+    Tilemap_Chunk *chunk = geometry->chunks;
+
+    for (Int32S chunk_row = 0; chunk_row < geometry->chunk_row_count; ++chunk_row) {
+        for (Int32S chunk_col = 0; chunk_col < geometry->chunk_col_count; ++chunk_col, ++chunk) {
+            Int32S first_col = chunk_col * TILEMAP_CHUNK_TILE_COUNT;
+            Int32S first_row = chunk_row * TILEMAP_CHUNK_TILE_COUNT;
+            Int32S last_col = glm::min(first_col + TILEMAP_CHUNK_TILE_COUNT, tilemap->col_count);
+            Int32S last_row = glm::min(first_row + TILEMAP_CHUNK_TILE_COUNT, tilemap->row_count);
+
+            chunk->bounds.x = origin_x + first_col * TILEMAP_TILE_SIZE;
+            chunk->bounds.y = origin_y + first_row * TILEMAP_TILE_SIZE;
+            chunk->bounds.width = (last_col - first_col) * TILEMAP_TILE_SIZE;
+            chunk->bounds.height = (last_row - first_row) * TILEMAP_TILE_SIZE;
+
+            chunk->first_vertex = geometry->vertexes_count;
+            chunk->vertexes_count = (last_row - first_row) * (last_col - first_col) * QUAD_VERTEX_COUNT;
+
+            geometry->vertexes_count += chunk->vertexes_count;
+        }
     }
 
-    return ret;
+    Tilemap_UV_Table table{};
+
+    if (!make_tilemap_uv_table(&table, tilemap, atlas)) {
+        tilemap_geometry_destroy(geometry);
+        return false;
+    }
+
+    tilemap_geometry_generate(geometry, tilemap, &table);
+
+    tilemap_uv_table_destroy(&table);
+
+    geometry->indexes_count = static_cast<Int32U>(tilemap->tiles_count()) * QUAD_INDEX_COUNT;
+    generate_quad_indexes(geometry->indexes, static_cast<Int32U>(tilemap->tiles_count()));
+
+    return true;
 }
 
-bool
-lexer_is_endline(Lexer *lexer, bool *is_crlf)
+void
+tilemap_geometry_generate(Tilemap_Geometry *geometry, Tilemap *tilemap, const Tilemap_UV_Table *table)
 {
-    if (is_crlf != nullptr) {
-        *is_crlf = (lexer->cursor[0] == '\r' && lexer->cursor[1] == '\n');
+    assert(geometry && tilemap && table);
+    assert(geometry->row_count == tilemap->row_count && geometry->col_count == tilemap->col_count);
+
+    Tilemap_Generation generation{};
+    generation.geometry = geometry;
+    generation.tilemap = tilemap;
+    generation.table = table;
+    generation.is_streaming = static_cast<SizeU>(geometry->vertexes_count) * vertex_format_get_size(geometry->format) >= NOC_MEMORY_NON_TEMPORAL_THRESHOLD;
+
+    const Tilemap_Chunk *chunk = geometry->chunks;
+
+    for (Int32S chunk_row = 0; chunk_row < geometry->chunk_row_count; ++chunk_row) {
+        for (Int32S chunk_col = 0; chunk_col < geometry->chunk_col_count; ++chunk_col, ++chunk) {
+            Int32S first_col = chunk_col * TILEMAP_CHUNK_TILE_COUNT;
+            Int32S first_row = chunk_row * TILEMAP_CHUNK_TILE_COUNT;
+            Int32S last_col = glm::min(first_col + TILEMAP_CHUNK_TILE_COUNT, tilemap->col_count);
+            Int32S last_row = glm::min(first_row + TILEMAP_CHUNK_TILE_COUNT, tilemap->row_count);
+
+            for (Int32S row_index = first_row; row_index < last_row; ++row_index) {
+                tilemap_generate_span(&generation, chunk, row_index, first_col, last_col);
+            }
+        }
     }
-    return lexer->lexeme == '\n' || (lexer->cursor[0] == '\r' && lexer->cursor[1] == '\n');
+
+#if NOC_DETECT_ARCH_X86_64
+    if (generation.is_streaming) {
+        _mm_sfence();
+    }
+#endif
 }
 
 void
-lexer_skip_whitespace(Lexer *lexer)
+tilemap_geometry_destroy(Tilemap_Geometry *geometry)
 {
-    while (!lexer_is_end(lexer) && isspace(lexer->lexeme)) {
-        lexer_advance(lexer);
+    assert(geometry);
+
+    mm::deallocate(geometry->chunks);
+    mm::deallocate(geometry->vertexes.data);
+    mm::deallocate(geometry->indexes);
+    mm::deallocate(geometry->dirty_marks);
+    mm::deallocate(geometry->dirty_tiles);
+    mm::deallocate(geometry->dirty_ranges);
+
+    noxx::zero_type(geometry);
+}
+
+Int32U
+tilemap_geometry_cull(
+    const Tilemap_Geometry *geometry, Rect_F32 view, Tilemap_Draw_Range *ranges, [[maybe_unused]] Int32U ranges_capacity)
+{
+    assert(geometry);
+
+    if (geometry->chunks == nullptr) {
+        return 0;
+    }
+
+    assert(ranges);
+
+    //
+    // NOTE(gr3yknigh1): All chunks, except the edge ones, have same size, so range of overlapped chunks is computed
+    // from the first chunk's origin. [2026/10/17]
+    //
+    const Tilemap_Chunk *origin = geometry->chunks;
+    constexpr Float32 chunk_size = TILEMAP_CHUNK_TILE_COUNT * TILEMAP_TILE_SIZE;
+
+    Int32S first_col = glm::max(static_cast<Int32S>(floorf((view.x - origin->bounds.x) / chunk_size)), 0);
+    Int32S first_row = glm::max(static_cast<Int32S>(floorf((view.y - origin->bounds.y) / chunk_size)), 0);
+    Int32S last_col = glm::min(static_cast<Int32S>(ceilf((view.x + view.width - origin->bounds.x) / chunk_size)), geometry->chunk_col_count);
+    Int32S last_row = glm::min(static_cast<Int32S>(ceilf((view.y + view.height - origin->bounds.y) / chunk_size)), geometry->chunk_row_count);
+
+    Int32U ranges_count = 0;
+
+    //
+    // NOTE(gr3yknigh1): Quads are stored one after another, so quad's indexes are at the same position as it's
+    // vertexes, scaled by `QUAD_INDEX_COUNT / QUAD_VERTEX_COUNT`. [2026/10/17]
+    //
+    for (Int32S chunk_row = first_row; chunk_row < last_row; ++chunk_row) {
+        const Tilemap_Chunk *row = geometry->chunks + chunk_row * geometry->chunk_col_count;
+
+        for (Int32S chunk_col = first_col; chunk_col < last_col; ++chunk_col) {
+            const Tilemap_Chunk *first = row + chunk_col;
+            const Tilemap_Chunk *last = first;
+
+            if (geometry->format == Vertex_Format::Regular) {
+                last = row + last_col - 1;
+                chunk_col = last_col;
+            }
+
+            assert(ranges_count < ranges_capacity);
+
+            Tilemap_Draw_Range *range = ranges + ranges_count++;
+            range->first_index = first->first_vertex / QUAD_VERTEX_COUNT * QUAD_INDEX_COUNT;
+            range->indexes_count = (last->first_vertex + last->vertexes_count - first->first_vertex) / QUAD_VERTEX_COUNT * QUAD_INDEX_COUNT;
+            range->origin_x = geometry->format == Vertex_Format::Packed ? first->bounds.x : 0;
+            range->origin_y = geometry->format == Vertex_Format::Packed ? first->bounds.y : 0;
+        }
+    }
+
+    return ranges_count;
+}
+
+int
+get_offset_from_coords_of_2d_grid_array_rm(int width, int x, int y)
+{
+    return width * y + x;
+}
+
+Camera
+make_camera(Camera_ViewMode view_mode)
+{
+    Camera camera{};
+
+    camera.position = {0, 0, 3.0f};
+    camera.front = {0, 0, -1.0f};
+    camera.up = {0, 1.0f, 0};
+
+    camera.yaw = -90.0f;
+    camera.pitch = 0.0f;
+
+    camera.speed = 10.0f;
+    camera.sensitivity = 0.5f;
+    camera.fov = 45.0f;
+
+    camera.near = 0.1f;
+    camera.far = 100.0f;
+
+    camera.view_mode = view_mode;
+
+    return camera;
+}
+
+void
+camera_rotate(Camera *camera, float x_offset, float y_offset)
+{
+    x_offset *= camera->sensitivity;
+    y_offset *= camera->sensitivity;
+
+    camera->yaw += x_offset * 1;
+    camera->pitch += y_offset * -1;
+
+    camera->pitch = glm::clamp(camera->pitch, -89.0f, 89.0f);
+
+    float yaw_rad = glm::radians(camera->yaw);
+    float pitch_rad = glm::radians(camera->pitch);
+
+    glm::vec3 direction = LITERAL(glm::vec3) {
+        glm::cos(yaw_rad) * glm::cos(pitch_rad),
+        glm::sin(pitch_rad),
+        glm::sin(yaw_rad) * glm::cos(pitch_rad),
+    };
+    camera->front = glm::normalize(direction);
+}
+
+glm::mat4
+camera_get_view_matrix(Camera *camera)
+{
+    return glm::lookAt(
+        camera->position, camera->position + camera->front, camera->up);
+}
+
+glm::mat4
+camera_get_projection_matrix(Camera *camera, int viewport_width, int viewport_height)
+{
+    if (camera->view_mode == Camera_ViewMode::Perspective) {
+        return glm::perspective(
+            glm::radians(camera->fov),
+            (float)viewport_width / (float)viewport_height,
+            camera->near, camera->far);
+    }
+
+    if (camera->view_mode == Camera_ViewMode::Orthogonal) {
+        return glm::ortho(
+            0.0f, (float)viewport_width,
+            0.0f, (float)viewport_height,
+            camera->near, camera->far);
+    }
+
+    assert(false); // TODO(i.akkuzin): Implement DIE macro [2025/02/09]
+    exit(1);
+}
+
+void
+tilemap_set_tile(Tilemap_Geometry *geometry, Tilemap *tilemap, Int32S col_index, Int32S row_index, Int32S tile_index)
+{
+    assert(geometry && tilemap);
+    assert(geometry->col_count == tilemap->col_count && geometry->row_count == tilemap->row_count);
+    assert(col_index >= 0 && col_index < tilemap->col_count && row_index >= 0 && row_index < tilemap->row_count);
+
+    Int32U tile_offset = static_cast<Int32U>(get_offset_from_coords_of_2d_grid_array_rm(tilemap->col_count, col_index, row_index));
+
+    if (tilemap->indexes[tile_offset] == tile_index) {
+        return;
+    }
+
+    //
+    // NOTE(gr3yknigh1): Mapped tilemaps (binary files and archives) are private mappings, so writing here doesn't
+    // change the file. [2026/10/17]
+    //
+    tilemap->indexes[tile_offset] = tile_index;
+
+    tilemap_geometry_generate_tile(geometry, tilemap, col_index, row_index);
+
+    Int64U mark = 1ULL << (tile_offset % 64);
+
+    if (geometry->is_all_dirty || (geometry->dirty_marks[tile_offset / 64] & mark) != 0) {
+        return;
+    }
+
+    if (geometry->dirty_tiles_count == TILEMAP_MAX_DIRTY_TILES) {
+        geometry->is_all_dirty = true;
+        return;
+    }
+
+    geometry->dirty_marks[tile_offset / 64] |= mark;
+    geometry->dirty_tiles[geometry->dirty_tiles_count++] = tile_offset;
+}
+
+static int
+compare_int32u(const void *a, const void *b)
+{
+    Int32U x = *static_cast<const Int32U *>(a);
+    Int32U y = *static_cast<const Int32U *>(b);
+    return (x > y) - (x < y);
+}
+
+Int32U
+tilemap_geometry_flush_dirty(Tilemap_Geometry *geometry)
+{
+    assert(geometry);
+
+    geometry->dirty_ranges_count = 0;
+
+    //
+    // NOTE(gr3yknigh1): Offsets of tiles are replaced by their first vertexes in place, so after sorting tiles which
+    // are neighbours in the buffer get merged. [2026/10/17]
+    //
+    for (Int32U dirty_index = 0; dirty_index < geometry->dirty_tiles_count; ++dirty_index) {
+        Int32U tile_offset = geometry->dirty_tiles[dirty_index];
+
+        geometry->dirty_marks[tile_offset / 64] = 0;
+        geometry->dirty_tiles[dirty_index] = tilemap_geometry_get_first_vertex(
+            geometry, static_cast<Int32S>(tile_offset % geometry->col_count), static_cast<Int32S>(tile_offset / geometry->col_count));
+    }
+
+    if (geometry->is_all_dirty) {
+        Tilemap_Dirty_Range *range = geometry->dirty_ranges + geometry->dirty_ranges_count++;
+        range->offset = 0;
+        range->size = geometry->vertexes_count * vertex_format_get_size(geometry->format);
+    } else if (geometry->dirty_tiles_count > 0) {
+        qsort(geometry->dirty_tiles, geometry->dirty_tiles_count, sizeof(*geometry->dirty_tiles), compare_int32u);
+
+        SizeU vertex_size = vertex_format_get_size(geometry->format);
+        SizeU tile_size = QUAD_VERTEX_COUNT * vertex_size;
+
+        for (Int32U dirty_index = 0; dirty_index < geometry->dirty_tiles_count; ++dirty_index) {
+            SizeU offset = geometry->dirty_tiles[dirty_index] * vertex_size;
+            Tilemap_Dirty_Range *last = geometry->dirty_ranges + geometry->dirty_ranges_count - 1;
+
+            if (geometry->dirty_ranges_count > 0 && last->offset + last->size == offset) {
+                last->size += tile_size;
+            } else {
+                Tilemap_Dirty_Range *range = geometry->dirty_ranges + geometry->dirty_ranges_count++;
+                range->offset = offset;
+                range->size = tile_size;
+            }
+        }
+    }
+
+    geometry->dirty_tiles_count = 0;
+    geometry->is_all_dirty = false;
+
+    return geometry->dirty_ranges_count;
+}
+
+//
+// Sorting:
+//
+
+Sort_Item *
+radix_sort(Sort_Item *items, Sort_Item *scratch, SizeU count)
+{
+    assert((items && scratch) || count == 0);
+
+    constexpr Int32U bytes_count = sizeof(Int64U);
+    constexpr Int32U buckets_count = 256;
+
+    //
+    // NOTE(gr3yknigh1): Counts fit into 32 bits, batches are much smaller than that. [2026/10/17]
+    //
+    assert(count <= 0xFFFFFFFF);
+
+    Int32U histograms[bytes_count][buckets_count] = {};
+
+    for (SizeU item_index = 0; item_index < count; ++item_index) {
+        Int64U key = items[item_index].key;
+
+        for (Int32U byte_index = 0; byte_index < bytes_count; ++byte_index) {
+            ++histograms[byte_index][(key >> (byte_index * 8)) & 0xFF];
+        }
+    }
+
+    Sort_Item *source = items;
+    Sort_Item *destination = scratch;
+
+    for (Int32U byte_index = 0; byte_index < bytes_count && count > 0; ++byte_index) {
+        Int32U *histogram = histograms[byte_index];
+        Int32U shift = byte_index * 8;
+
+        if (histogram[(source[0].key >> shift) & 0xFF] == count) {
+            continue;
+        }
+
+        Int32U offset = 0;
+
+        for (Int32U bucket_index = 0; bucket_index < buckets_count; ++bucket_index) {
+            Int32U bucket_count = histogram[bucket_index];
+            histogram[bucket_index] = offset;
+            offset += bucket_count;
+        }
+
+        for (SizeU item_index = 0; item_index < count; ++item_index) {
+            destination[histogram[(source[item_index].key >> shift) & 0xFF]++] = source[item_index];
+        }
+
+        Sort_Item *sorted = destination;
+        destination = source;
+        source = sorted;
+    }
+
+    return source;
+}
+
+//
+// Sprite batching:
+//
+
+Int64U
+make_sprite_sort_key(Int8U layer, Sprite_State state, Float32 depth)
+{
+    constexpr Int64U slot_mask = (1 << SPRITE_SORT_KEY_SLOT_BITS) - 1;
+
+    assert(state.shader.index() <= slot_mask && state.texture.index() <= slot_mask);
+
+    //
+    // NOTE(gr3yknigh1): Float bits are ordered as unsigned integer after flipping: sign bit of positive numbers, all
+    // bits of negative ones. Result is inverted once more, so bigger depth goes first. [2026/10/17]
+    //
+    Int32U depth_bits = std::bit_cast<Int32U>(depth);
+    depth_bits = (depth_bits & 0x80000000) ? ~depth_bits : depth_bits | 0x80000000;
+
+    return static_cast<Int64U>(layer) << 56 | (state.shader.index() & slot_mask) << 44 |
+           (state.texture.index() & slot_mask) << 32 | static_cast<Int64U>(~depth_bits);
+}
+
+bool
+make_sprite_batch(Sprite_Batch *batch, Int32U capacity)
+{
+    assert(batch && capacity > 0);
+
+    *batch = {};
+    batch->capacity = capacity;
+    batch->indexes_count = capacity * QUAD_INDEX_COUNT;
+
+    batch->vertexes = mm::allocate_structs<Vertex>(capacity * QUAD_VERTEX_COUNT);
+    batch->sorted_vertexes = mm::allocate_structs<Vertex>(capacity * QUAD_VERTEX_COUNT);
+    batch->states = mm::allocate_structs<Sprite_State>(capacity);
+    batch->items = mm::allocate_structs<Sort_Item>(capacity);
+    batch->scratch_items = mm::allocate_structs<Sort_Item>(capacity);
+    batch->draws = mm::allocate_structs<Sprite_Draw>(capacity);
+    batch->indexes = mm::allocate_structs<Int32U>(batch->indexes_count);
+
+    if (batch->vertexes == nullptr || batch->sorted_vertexes == nullptr || batch->states == nullptr ||
+        batch->items == nullptr || batch->scratch_items == nullptr || batch->draws == nullptr || batch->indexes == nullptr) {
+        sprite_batch_destroy(batch);
+        return false;
+    }
+
+    generate_quad_indexes(batch->indexes, capacity);
+
+    return true;
+}
+
+void
+sprite_batch_destroy(Sprite_Batch *batch)
+{
+    assert(batch);
+
+    mm::deallocate(batch->vertexes);
+    mm::deallocate(batch->sorted_vertexes);
+    mm::deallocate(batch->states);
+    mm::deallocate(batch->items);
+    mm::deallocate(batch->scratch_items);
+    mm::deallocate(batch->draws);
+    mm::deallocate(batch->indexes);
+
+    *batch = {};
+}
+
+bool
+sprite_batch_push(Sprite_Batch *batch, const Sprite *sprite)
+{
+    assert(batch && sprite);
+
+    if (batch->sprites_count == batch->capacity) {
+        return false;
+    }
+
+    Int32U sprite_index = batch->sprites_count++;
+    Sprite_State state{ sprite->shader, sprite->texture };
+
+    Atlas atlas = sprite->atlas;
+    generate_quad_with_atlas(
+        batch->vertexes + sprite_index * QUAD_VERTEX_COUNT, sprite->rect.x, sprite->rect.y, sprite->rect.width,
+        sprite->rect.height, sprite->location, &atlas, sprite->color);
+
+    batch->states[sprite_index] = state;
+    batch->items[sprite_index].key = make_sprite_sort_key(sprite->layer, state, sprite->depth);
+    batch->items[sprite_index].value = sprite_index;
+
+    return true;
+}
+
+Int32U
+sprite_batch_build(Sprite_Batch *batch)
+{
+    assert(batch);
+
+    batch->draws_count = 0;
+
+    const Sort_Item *sorted_items = radix_sort(batch->items, batch->scratch_items, batch->sprites_count);
+
+    for (Int32U sorted_index = 0; sorted_index < batch->sprites_count; ++sorted_index) {
+        Int32U sprite_index = sorted_items[sorted_index].value;
+
+        noc_memory_copy(
+            batch->sorted_vertexes + sorted_index * QUAD_VERTEX_COUNT, batch->vertexes + sprite_index * QUAD_VERTEX_COUNT,
+            QUAD_VERTEX_COUNT * sizeof(Vertex));
+
+        //
+        // NOTE(gr3yknigh1): Neighbours are merged even if they are on different layers, order between them is kept
+        // by the order of indexes. [2026/10/17]
+        //
+        Sprite_Draw *last = batch->draws + batch->draws_count - 1;
+
+        if (batch->draws_count > 0 && last->state == batch->states[sprite_index]) {
+            last->indexes_count += QUAD_INDEX_COUNT;
+        } else {
+            Sprite_Draw *draw = batch->draws + batch->draws_count++;
+            draw->state = batch->states[sprite_index];
+            draw->first_index = sorted_index * QUAD_INDEX_COUNT;
+            draw->indexes_count = QUAD_INDEX_COUNT;
+        }
+    }
+
+    return batch->draws_count;
+}
+
+void
+sprite_batch_reset(Sprite_Batch *batch)
+{
+    assert(batch);
+
+    batch->sprites_count = 0;
+    batch->draws_count = 0;
+}
+
+Rect_F32
+camera_get_view_rect(Camera *camera, int viewport_width, int viewport_height)
+{
+    assert(camera && camera->view_mode == Camera_ViewMode::Orthogonal);
+
+    Rect_F32 view{};
+    view.x = -camera->position.x - viewport_width / 2;
+    view.y = -camera->position.y - viewport_height / 2;
+    view.width = static_cast<Float32>(viewport_width);
+    view.height = static_cast<Float32>(viewport_height);
+
+    return view;
+}
+
+void
+perf_block_record_print(const Perf_Block_Record *record)
+{
+    Int64S perf_frequency = perf_get_counter_frequency();
+
+    Int64S counter_elapsed = record->counter_end - record->counter_begin;
+    Int64S ms_elapsed = (1000 * counter_elapsed) / perf_frequency;
+    uint64_t cycles_elapsed = record->cycles_end - record->cycles_begin;
+    uint64_t mega_cycles_elapsed = cycles_elapsed / (1000 * 1000);
+
+    printf(
+        "PERF: %s:%" PRIu64 "@%s [%s]: counter = (%" PRId64 ") ms = (%" PRId64 ") | Mc = %" PRIu64 "\n", record->file_path,
+        record->line_number, record->function, record->label, counter_elapsed, ms_elapsed,
+        mega_cycles_elapsed);
+}
+
+Clock
+make_clock(void)
+{
+    Clock clock;
+    clock.ticks_begin = perf_get_counter();
+    clock.ticks_end = 0;
+    clock.frequency = perf_get_counter_frequency();
+    return clock;
+}
+
+
+double
+clock_tick(Clock *clock)
+{
+    clock->ticks_end = perf_get_counter();
+    double elapsed = (double)(clock->ticks_end - clock->ticks_begin) / (double)clock->frequency;
+    clock->ticks_begin = perf_get_counter();
+    return elapsed;
+}
+
+mm::Fixed_Arena
+mm::make_static_arena(SizeU capacity)
+{
+    Fixed_Arena arena;
+
+    arena.data     = allocate(capacity);
+    arena.capacity = capacity;
+    arena.occupied = 0;
+
+    return arena;
+}
+
+Lexer
+make_lexer(Char8 *buffer, SizeU buffer_size)
+{
+    Lexer lexer;
+
+    lexer.cursor = buffer;
+    lexer.lexeme = *buffer;
+
+    lexer.buffer = buffer;
+    lexer.buffer_size = buffer_size;
+
+    return lexer;
+}
+
+void
+lexer_advance(Lexer *lexer, int32_t count)
+{
+    size_t cursor_index = lexer->cursor - lexer->buffer;
+
+    if (lexer_is_end(lexer) && cursor_index + count < lexer->buffer_size) {
+        return;
+    }
+
+    while (count > 0) {
+        lexer->cursor++;
+        --count;
+    }
+
+    lexer->lexeme = *(lexer->cursor);
+}
+
+char
+lexer_peek(Lexer *lexer, int32_t offset)
+{
+    size_t cursor_index = lexer->cursor - lexer->buffer;
+
+    // TODO(gr3yknigh1): Maybe make it signed? [2025/02/23]
+    if (cursor_index + offset < lexer->buffer_size) {
+        char *peek = lexer->cursor + offset;
+        return *peek;
+    }
+
+    return 0;
+}
+
+Str8_View
+lexer_peek_view(Lexer *lexer, int32_t offset)
+{
+    size_t cursor_index = lexer->cursor - lexer->buffer;
+
+    // TODO(gr3yknigh1): Maybe make it signed? [2025/02/23]
+    if (cursor_index + offset < lexer->buffer_size) {
+        if (offset < 0) {
+            return Str8_View(lexer->cursor + offset, -offset);
+        } else if (offset > 0) {
+            return Str8_View(lexer->cursor, offset);
+        }
+    }
+
+    return Str8_View();  // do a better job next time
+}
+
+bool
+lexer_check_peeked(Lexer *lexer, const char *s)
+{
+    Str8_View sv{s};
+    return lexer_check_peeked(lexer, sv);
+}
+
+bool
+lexer_check_peeked(Lexer *lexer, Str8_View sv)
+{
+    Str8_View peek_view{lexer_peek_view(lexer, static_cast<int32_t>(sv.length))};
+    return str8_view_is_equals(peek_view, sv);
+}
+
+//
+// NOTE(gr3yknigh1): Skipping routines search with `noc_memory_find*`, which scans whole blocks of the buffer at a
+// time, and then jump the cursor directly to the match (or to the end of the buffer). [2026/10/17]
+//
+static void
+lexer_jump(Lexer *lexer, char *cursor)
+{
+    lexer->cursor = cursor;
+    lexer->lexeme = lexer_is_end(lexer) ? 0 : *cursor;
+}
+
+static SizeU
+lexer_remaining_size(Lexer *lexer)
+{
+    return lexer_is_end(lexer) ? 0 : lexer->buffer_size - static_cast<SizeU>(lexer->cursor - lexer->buffer);
+}
+
+Str8_View
+lexer_skip_until(Lexer *lexer, char c)
+{
+    Str8_View ret{};
+
+    ret.data = lexer->cursor;
+
+    SizeU remaining_size = lexer_remaining_size(lexer);
+    const char *found = static_cast<const char *>(noc_memory_find(lexer->cursor, remaining_size, static_cast<Byte>(c)));
+
+    ret.length = found != nullptr ? static_cast<SizeU>(found - lexer->cursor) : remaining_size;
+    lexer_jump(lexer, lexer->cursor + ret.length);
+
+    return ret;
+}
+
+Str8_View
+lexer_skip_until(Lexer *lexer, Str8_View sv)
+{
+    Str8_View ret{};
+
+    if (sv.empty()) {
+        return ret;
+    }
+
+    ret.data = lexer->cursor;
+
+    SizeU remaining_size = lexer_remaining_size(lexer);
+    const char *found = static_cast<const char *>(noc_memory_find_substring(lexer->cursor, remaining_size, sv.data, sv.length));
+
+    ret.length = found != nullptr ? static_cast<SizeU>(found - lexer->cursor) : remaining_size;
+    lexer_jump(lexer, lexer->cursor + ret.length);
+
+    return ret;
+}
+
+
+Str8_View
+lexer_skip_until_endline(Lexer *lexer)
+{
+    Str8_View ret;
+
+    ret.data = lexer->cursor;
+
+    SizeU remaining_size = lexer_remaining_size(lexer);
+    const char *found = static_cast<const char *>(noc_memory_find(lexer->cursor, remaining_size, '\n'));
+
+    if (found == nullptr) {
+        ret.length = remaining_size;
+        lexer_jump(lexer, lexer->cursor + remaining_size);
+        return ret;
+    }
+
+    ret.length = static_cast<SizeU>(found - lexer->cursor);
+
+    // NOTE(gr3yknigh1): CRLF is the same endline, `\r` is not part of the line. [2026/10/17]
+    if (ret.length > 0 && found[-1] == '\r') {
+        ret.length--;
+    }
+
+    lexer_jump(lexer, lexer->cursor + (found - lexer->cursor) + 1);
+
+    return ret;
+}
+
+bool
+lexer_is_endline(Lexer *lexer, bool *is_crlf)
+{
+    if (is_crlf != nullptr) {
+        *is_crlf = (lexer->cursor[0] == '\r' && lexer->cursor[1] == '\n');
+    }
+    return lexer->lexeme == '\n' || (lexer->cursor[0] == '\r' && lexer->cursor[1] == '\n');
+}
+
+void
+lexer_skip_whitespace(Lexer *lexer)
+{
+    while (!lexer_is_end(lexer) && isspace(lexer->lexeme)) {
+        lexer_advance(lexer);
+    }
+}
+
+bool
+lexer_is_end(Lexer *lexer)
+{
+    size_t cursor_index = lexer->cursor - lexer->buffer;
+    return cursor_index >= lexer->buffer_size;
+}
+
+
+bool
+lexer_parse_int(Lexer *lexer, int *result)
+{
+    // TODO(gr3yknigh1): Error handling [2025/02/23]
+
+    int num = 0;
+
+    bool is_negative = false;
+
+    if (lexer->lexeme == '-') {
+        is_negative = true;
+        lexer_advance(lexer);
+    }
+
+    while (lexer->lexeme && (lexer->lexeme >= '0' && lexer->lexeme <= '9')) {
+        num = num * 10 + (lexer->lexeme - '0');
+        lexer_advance(lexer);
+    }
+
+    if (is_negative) {
+        num = -1 * num;
+    }
+
+    *result = num;
+
+    return true;
+}
+
+bool
+lexer_parse_str_to_view(Lexer *lexer, Str8_View *sv)
+{
+    if (lexer->lexeme != '"') {
+        return false;
+    }
+
+    // NOTE(gr3yknigh1): Skipping '"' [2025/02/24]
+    lexer_advance(lexer); // TODO(gr3yknigh1): Wrap in `Lexer_AdvanceIf(Lexer *, int32_t count, char c)`
+
+    *sv = lexer_skip_until(lexer, '"');
+
+    // NOTE(gr3yknigh1): Skipping '"' [2025/02/24]
+    lexer_advance(lexer); // TODO(gr3yknigh1): Wrap in `lexer_advance_if(Lexer *, int32_t count, char c)`
+
+    return true;
+}
+
+bool
+lexer_check_peeked_and_advance(Lexer *lexer, Str8_View sv)
+{
+    if (lexer_check_peeked(lexer, sv)) {
+        lexer_advance(lexer, sv.length); // @cleanup
+        return true;
+    }
+    return false;
+}
+
+//
+// Tokenizer:
+//
+
+//!
+//! @brief Classes of 64 bytes starting from `base`, one bit per byte. Bits after the end of buffer are zero.
+//!
+struct Token_Window {
+    const char *base;
+
+    Int64U blank;
+    Int64U digit;
+    Int64U ident;
+    Int64U newline;
+};
+
+static inline bool token_is_digit(char c) { return c >= '0' && c <= '9'; }
+static inline bool token_is_ident_start(char c) { return (c | 0x20) >= 'a' && (c | 0x20) <= 'z'; }
+
+static inline bool
+token_is_ident(char c)
+{
+    return token_is_ident_start(c) || token_is_digit(c) || c == '_';
+}
+
+static inline bool
+token_is_blank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f' || c == '\0';
+}
+
+#if NOC_DETECT_ARCH_X86_64
+
+static inline Int32U
+token_mask_range(__m128i block, char low, char high)
+{
+    __m128i is_above = _mm_cmpeq_epi8(_mm_max_epu8(block, _mm_set1_epi8(low)), block);
+    __m128i is_below = _mm_cmpeq_epi8(_mm_min_epu8(block, _mm_set1_epi8(high)), block);
+    return static_cast<Int32U>(_mm_movemask_epi8(_mm_and_si128(is_above, is_below)));
+}
+
+static inline Int32U
+token_mask_equals(__m128i block, char c)
+{
+    return static_cast<Int32U>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8(c))));
+}
+
+#endif
+
+static void
+token_window_load(Token_Window *window, const char *base, const char *end)
+{
+    window->base = base;
+    window->blank = window->digit = window->ident = window->newline = 0;
+
+    SizeU size = static_cast<SizeU>(end - base);
+
+#if NOC_DETECT_ARCH_X86_64
+    // NOTE(gr3yknigh1): Last window of the buffer is classified byte by byte, so loads never go past the end. [2026/10/17]
+    if (size >= 64) {
+        for (SizeU block_index = 0; block_index < 4; ++block_index) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(base + block_index * 16));
+
+            Int32U digit = token_mask_range(block, '0', '9');
+            Int32U newline = token_mask_equals(block, '\n');
+            Int32U blank = token_mask_equals(block, ' ') | token_mask_equals(block, '\0') | (token_mask_range(block, '\t', '\r') & ~newline);
+            Int32U ident = token_mask_range(_mm_or_si128(block, _mm_set1_epi8(0x20)), 'a', 'z') | digit | token_mask_equals(block, '_');
+
+            window->blank |= static_cast<Int64U>(blank) << (block_index * 16);
+            window->digit |= static_cast<Int64U>(digit) << (block_index * 16);
+            window->ident |= static_cast<Int64U>(ident) << (block_index * 16);
+            window->newline |= static_cast<Int64U>(newline) << (block_index * 16);
+        }
+        return;
+    }
+#endif
+
+    for (SizeU index = 0; index < size && index < 64; ++index) {
+        window->blank |= static_cast<Int64U>(token_is_blank(base[index])) << index;
+        window->digit |= static_cast<Int64U>(token_is_digit(base[index])) << index;
+        window->ident |= static_cast<Int64U>(token_is_ident(base[index])) << index;
+        window->newline |= static_cast<Int64U>(base[index] == '\n') << index;
+    }
+}
+
+//!
+//! @brief Returns end of the run of bytes, which have bit set in `mask` of the window, starting from `cursor`.
+//!
+static const char *
+token_scan_run(Token_Window *window, const char *cursor, const char *end, Int64U Token_Window::*mask)
+{
+    for (;;) {
+        if (cursor >= end) {
+            return end;
+        }
+
+        if (cursor < window->base || cursor >= window->base + 64) {
+            token_window_load(window, cursor, end);
+        }
+
+        SizeU index = static_cast<SizeU>(cursor - window->base);
+        Int64U run = ~(window->*mask >> index);
+
+        // NOTE(gr3yknigh1): Shift brings zeroes from the top, so run is zero only when whole window matches. [2026/10/17]
+        cursor += std::countr_zero(run);
+
+        if (cursor < window->base + 64) {
+            return cursor < end ? cursor : end;
+        }
+    }
+}
+
+static void
+token_list_reserve(mm::Virtual_Arena *arena, Token_List *list, SizeU count)
+{
+    if (list->capacity - list->count >= count) {
+        return;
+    }
+
+    constexpr SizeU grow_count = 16 * 1024;
+    static_assert(grow_count >= 64);
+
+    Token *chunk = mm::allocate_structs<Token>(arena, grow_count);
+    assert(chunk);
+
+    // NOTE(gr3yknigh1): Chunks are contiguous, because nothing else is allocated from the arena meanwhile. [2026/10/17]
+    assert(list->tokens == nullptr || chunk == list->tokens + list->capacity);
+
+    if (list->tokens == nullptr) {
+        list->tokens = chunk;
+    }
+    list->capacity += grow_count;
+}
+
+static inline void
+token_list_push_unchecked(Token_List *list, Token_Kind kind, const char *begin, const char *end)
+{
+    SizeU length = static_cast<SizeU>(end - begin);
+
+    Token *token = list->tokens + list->count++;
+    token->offset = static_cast<Int32U>(begin - list->buffer);
+    token->length = static_cast<Int16U>(length < TOKEN_MAX_LENGTH ? length : TOKEN_MAX_LENGTH);
+    token->kind = kind;
+}
+
+static void
+token_list_push(mm::Virtual_Arena *arena, Token_List *list, Token_Kind kind, const char *begin, const char *end)
+{
+    token_list_reserve(arena, list, 1);
+    token_list_push_unchecked(list, kind, begin, end);
+}
+
+//!
+//! @brief Digits of the window, which are before the first byte that is neither digit nor `separator`. Last run of
+//! digits is dropped if it can continue in the next window.
+//!
+//! @param limit Receives count of bytes covered by returned runs.
+//!
+static inline Int64U
+token_window_get_digit_runs(const Token_Window *window, Int64U separator, SizeU *limit)
+{
+    Int64U digit = window->digit;
+
+    *limit = static_cast<SizeU>(std::countr_zero(~(separator | digit)));
+    if (*limit < 64) {
+        digit &= (1ULL << *limit) - 1;
+    } else if (digit >> 63) {
+        *limit = 63 - static_cast<SizeU>(std::countl_zero(digit & ~(digit << 1)));
+        digit &= (1ULL << *limit) - 1;
+    }
+
+    return digit;
+}
+
+//!
+//! @brief Emits all unsigned integers of the window, which are before the first byte that is not a digit or blank.
+//! Each of them is found with bit scan of run starts and ends, without looking at the characters.
+//!
+//! @returns Position up to which the window was consumed.
+//!
+static const char *
+token_emit_window_ints(mm::Virtual_Arena *arena, Token_List *list, const Token_Window *window)
+{
+    SizeU limit = 0;
+    Int64U digit = token_window_get_digit_runs(window, window->blank, &limit);
+
+    Int64U starts = digit & ~(digit << 1);
+    Int64U ends = digit & ~(digit >> 1);
+
+    token_list_reserve(arena, list, 32);
+
+    while (starts) {
+        const char *first = window->base + std::countr_zero(starts);
+        const char *last = window->base + std::countr_zero(ends);
+
+        starts &= starts - 1;
+        ends &= ends - 1;
+
+        token_list_push_unchecked(list, Token_Kind::Int, first, last + 1);
+    }
+
+    return window->base + limit;
+}
+
+Token_List
+tokenize(mm::Virtual_Arena *arena, const char *buffer, SizeU buffer_size)
+{
+    assert(arena && buffer);
+    assert(buffer_size <= UINT32_MAX);
+
+    Token_List list{};
+    list.buffer = buffer;
+    list.buffer_size = buffer_size;
+
+    const char *cursor = buffer;
+    const char *end = buffer + buffer_size;
+
+    Token_Window window{};
+    token_window_load(&window, cursor, end);
+
+    for (;;) {
+        if (cursor < end && (token_is_blank(*cursor) || token_is_digit(*cursor))) {
+            token_window_load(&window, cursor, end);
+
+            const char *consumed = token_emit_window_ints(arena, &list, &window);
+            if (consumed != cursor) {
+                cursor = consumed;
+                continue;
+            }
+        }
+
+        cursor = token_scan_run(&window, cursor, end, &Token_Window::blank);
+
+        if (cursor >= end) {
+            break;
+        }
+
+        const char *begin = cursor;
+        char c = *cursor;
+
+        if (c == '\n') {
+            token_list_push(arena, &list, Token_Kind::Newline, begin, cursor + 1);
+            cursor++;
+
+        } else if (token_is_digit(c) || (c == '-' && cursor + 1 < end && token_is_digit(cursor[1]))) {
+            cursor = token_scan_run(&window, cursor + 1, end, &Token_Window::digit);
+            token_list_push(arena, &list, Token_Kind::Int, begin, cursor);
+
+        } else if (token_is_ident_start(c) || c == '_') {
+            cursor = token_scan_run(&window, cursor, end, &Token_Window::ident);
+            token_list_push(arena, &list, Token_Kind::Ident, begin, cursor);
+
+        } else if ((c == '@' || c == '#') && cursor + 1 < end && token_is_ident_start(cursor[1])) {
+            cursor = token_scan_run(&window, cursor + 1, end, &Token_Window::ident);
+            token_list_push(arena, &list, Token_Kind::Directive, begin, cursor);
+
+        } else if (c == '/' && cursor + 1 < end && cursor[1] == '/') {
+            const char *newline = static_cast<const char *>(noc_memory_find(cursor, static_cast<SizeU>(end - cursor), '\n'));
+            cursor = newline != nullptr ? newline : end;
+
+        } else if (c == '"') {
+            static constexpr Byte s_string_terminators[] = { '"', '\n' };
+
+            const char *text = cursor + 1;
+            const char *terminator = static_cast<const char *>(
+                noc_memory_find_any(text, static_cast<SizeU>(end - text), s_string_terminators, STATIC_ARRAY_COUNT(s_string_terminators)));
+
+            // NOTE(gr3yknigh1): Unterminated string ends at the end of line, newline stays for the next token. [2026/10/17]
+            if (terminator == nullptr) {
+                terminator = end;
+            }
+
+            token_list_push(arena, &list, Token_Kind::String, text, terminator);
+            cursor = terminator < end && *terminator == '"' ? terminator + 1 : terminator;
+
+        } else {
+            token_list_push(arena, &list, Token_Kind::Symbol, begin, cursor + 1);
+            cursor++;
+        }
+    }
+
+    return list;
+}
+
+Str8_View
+token_get_text(const Token_List *list, const Token *token)
+{
+    return Str8_View(list->buffer + token->offset, token->length);
+}
+
+Int32S
+token_get_int(const Token_List *list, const Token *token)
+{
+    assert(token->kind == Token_Kind::Int);
+
+    const char *cursor = list->buffer + token->offset;
+    const char *end = cursor + token->length;
+
+    bool is_negative = *cursor == '-';
+    cursor += is_negative;
+
+    Int32U value = 0;
+    for (; cursor < end; ++cursor) {
+        value = value * 10 + static_cast<Int32U>(*cursor - '0');
+    }
+
+    return static_cast<Int32S>(is_negative ? 0U - value : value);
+}
+
+bool
+token_is(const Token_List *list, const Token *token, Token_Kind kind, Str8_View text)
+{
+    return token != nullptr && token->kind == kind && str8_view_is_equals(token_get_text(list, token), text);
+}
+
+Token_Location
+token_get_location(const Token_List *list, const Token *token)
+{
+    return token_get_location(list->buffer, token->offset);
+}
+
+Token_Location
+token_get_location(const char *buffer, SizeU offset)
+{
+    Token_Location location{1, 1};
+
+    const char *line_begin = buffer;
+    const char *token_begin = buffer + offset;
+
+    for (;;) {
+        const char *newline = static_cast<const char *>(noc_memory_find(line_begin, static_cast<SizeU>(token_begin - line_begin), '\n'));
+        if (newline == nullptr) {
+            break;
+        }
+
+        line_begin = newline + 1;
+        location.line++;
+    }
+
+    location.column = static_cast<Int32U>(token_begin - line_begin) + 1;
+    return location;
+}
+
+//!
+//! @brief Converts `length` (1 to 8) digits with SWAR: pairs of digits, then pairs of pairs, and so on are combined
+//! by multiply and shift within one register. Reads 8 bytes starting from `text`.
+//!
+static inline Int32U
+uint_decode_swar(const char *text, SizeU length)
+{
+    Int64U chunk;
+    memcpy(&chunk, text, sizeof(chunk));
+
+    // NOTE(gr3yknigh1): First digit is in the lowest byte. Shift drops bytes after the number and puts zeroes in
+    // front of it, which are just leading zeroes. [2026/10/17]
+    chunk = (chunk << ((8 - length) * 8)) & 0x0F0F0F0F0F0F0F0FULL;
+
+    chunk = (chunk * 10 + (chunk >> 8)) & 0x00FF00FF00FF00FFULL;
+    chunk = (chunk * 100 + (chunk >> 16)) & 0x0000FFFF0000FFFFULL;
+    chunk = (chunk * 10000 + (chunk >> 32)) & 0x00000000FFFFFFFFULL;
+
+    return static_cast<Int32U>(chunk);
+}
+
+static inline bool
+uint_decode_scalar(const char *text, SizeU length, Int32U *value)
+{
+    Int64U result = 0;
+
+    for (SizeU index = 0; index < length; ++index) {
+        result = result * 10 + static_cast<Int64U>(text[index] - '0');
+
+        if (result > UINT32_MAX) {
+            return false;
+        }
+    }
+
+    *value = static_cast<Int32U>(result);
+    return true;
+}
+
+//!
+//! @brief Decodes short numbers (up to 4 digits) of the window 4 at a time. Digits of each number are gathered into
+//! its slot of `values` as 4 byte lane with leading zeroes, then lanes are converted in place.
+//!
+//! @note Writes up to 3 lanes past the last number, caller makes sure that `values` has room for them. Reads 3 bytes
+//! before the window.
+//!
+static SizeU
+uint_list_decode_window_short(const Token_Window *window, Int64U starts, Int64U ends, Int32U *values)
+{
+    static constexpr Int32U s_lane_masks[] = { 0x00000000, 0xFF000000, 0xFFFF0000, 0xFFFFFF00, 0xFFFFFFFF };
+
+    SizeU count = 0;
+
+    while (starts) {
+        SizeU first = static_cast<SizeU>(std::countr_zero(starts));
+        SizeU last = static_cast<SizeU>(std::countr_zero(ends));
+
+        starts &= starts - 1;
+        ends &= ends - 1;
+
+        // NOTE(gr3yknigh1): Last digit goes to the highest byte of the lane, bytes before the number are masked
+        // out. [2026/10/17]
+        Int32U lane;
+        memcpy(&lane, window->base + last - 3, sizeof(lane));
+        values[count++] = lane & s_lane_masks[last - first + 1];
+    }
+
+#if NOC_DETECT_ARCH_X86_64
+    for (SizeU index = 0; index < count; index += 4) {
+        __m128i lanes = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(values + index)), _mm_set1_epi8(0x0F));
+
+        __m128i pairs = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(lanes, _mm_set1_epi16(0x00FF)), _mm_set1_epi16(10)), _mm_srli_epi16(lanes, 8));
+        __m128i numbers = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00010064));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(values + index), numbers);
+    }
+#else
+    for (SizeU index = 0; index < count; ++index) {
+        Int32U lane = values[index] & 0x0F0F0F0F;
+        lane = (lane * 10 + (lane >> 8)) & 0x00FF00FF;
+        values[index] = (lane * 100 + (lane >> 16)) & 0x0000FFFF;
+    }
+#endif
+
+    return count;
+}
+
+//!
+//! @param is_padded Whether 8 bytes can be read from `text`, so SWAR decoder can be used for short numbers.
+//!
+static inline Parse_Status
+uint_list_push(const char *text, SizeU length, bool is_padded, Int32U *values, SizeU values_count, Int32U max_value, SizeU *count)
+{
+    if (*count == values_count) {
+        return Parse_Status::Too_Many_Values;
+    }
+
+    Int32U value = 0;
+    if (is_padded && length <= 8) {
+        value = uint_decode_swar(text, length);
+    } else if (!uint_decode_scalar(text, length, &value)) {
+        return Parse_Status::Overflow;
+    }
+
+    if (value > max_value) {
+        return Parse_Status::Overflow;
+    }
+
+    values[(*count)++] = value;
+    return Parse_Status::Ok;
+}
+
+Uint_List_Parse_Result
+parse_uint_list(const char *buffer, SizeU buffer_size, Int32U *values, SizeU values_count, Int32U max_value)
+{
+    assert(buffer && (values || values_count == 0));
+
+    const char *cursor = buffer;
+    const char *end = buffer + buffer_size;
+
+    SizeU count = 0;
+
+    Token_Window window{};
+
+    while (cursor < end) {
+        // NOTE(gr3yknigh1): Decoders read 8 bytes from the start of number or 3 bytes before its end, so window must be
+        // inside of the buffer with that padding. Head and tail are parsed one number at a time below. [2026/10/17]
+        if (end - cursor >= 64 + 8 && cursor - buffer >= 3) {
+            token_window_load(&window, cursor, end);
+
+            SizeU limit = 0;
+            Int64U digit = token_window_get_digit_runs(&window, window.blank | window.newline, &limit);
+
+            Int64U starts = digit & ~(digit << 1);
+            Int64U ends = digit & ~(digit >> 1);
+
+            bool is_short = (digit & (digit >> 1) & (digit >> 2) & (digit >> 3) & (digit >> 4)) == 0;
+            SizeU padded_count = (static_cast<SizeU>(std::popcount(starts)) + 3) & ~static_cast<SizeU>(3);
+
+            if (is_short && max_value >= 9999 && count + padded_count <= values_count) {
+                count += uint_list_decode_window_short(&window, starts, ends, values + count);
+                starts = 0;
+            }
+
+            while (starts) {
+                SizeU first = static_cast<SizeU>(std::countr_zero(starts));
+                SizeU last = static_cast<SizeU>(std::countr_zero(ends));
+
+                starts &= starts - 1;
+                ends &= ends - 1;
+
+                Parse_Status status = uint_list_push(window.base + first, last - first + 1, true, values, values_count, max_value, &count);
+                if (status != Parse_Status::Ok) {
+                    return { status, count, static_cast<SizeU>(window.base + first - buffer) };
+                }
+            }
+
+            if (limit > 0) {
+                cursor = window.base + limit;
+                continue;
+            }
+        }
+
+        char c = *cursor;
+
+        if (token_is_digit(c)) {
+            const char *text = cursor;
+            while (cursor < end && token_is_digit(*cursor)) {
+                ++cursor;
+            }
+
+            Parse_Status status = uint_list_push(text, static_cast<SizeU>(cursor - text), end - text >= 8, values, values_count, max_value, &count);
+            if (status != Parse_Status::Ok) {
+                return { status, count, static_cast<SizeU>(text - buffer) };
+            }
+
+        } else if (token_is_blank(c) || c == '\n') {
+            ++cursor;
+
+        } else if (c == '/' && cursor + 1 < end && cursor[1] == '/') {
+            const char *newline = static_cast<const char *>(noc_memory_find(cursor, static_cast<SizeU>(end - cursor), '\n'));
+            cursor = newline != nullptr ? newline : end;
+
+        } else {
+            return { Parse_Status::Unexpected_Character, count, static_cast<SizeU>(cursor - buffer) };
+        }
+    }
+
+    if (count != values_count) {
+        return { Parse_Status::Too_Few_Values, count, buffer_size };
+    }
+
+    return { Parse_Status::Ok, count, 0 };
+}
+
+
+#if 0
+// TODO(gr3yknigh1): Reuse for stack [2025/04/07]
+bool
+mm::arena_pop(mm::Arena *arena, void *data)
+{
+    if (arena == nullptr || data == nullptr) {
+        return false;
+    }
+
+    if (arena->data == nullptr || arena->occupied < sizeof(arena->occupied) || arena->capacity == 0) {
+        return false;
+    }
+
+    size_t *data_size = static_cast<size_t *>(data) - 1;
+
+    assert(static_cast<mm::byte *>(data) + *data_size == static_cast<mm::byte *>(arena->data) + arena->occupied);
+    arena->occupied -= *data_size;
+    arena->occupied -= sizeof(*data_size);
+
+    return true;
+}
+#endif
+
+SizeU
+mm::reset(mm::Fixed_Arena *arena)
+{
+    SizeU was_occupied = arena->occupied;
+    arena->occupied = 0;
+    return was_occupied;
+}
+
+void *
+mm::allocate(mm::Fixed_Arena *arena, SizeU size, mm::Allocate_Options options, SizeU alignment)
+{
+    assert(mm::is_power_of_two(alignment));
+
+    if (arena == nullptr) {
+        return nullptr;
+    }
+
+    SizeU padding = mm::get_alignment_padding(noxx::get_offset(arena->data, arena->occupied), alignment);
+
+    if (arena->occupied + padding + size > arena->capacity) {
+        return nullptr;
+    }
+
+    void *allocated = noxx::get_offset(arena->data, arena->occupied + padding);
+
+    if (NOC_HAS_FLAG(options, ALLOCATE_ZERO_MEMORY)) {
+        noc_memory_zero(allocated, size);
+    }
+
+    arena->occupied += padding + size;
+    return allocated;
+}
+
+bool
+mm::destroy(mm::Fixed_Arena *arena)
+{
+    assert(arena);
+
+    mm::deallocate(arena->data);
+    noxx::zero_type(arena);
+    return true;
+}
+
+mm::Virtual_Arena
+mm::make_virtual_arena(SizeU reserve_size)
+{
+    Virtual_Arena arena;
+    noxx::zero_type(&arena);
+
+    reserve_size = noc_align_to_page_size(reserve_size);
+
+    arena.data = static_cast<Byte *>(noc_native_reserve(reserve_size));
+    if (arena.data != nullptr) {
+        arena.reserved = reserve_size;
+    }
+
+    return arena;
+}
+
+bool
+mm::destroy(mm::Virtual_Arena *arena)
+{
+    assert(arena);
+
+    bool result = true;
+
+    if (arena->data != nullptr) {
+        result = noc_native_free(arena->data, arena->reserved);
+    }
+
+    noxx::zero_type(arena);
+    return result;
+}
+
+void *
+mm::allocate(mm::Virtual_Arena *arena, SizeU size, mm::Allocate_Options options, SizeU alignment)
+{
+    assert(mm::is_power_of_two(alignment));
+
+    if (arena == nullptr || arena->data == nullptr) {
+        return nullptr;
+    }
+
+    SizeU padding = mm::get_alignment_padding(arena->data + arena->occupied, alignment);
+
+    if (padding + size > arena->reserved - arena->occupied) {
+        return nullptr;
+    }
+
+    SizeU required = arena->occupied + padding + size;
+
+    if (required > arena->committed) {
+        SizeU commit_end = NOC_ALIGN_TO(required, VIRTUAL_ARENA_COMMIT_GRANULARITY);
+
+        if (commit_end > arena->reserved) {
+            commit_end = arena->reserved;
+        }
+
+        if (!noc_native_commit(arena->data + arena->committed, commit_end - arena->committed)) {
+            return nullptr;
+        }
+
+        arena->committed = commit_end;
+    }
+
+    void *allocated = arena->data + arena->occupied + padding;
+
+    if (NOC_HAS_FLAG(options, ALLOCATE_ZERO_MEMORY)) {
+        noc_memory_zero(allocated, size);
+    }
+
+    arena->occupied = required;
+
+    if (arena->occupied > arena->high_water) {
+        arena->high_water = arena->occupied;
+    }
+
+    return allocated;
+}
+
+SizeU
+mm::reset(mm::Virtual_Arena *arena)
+{
+    SizeU was_occupied = arena->occupied;
+    arena->occupied = 0;
+    return was_occupied;
+}
+
+//
+// NOTE(gr3yknigh1): Arena is plain state without destructor, so there is no thread-exit hook, which would pin gameplay
+// module (see `pool_flush_thread_cache`). [2026/10/17]
+//
+static thread_local mm::Virtual_Arena scratch_arena;
+
+mm::Virtual_Arena *
+mm::get_scratch_arena(void)
+{
+    if (scratch_arena.data == nullptr) {
+        scratch_arena = make_virtual_arena(SCRATCH_ARENA_RESERVE_SIZE);
+    }
+
+    assert(scratch_arena.data);
+    return &scratch_arena;
+}
+
+void
+mm::release_scratch_arena(void)
+{
+    [[maybe_unused]] bool is_destroyed = destroy(&scratch_arena);
+    assert(is_destroyed);
+}
+
+SizeU
+mm::decommit_to_high_water(mm::Virtual_Arena *arena)
+{
+    assert(arena);
+
+    SizeU keep = arena->high_water > arena->occupied ? arena->high_water : arena->occupied;
+    keep = NOC_ALIGN_TO(keep, VIRTUAL_ARENA_COMMIT_GRANULARITY);
+
+    if (keep > arena->reserved) {
+        keep = arena->reserved;
+    }
+
+    SizeU decommitted = 0;
+
+    if (keep < arena->committed) {
+        decommitted = arena->committed - keep;
+
+        if (!noc_native_decommit(arena->data + keep, decommitted)) {
+            return 0;
+        }
+
+        arena->committed = keep;
+    }
+
+    arena->high_water = arena->occupied;
+    return decommitted;
+}
+
+//
+// Pool allocator:
+//
+
+constexpr SizeU POOL_SPAN_SIZE = 64 * 1024;
+constexpr SizeU POOL_RESERVE_SIZE = 16ULL * 1024 * 1024 * 1024;
+constexpr SizeU POOL_SPANS_CAPACITY = POOL_RESERVE_SIZE / POOL_SPAN_SIZE;
+
+//!
+//! @brief Sizes of classes are multiples of it, so each object is aligned at least to 16 bytes.
+//!
+constexpr SizeU POOL_GRANULE = 16;
+
+//!
+//! @brief About four classes per power of two, so at most ~25% of object is wasted (except the smallest ones).
+//!
+constexpr Int32U POOL_CLASS_SIZES[] = {
+    16,   32,   48,   64,   80,   96,   112,  128,
+    160,  192,  224,  256,
+    320,  384,  448,  512,
+    640,  768,  896,  1024,
+    1280, 1536, 1792, 2048,
+    2560, 3072, 3584, 4096,
+};
+
+constexpr SizeU POOL_CLASS_COUNT = STATIC_ARRAY_COUNT(POOL_CLASS_SIZES);
+
+static_assert(POOL_CLASS_SIZES[POOL_CLASS_COUNT - 1] == mm::POOL_MAX_SIZE);
+static_assert(POOL_GRANULE >= mm::DEFAULT_ALIGNMENT);
+
+struct Pool_Size_Class_Table {
+    Int8U classes[mm::POOL_MAX_SIZE / POOL_GRANULE + 1];
+};
+
+static constexpr Pool_Size_Class_Table
+make_pool_size_class_table(void)
+{
+    Pool_Size_Class_Table table{};
+
+    SizeU class_index = 0;
+    for (SizeU granule_index = 0; granule_index < STATIC_ARRAY_COUNT(table.classes); ++granule_index) {
+        while (POOL_CLASS_SIZES[class_index] < granule_index * POOL_GRANULE) {
+            ++class_index;
+        }
+        table.classes[granule_index] = static_cast<Int8U>(class_index);
+    }
+
+    return table;
+}
+
+//!
+//! @brief Maps `(size + POOL_GRANULE - 1) / POOL_GRANULE` to the size class, so no search on the hot path.
+//!
+static constexpr Pool_Size_Class_Table POOL_SIZE_CLASS_TABLE = make_pool_size_class_table();
+
+struct Pool_Free_Object {
+    Pool_Free_Object *next;
+};
+
+//!
+//! @brief Shared free list of one size class. Guarded by spin lock, which is taken only to move whole batches.
+//!
+struct alignas(mm::CACHE_LINE_SIZE) Pool_Central_List {
+    std::atomic_flag lock;
+    Pool_Free_Object *head;
+    SizeU count;
+};
+
+struct Pool {
+    //!
+    //! @brief Reserved range, spans are committed on demand.
+    //!
+    Byte *data;
+
+    //!
+    //! @brief Size class of each span, so object can be freed without header.
+    //!
+    Int8U *span_classes;
+
+    std::atomic<SizeU> spans_count;
+
+    Pool_Central_List central_lists[POOL_CLASS_COUNT];
+};
+
+struct Pool_Thread_Cache {
+    Pool_Free_Object *free_lists[POOL_CLASS_COUNT];
+    Int32U counts[POOL_CLASS_COUNT];
+};
+
+static thread_local Pool_Thread_Cache pool_thread_cache;
+
+static Pool *
+make_pool(void)
+{
+    // NOTE(gr3yknigh1): Native allocations are zeroed, which is also the clear state of `std::atomic_flag`. [2026/10/17]
+    Pool *pool = static_cast<Pool *>(noc_native_allocate(sizeof(Pool)));
+    assert(pool);
+
+    pool->data = static_cast<Byte *>(noc_native_reserve(POOL_RESERVE_SIZE));
+    assert(pool->data);
+
+    pool->span_classes = static_cast<Int8U *>(noc_native_allocate(POOL_SPANS_CAPACITY));
+    assert(pool->span_classes);
+
+    return pool;
+}
+
+static Pool *
+get_pool(void)
+{
+    static Pool *pool = make_pool();
+    return pool;
+}
+
+//!
+//! @brief Number of objects, which are moved between thread cache and shared list at once. Around 8KiB per batch.
+//!
+static inline Int32U
+pool_get_batch_count(SizeU class_index)
+{
+    Int32U batch_count = static_cast<Int32U>(8 * 1024 / POOL_CLASS_SIZES[class_index]);
+    return batch_count < 4 ? 4 : (batch_count > 64 ? 64 : batch_count);
+}
+
+static void
+pool_central_list_lock(Pool_Central_List *list)
+{
+    while (list->lock.test_and_set(std::memory_order_acquire)) {
+        while (list->lock.test(std::memory_order_relaxed)) {
+        }
+    }
+}
+
+static void
+pool_central_list_unlock(Pool_Central_List *list)
+{
+    list->lock.clear(std::memory_order_release);
+}
+
+//!
+//! @brief Commits new span and splits it into objects of the class. Called with central list locked.
+//!
+static bool
+pool_carve_span(Pool *pool, SizeU class_index)
+{
+    SizeU span_index = pool->spans_count.fetch_add(1, std::memory_order_relaxed);
+    if (span_index >= POOL_SPANS_CAPACITY) {
+        return false;
+    }
+
+    Byte *span = pool->data + span_index * POOL_SPAN_SIZE;
+    if (!noc_native_commit(span, POOL_SPAN_SIZE)) {
+        return false;
+    }
+
+    pool->span_classes[span_index] = static_cast<Int8U>(class_index);
+
+    SizeU object_size = POOL_CLASS_SIZES[class_index];
+    SizeU objects_count = POOL_SPAN_SIZE / object_size;
+
+    Pool_Central_List *list = pool->central_lists + class_index;
+
+    // NOTE(gr3yknigh1): Linked back to front, so objects are handed out in address order. [2026/10/17]
+    for (SizeU object_index = objects_count; object_index > 0; --object_index) {
+        Pool_Free_Object *object = reinterpret_cast<Pool_Free_Object *>(span + (object_index - 1) * object_size);
+        object->next = list->head;
+        list->head = object;
+    }
+
+    list->count += objects_count;
+    return true;
+}
+
+static bool
+pool_refill_thread_cache(Pool *pool, Pool_Thread_Cache *cache, SizeU class_index)
+{
+    Pool_Central_List *list = pool->central_lists + class_index;
+
+    pool_central_list_lock(list);
+
+    if (list->count == 0 && !pool_carve_span(pool, class_index)) {
+        pool_central_list_unlock(list);
+        return false;
+    }
+
+    Int32U batch_count = pool_get_batch_count(class_index);
+    if (batch_count > list->count) {
+        batch_count = static_cast<Int32U>(list->count);
+    }
+
+    Pool_Free_Object *first = list->head;
+    Pool_Free_Object *last = first;
+    for (Int32U object_index = 1; object_index < batch_count; ++object_index) {
+        last = last->next;
+    }
+
+    list->head = last->next;
+    list->count -= batch_count;
+
+    pool_central_list_unlock(list);
+
+    last->next = cache->free_lists[class_index];
+    cache->free_lists[class_index] = first;
+    cache->counts[class_index] += batch_count;
+
+    return true;
+}
+
+static void
+pool_release_from_thread_cache(Pool *pool, Pool_Thread_Cache *cache, SizeU class_index, Int32U release_count)
+{
+    if (release_count == 0) {
+        return;
+    }
+
+    Pool_Free_Object *first = cache->free_lists[class_index];
+    Pool_Free_Object *last = first;
+    for (Int32U object_index = 1; object_index < release_count; ++object_index) {
+        last = last->next;
+    }
+
+    cache->free_lists[class_index] = last->next;
+    cache->counts[class_index] -= release_count;
+
+    Pool_Central_List *list = pool->central_lists + class_index;
+
+    pool_central_list_lock(list);
+    last->next = list->head;
+    list->head = first;
+    list->count += release_count;
+    pool_central_list_unlock(list);
+}
+
+void *
+mm::pool_allocate(SizeU size)
+{
+    if (size > mm::POOL_MAX_SIZE) {
+        return nullptr;
+    }
+
+    SizeU class_index = POOL_SIZE_CLASS_TABLE.classes[(size + POOL_GRANULE - 1) / POOL_GRANULE];
+    Pool_Thread_Cache *cache = &pool_thread_cache;
+
+    if (cache->free_lists[class_index] == nullptr && !pool_refill_thread_cache(get_pool(), cache, class_index)) {
+        return nullptr;
+    }
+
+    Pool_Free_Object *object = cache->free_lists[class_index];
+    cache->free_lists[class_index] = object->next;
+    cache->counts[class_index] -= 1;
+
+    return object;
+}
+
+bool
+mm::pool_owns(const void *data)
+{
+    const Byte *pool_data = get_pool()->data;
+    const Byte *byte_data = static_cast<const Byte *>(data);
+    return byte_data >= pool_data && byte_data < pool_data + POOL_RESERVE_SIZE;
+}
+
+bool
+mm::pool_deallocate(void *data)
+{
+    if (!mm::pool_owns(data)) {
+        return false;
+    }
+
+    Pool *pool = get_pool();
+
+    SizeU span_index = static_cast<SizeU>(static_cast<Byte *>(data) - pool->data) / POOL_SPAN_SIZE;
+    SizeU class_index = pool->span_classes[span_index];
+
+    // NOTE(gr3yknigh1): Object can be allocated by other thread, it just migrates into this thread's cache. [2026/10/17]
+    Pool_Thread_Cache *cache = &pool_thread_cache;
+
+    Pool_Free_Object *object = static_cast<Pool_Free_Object *>(data);
+    object->next = cache->free_lists[class_index];
+    cache->free_lists[class_index] = object;
+    cache->counts[class_index] += 1;
+
+    Int32U batch_count = pool_get_batch_count(class_index);
+    if (cache->counts[class_index] > 2 * batch_count) {
+        pool_release_from_thread_cache(pool, cache, class_index, batch_count);
+    }
+
+    return true;
+}
+
+void
+mm::pool_flush_thread_cache(void)
+{
+    Pool *pool = get_pool();
+    Pool_Thread_Cache *cache = &pool_thread_cache;
+
+    for (SizeU class_index = 0; class_index < POOL_CLASS_COUNT; ++class_index) {
+        pool_release_from_thread_cache(pool, cache, class_index, cache->counts[class_index]);
+    }
+}
+
+static inline void *
+allocate_impl(SizeU size, mm::Allocate_Options options)
+{
+    void *result = size <= mm::POOL_MAX_SIZE ? mm::pool_allocate(size) : nullptr;
+    if (result == nullptr) {
+        result = noc_allocate(size);
+    }
+    if (result && NOC_HAS_FLAG(options, ALLOCATE_ZERO_MEMORY)) {
+        noc_memory_zero(result, size);
+    }
+    return result;
+}
+
+static inline void
+deallocate_impl(void *p)
+{
+    // TODO(gr3yknigh1): Use platform functions for allocations [2025/04/07]
+    if (!mm::pool_deallocate(p)) {
+        noc_free(p);
     }
 }
 
-bool
-lexer_is_end(Lexer *lexer)
-{
-    size_t cursor_index = lexer->cursor - lexer->buffer;
-    return cursor_index >= lexer->buffer_size;
-}
+#if GARDEN_TRACK_ALLOCATIONS
 
+//
+// Allocation tracking:
+//
+// Each thread owns table of call sites, which is filled without locks. Counters are atomic only because deallocation
+// can happen on other thread, and because `collect_allocation_sites` reads them while owner is running. Owner never
+// contends with itself, so relaxed increments are cheap.
+//
 
-bool
-lexer_parse_int(Lexer *lexer, int *result)
+constexpr SizeU ALLOCATION_TRACKER_SITES_CAPACITY = 4096;
+static_assert(mm::is_power_of_two(ALLOCATION_TRACKER_SITES_CAPACITY));
+
+struct Allocation_Tracker_Site {
+    Source_Location location;
+
+    //!
+    //! @brief Set (with release) after `location` was written, so other threads can read it.
+    //!
+    std::atomic<bool> is_used;
+
+    std::atomic<Int64U> allocations_count;
+    std::atomic<Int64U> deallocations_count;
+    std::atomic<Int64S> live_bytes;
+    std::atomic<Int64U> total_bytes;
+};
+
+struct Allocation_Tracker {
+    //!
+    //! @brief Next tracker in `global_allocation_trackers` list. Trackers are never removed, because allocations of
+    //! exited thread still point to it's sites.
+    //!
+    Allocation_Tracker *next;
+
+    //!
+    //! @brief Used if table is full.
+    //!
+    Allocation_Tracker_Site overflow_site;
+
+    Allocation_Tracker_Site sites[ALLOCATION_TRACKER_SITES_CAPACITY];
+};
+
+//!
+//! @brief Prepended to each tracked allocation. Size is rounded up to `DEFAULT_ALIGNMENT`, so user data stays aligned.
+//!
+struct Allocation_Header {
+    Allocation_Tracker_Site *site;
+    SizeU size;
+};
+
+constexpr SizeU ALLOCATION_HEADER_SIZE = NOC_ALIGN_TO(sizeof(Allocation_Header), mm::DEFAULT_ALIGNMENT);
+
+static std::atomic<Allocation_Tracker *> global_allocation_trackers{nullptr};
+static std::atomic<Int64S> global_allocation_live_bytes{0};
+static std::atomic<Int64S> global_allocation_high_water_bytes{0};
+
+static Allocation_Tracker *
+get_allocation_tracker(void)
 {
-    // TODO(gr3yknigh1): Error handling [2025/02/23]
+    thread_local Allocation_Tracker *tracker = nullptr;
 
-    int num = 0;
-
-    bool is_negative = false;
+    if (tracker == nullptr) {
+        // NOTE(gr3yknigh1): Not through `mm::allocate`, it would track itself. [2026/10/17]
+        tracker = static_cast<Allocation_Tracker *>(noc_allocate(sizeof(Allocation_Tracker)));
+        assert(tracker);
+        noc_memory_zero(tracker, sizeof(Allocation_Tracker));
 
-    if (lexer->lexeme == '-') {
-        is_negative = true;
-        lexer_advance(lexer);
+        tracker->next = global_allocation_trackers.load(std::memory_order_relaxed);
+        while (!global_allocation_trackers.compare_exchange_weak(tracker->next, tracker, std::memory_order_release, std::memory_order_relaxed)) {
+        }
     }
 
-    while (lexer->lexeme && (lexer->lexeme >= '0' && lexer->lexeme <= '9')) {
-        num = num * 10 + (lexer->lexeme - '0');
-        lexer_advance(lexer);
-    }
+    return tracker;
+}
 
-    if (is_negative) {
-        num = -1 * num;
+static Allocation_Tracker_Site *
+allocation_tracker_find_site(Allocation_Tracker *tracker, const Source_Location &location)
+{
+    // NOTE(gr3yknigh1): Same call site always has same pointer to file name (within one module), so no need to compare
+    // strings on the hot path. [2026/10/17]
+    SizeU hash = reinterpret_cast<SizeU>(location.file_name) * 0x9E3779B97F4A7C15ULL;
+    hash ^= (static_cast<SizeU>(location.line) << 16) ^ location.column;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 32;
+
+    for (SizeU probe_index = 0; probe_index < ALLOCATION_TRACKER_SITES_CAPACITY; ++probe_index) {
+        Allocation_Tracker_Site *site = tracker->sites + ((hash + probe_index) & (ALLOCATION_TRACKER_SITES_CAPACITY - 1));
+
+        // NOTE(gr3yknigh1): Only owner thread inserts, so relaxed load is enough here. [2026/10/17]
+        if (!site->is_used.load(std::memory_order_relaxed)) {
+            site->location = location;
+            site->is_used.store(true, std::memory_order_release);
+            return site;
+        }
+
+        if (site->location.file_name == location.file_name && site->location.line == location.line && site->location.column == location.column) {
+            return site;
+        }
     }
 
-    *result = num;
+    return &tracker->overflow_site;
+}
 
-    return true;
+static void
+allocation_tracker_site_merge(mm::Allocation_Site *result, const Allocation_Tracker_Site *site)
+{
+    result->allocations_count += site->allocations_count.load(std::memory_order_relaxed);
+    result->deallocations_count += site->deallocations_count.load(std::memory_order_relaxed);
+    result->live_bytes += site->live_bytes.load(std::memory_order_relaxed);
+    result->total_bytes += site->total_bytes.load(std::memory_order_relaxed);
 }
 
-bool
-lexer_parse_str_to_view(Lexer *lexer, Str8_View *sv)
+static bool
+allocation_site_is_same_location(const Source_Location &a, const Source_Location &b)
 {
-    if (lexer->lexeme != '"') {
+    if (a.line != b.line || a.column != b.column) {
         return false;
     }
 
-    // NOTE(gr3yknigh1): Skipping '"' [2025/02/24]
-    lexer_advance(lexer); // TODO(gr3yknigh1): Wrap in `Lexer_AdvanceIf(Lexer *, int32_t count, char c)`
-
-    *sv = lexer_skip_until(lexer, '"');
-
-    // NOTE(gr3yknigh1): Skipping '"' [2025/02/24]
-    lexer_advance(lexer); // TODO(gr3yknigh1): Wrap in `lexer_advance_if(Lexer *, int32_t count, char c)`
+    if (a.file_name == nullptr || b.file_name == nullptr) {
+        return a.file_name == b.file_name;
+    }
 
-    return true;
+    return strcmp(a.file_name, b.file_name) == 0 && strcmp(a.function_name, b.function_name) == 0;
 }
 
-bool
-lexer_check_peeked_and_advance(Lexer *lexer, Str8_View sv)
+static void
+allocation_sites_add(mm::Allocation_Site *sites, SizeU sites_capacity, SizeU *sites_count, const Allocation_Tracker_Site *site)
 {
-    if (lexer_check_peeked(lexer, sv)) {
-        lexer_advance(lexer, sv.length); // @cleanup
-        return true;
+    for (SizeU site_index = 0; site_index < *sites_count && site_index < sites_capacity; ++site_index) {
+        if (allocation_site_is_same_location(sites[site_index].location, site->location)) {
+            allocation_tracker_site_merge(sites + site_index, site);
+            return;
+        }
     }
-    return false;
-}
 
+    if (sites != nullptr && *sites_count < sites_capacity) {
+        mm::Allocation_Site *result = sites + *sites_count;
+        noxx::zero_type(result);
+        result->location = site->location;
+        allocation_tracker_site_merge(result, site);
+    }
 
-#if 0
-// TODO(gr3yknigh1): Reuse for stack [2025/04/07]
-bool
-mm::arena_pop(mm::Arena *arena, void *data)
+    *sites_count += 1;
+}
+
+SizeU
+mm::collect_allocation_sites(mm::Allocation_Site *sites, SizeU sites_capacity)
 {
-    if (arena == nullptr || data == nullptr) {
-        return false;
+    if (sites == nullptr) {
+        sites_capacity = 0;
     }
 
-    if (arena->data == nullptr || arena->occupied < sizeof(arena->occupied) || arena->capacity == 0) {
-        return false;
-    }
+    SizeU sites_count = 0;
 
-    size_t *data_size = static_cast<size_t *>(data) - 1;
+    for (Allocation_Tracker *tracker = global_allocation_trackers.load(std::memory_order_acquire); tracker != nullptr; tracker = tracker->next) {
+        for (SizeU site_index = 0; site_index < ALLOCATION_TRACKER_SITES_CAPACITY; ++site_index) {
+            const Allocation_Tracker_Site *site = tracker->sites + site_index;
 
-    assert(static_cast<mm::byte *>(data) + *data_size == static_cast<mm::byte *>(arena->data) + arena->occupied);
-    arena->occupied -= *data_size;
-    arena->occupied -= sizeof(*data_size);
+            if (site->is_used.load(std::memory_order_acquire)) {
+                allocation_sites_add(sites, sites_capacity, &sites_count, site);
+            }
+        }
 
-    return true;
+        if (tracker->overflow_site.allocations_count.load(std::memory_order_relaxed) > 0) {
+            allocation_sites_add(sites, sites_capacity, &sites_count, &tracker->overflow_site);
+        }
+    }
+
+    // NOTE(gr3yknigh1): Once buffer is full, sites can't be deduplicated anymore, so the count is an upper bound in that
+    // case. Call it again with bigger buffer. [2026/10/17]
+    return sites_count;
 }
-#endif
 
-SizeU
-mm::reset(mm::Fixed_Arena *arena)
+mm::Allocation_Stats
+mm::get_allocation_stats(void)
 {
-    SizeU was_occupied = arena->occupied;
-    arena->occupied = 0;
-    return was_occupied;
+    mm::Allocation_Stats stats;
+    noxx::zero_type(&stats);
+
+    stats.live_bytes = global_allocation_live_bytes.load(std::memory_order_relaxed);
+    stats.high_water_bytes = global_allocation_high_water_bytes.load(std::memory_order_relaxed);
+
+    for (Allocation_Tracker *tracker = global_allocation_trackers.load(std::memory_order_acquire); tracker != nullptr; tracker = tracker->next) {
+        for (SizeU site_index = 0; site_index < ALLOCATION_TRACKER_SITES_CAPACITY; ++site_index) {
+            const Allocation_Tracker_Site *site = tracker->sites + site_index;
+
+            if (site->is_used.load(std::memory_order_acquire)) {
+                stats.allocations_count += site->allocations_count.load(std::memory_order_relaxed);
+                stats.deallocations_count += site->deallocations_count.load(std::memory_order_relaxed);
+                stats.sites_count += 1;
+            }
+        }
+
+        stats.allocations_count += tracker->overflow_site.allocations_count.load(std::memory_order_relaxed);
+        stats.deallocations_count += tracker->overflow_site.deallocations_count.load(std::memory_order_relaxed);
+    }
+
+    return stats;
 }
 
 void *
-mm::allocate(mm::Fixed_Arena *arena, SizeU size, mm::Allocate_Options options)
+mm::allocate(SizeU size, mm::Allocate_Options options, Source_Location location)
 {
-    if (arena == nullptr) {
+    Byte *block = static_cast<Byte *>(allocate_impl(ALLOCATION_HEADER_SIZE + size, options));
+    if (block == nullptr) {
         return nullptr;
     }
 
-    if (arena->occupied + size > arena->capacity) {
-        return nullptr;
-    }
+    Allocation_Tracker_Site *site = allocation_tracker_find_site(get_allocation_tracker(), location);
+    site->allocations_count.fetch_add(1, std::memory_order_relaxed);
+    site->live_bytes.fetch_add(static_cast<Int64S>(size), std::memory_order_relaxed);
+    site->total_bytes.fetch_add(size, std::memory_order_relaxed);
 
-    void *allocated = noxx::get_offset(arena->data, arena->occupied);
-
-    if (NOC_HAS_FLAG(options, ALLOCATE_ZERO_MEMORY)) {
-        noc_memory_zero(allocated, size);
+    Int64S live_bytes = global_allocation_live_bytes.fetch_add(static_cast<Int64S>(size), std::memory_order_relaxed) + static_cast<Int64S>(size);
+    Int64S high_water_bytes = global_allocation_high_water_bytes.load(std::memory_order_relaxed);
+    while (live_bytes > high_water_bytes && !global_allocation_high_water_bytes.compare_exchange_weak(high_water_bytes, live_bytes, std::memory_order_relaxed)) {
     }
 
-    arena->occupied += size;
-    return allocated;
+    Allocation_Header *header = reinterpret_cast<Allocation_Header *>(block);
+    header->site = site;
+    header->size = size;
+
+    return block + ALLOCATION_HEADER_SIZE;
 }
 
 bool
-mm::destroy(mm::Fixed_Arena *arena)
+mm::deallocate(void *p)
 {
-    assert(arena);
+    if (p == nullptr) {
+        return true;
+    }
 
-    mm::deallocate(arena->data);
-    noxx::zero_type(arena);
+    Byte *block = static_cast<Byte *>(p) - ALLOCATION_HEADER_SIZE;
+    Allocation_Header *header = reinterpret_cast<Allocation_Header *>(block);
+
+    // NOTE(gr3yknigh1): Site may belong to other thread's tracker, that is why counters are atomic. [2026/10/17]
+    header->site->deallocations_count.fetch_add(1, std::memory_order_relaxed);
+    header->site->live_bytes.fetch_sub(static_cast<Int64S>(header->size), std::memory_order_relaxed);
+    global_allocation_live_bytes.fetch_sub(static_cast<Int64S>(header->size), std::memory_order_relaxed);
+
+    deallocate_impl(block);
     return true;
 }
 
-static inline void *
-allocate_impl(SizeU size, mm::Allocate_Options options)
+#else
+
+SizeU
+mm::collect_allocation_sites([[maybe_unused]] mm::Allocation_Site *sites, [[maybe_unused]] SizeU sites_capacity)
 {
-    void *result = noc_allocate(size);
-    if (result && NOC_HAS_FLAG(options, ALLOCATE_ZERO_MEMORY)) {
-        noc_memory_zero(result, size);
-    }
-    return result;
+    return 0;
+}
+
+mm::Allocation_Stats
+mm::get_allocation_stats(void)
+{
+    mm::Allocation_Stats stats;
+    noxx::zero_type(&stats);
+    return stats;
 }
 
-std::list<mm::Allocation_Record> *
-mm::get_allocation_records(void)
+void *
+mm::allocate(SizeU size, mm::Allocate_Options options, [[maybe_unused]] Source_Location location)
 {
-    static std::list<Allocation_Record> allocation_records{};
-    return &allocation_records;
+    return allocate_impl(size, options);
 }
 
 bool
-mm::dump_allocation_records(bool do_hex_dump)
+mm::deallocate(void *p)
+{
+    if (p != nullptr) {
+        deallocate_impl(p);
+    }
+    return true;
+}
+
+#endif // GARDEN_TRACK_ALLOCATIONS
+
+//!
+//! @brief Collects sites into scratch arena. Returns nullptr if there is nothing to collect.
+//!
+static mm::Allocation_Site *
+collect_allocation_sites_into(mm::Virtual_Arena *arena, SizeU *sites_count)
 {
-    std::list<Allocation_Record> *records = mm::get_allocation_records();
+    SizeU capacity = mm::collect_allocation_sites(nullptr, 0);
+    if (capacity == 0) {
+        *sites_count = 0;
+        return nullptr;
+    }
 
-    SizeU total_memory = 0;
+    mm::Allocation_Site *sites = mm::allocate_structs<mm::Allocation_Site>(arena, capacity);
+    *sites_count = mm::collect_allocation_sites(sites, capacity);
+    if (*sites_count > capacity) {
+        *sites_count = capacity; // NOTE(gr3yknigh1): New sites were added while collecting. [2026/10/17]
+    }
 
-    for (const mm::Allocation_Record &record : *records) {
+    return sites;
+}
 
-        printf("Allocation_Record(options=(%d) size=(%lld) result=(%p) location.file_name=(%s) location.line=(%u) location.function_name=(%s))\n",
-            record.options, record.size, record.result, record.location.file_name, record.location.line, record.location.function_name
-        );
+bool
+mm::dump_allocation_records(bool only_live)
+{
+    mm::Temp_Scope temp(mm::get_scratch_arena());
+
+    SizeU sites_count = 0;
+    mm::Allocation_Site *sites = collect_allocation_sites_into(temp.arena, &sites_count);
 
-        total_memory += record.size;
+    Int64S live_bytes = 0;
 
-        if (do_hex_dump) {
-            noc_print_hex_dump(record.result, record.size);
-            puts("");
+    for (SizeU site_index = 0; site_index < sites_count; ++site_index) {
+        const mm::Allocation_Site *site = sites + site_index;
+
+        if (only_live && site->live_bytes == 0) {
+            continue;
         }
+
+        printf("Allocation_Site(location.file_name=(%s) location.line=(%u) location.function_name=(%s) allocations=(%llu) deallocations=(%llu) live=(%lld) total=(%llu))\n",
+            site->location.file_name ? site->location.file_name : "<overflow>", site->location.line,
+            site->location.function_name ? site->location.function_name : "<overflow>",
+            static_cast<unsigned long long>(site->allocations_count), static_cast<unsigned long long>(site->deallocations_count),
+            static_cast<long long>(site->live_bytes), static_cast<unsigned long long>(site->total_bytes)
+        );
+
+        live_bytes += site->live_bytes;
     }
 
-    printf("Total memory: %lld bytes\n", total_memory);
+    mm::Allocation_Stats stats = mm::get_allocation_stats();
+
+    printf("Live memory: %lld bytes (high water: %lld bytes, allocations: %llu, deallocations: %llu)\n",
+        static_cast<long long>(stats.live_bytes), static_cast<long long>(stats.high_water_bytes),
+        static_cast<unsigned long long>(stats.allocations_count), static_cast<unsigned long long>(stats.deallocations_count));
 
-    return total_memory > 0;
+    return live_bytes > 0;
 }
 
-void *
-mm::allocate(SizeU size, mm::Allocate_Options options)
+static Int16U
+allocation_dump_string_length(const char *string)
 {
-    return allocate_impl(size, options);
+    if (string == nullptr) {
+        return 0;
+    }
+
+    SizeU length = strlen(string);
+    return static_cast<Int16U>(length > 0xFFFF ? 0xFFFF : length);
 }
 
 bool
-mm::deallocate(void *p)
+mm::dump_allocation_records_to_file(const char *file_path)
 {
-    // TODO(gr3yknigh1): Use platform functions for allocations [2025/04/07]
-    noc_free(p);
-    return true;
+    FILE *file = fopen(file_path, "wb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    mm::Temp_Scope temp(mm::get_scratch_arena());
+
+    SizeU sites_count = 0;
+    mm::Allocation_Site *sites = collect_allocation_sites_into(temp.arena, &sites_count);
+
+    mm::Allocation_Stats stats = mm::get_allocation_stats();
+
+    mm::Allocation_Dump_Header header;
+    noxx::zero_type(&header);
+    header.magic = mm::ALLOCATION_DUMP_MAGIC;
+    header.version = mm::ALLOCATION_DUMP_VERSION;
+    header.live_bytes = stats.live_bytes;
+    header.high_water_bytes = stats.high_water_bytes;
+    header.allocations_count = stats.allocations_count;
+    header.deallocations_count = stats.deallocations_count;
+    header.sites_count = sites_count;
+
+    bool is_written = fwrite(&header, sizeof(header), 1, file) == 1;
+
+    for (SizeU site_index = 0; is_written && site_index < sites_count; ++site_index) {
+        const mm::Allocation_Site *site = sites + site_index;
+
+        mm::Allocation_Dump_Site dump_site;
+        noxx::zero_type(&dump_site);
+        dump_site.line = site->location.line;
+        dump_site.column = site->location.column;
+        dump_site.allocations_count = site->allocations_count;
+        dump_site.deallocations_count = site->deallocations_count;
+        dump_site.live_bytes = site->live_bytes;
+        dump_site.total_bytes = site->total_bytes;
+        dump_site.file_name_length = allocation_dump_string_length(site->location.file_name);
+        dump_site.function_name_length = allocation_dump_string_length(site->location.function_name);
+
+        is_written = fwrite(&dump_site, sizeof(dump_site), 1, file) == 1
+            && (dump_site.file_name_length == 0 || fwrite(site->location.file_name, dump_site.file_name_length, 1, file) == 1)
+            && (dump_site.function_name_length == 0 || fwrite(site->location.function_name, dump_site.function_name_length, 1, file) == 1);
+    }
+
+    return fclose(file) == 0 && is_written;
 }
 
 mm::Block_Allocator
@@ -471,6 +2942,82 @@ mm::make_block_allocator(void)
     return result;
 }
 
+//!
+//! @brief Distance between data of neighbour fixed-size blocks. Rounded up, so each block starts aligned.
+//!
+static inline SizeU
+get_fixed_block_stride(const mm::Block_Allocator *allocator)
+{
+    return NOC_ALIGN_TO(allocator->block_fixed_size, mm::DEFAULT_ALIGNMENT);
+}
+
+//!
+//! @brief Allocates block header and block data as a single allocation. Header goes first, so owner of the data can
+//! be found by subtracting `BLOCK_HEADER_SIZE` (once it's checked against `block_set`).
+//!
+static mm::Block *
+make_joined_block(SizeU capacity, Int64U index)
+{
+    mm::Block *block = static_cast<mm::Block *>(mm::allocate(mm::BLOCK_HEADER_SIZE + capacity));
+    assert(block);
+
+    noxx::zero_type(block);
+    block->index = index;
+    block->stack = mm::make_stack_view(noxx::get_offset(static_cast<void *>(block), mm::BLOCK_HEADER_SIZE), capacity);
+
+    return block;
+}
+
+//!
+//! @brief Slot of `block` in `block_set`, or empty slot where it should be inserted.
+//!
+static mm::Block **
+find_block_set_slot(const mm::Block_Allocator *allocator, const mm::Block *block)
+{
+    // NOTE(gr3yknigh1): Fibonacci hashing, low bits of address are always zero because of alignment. [2026/10/17]
+    Int64U mask = allocator->block_set_capacity - 1;
+    Int64U slot_index = (reinterpret_cast<SizeU>(block) * 0x9E3779B97F4A7C15ULL) >> 32;
+
+    for (;; ++slot_index) {
+        mm::Block **slot = allocator->block_set + (slot_index & mask);
+
+        if (*slot == block || *slot == nullptr) {
+            return slot;
+        }
+    }
+}
+
+//!
+//! @brief Grows `block_set`, so it can hold `blocks_count` blocks, and inserts `block`.
+//!
+static void
+insert_into_block_set(mm::Block_Allocator *allocator, mm::Block *block, Int64U blocks_count)
+{
+    if (allocator->block_set_capacity < 2 * blocks_count) {
+        mm::Block **previous_set = allocator->block_set;
+        Int64U previous_capacity = allocator->block_set_capacity;
+
+        Int64U capacity = previous_capacity ? previous_capacity : 16;
+        while (capacity < 2 * blocks_count) {
+            capacity *= 2;
+        }
+
+        allocator->block_set = mm::allocate_structs<mm::Block *>(capacity, ALLOCATE_ZERO_MEMORY);
+        allocator->block_set_capacity = capacity;
+        assert(allocator->block_set);
+
+        for (Int64U slot_index = 0; slot_index < previous_capacity; ++slot_index) {
+            if (previous_set[slot_index] != nullptr) {
+                *find_block_set_slot(allocator, previous_set[slot_index]) = previous_set[slot_index];
+            }
+        }
+
+        mm::deallocate(previous_set);
+    }
+
+    *find_block_set_slot(allocator, block) = block;
+}
+
 mm::Block_Allocator
 mm::make_block_allocator(Int64U blocks_count, SizeU block_size, SizeU block_fixed_size, Int64U block_count_limit)
 {
@@ -482,6 +3029,9 @@ mm::make_block_allocator(Int64U blocks_count, SizeU block_size, SizeU block_fixe
 
     if (block_fixed_size > 0) {
         assert(block_size == block_fixed_size);
+
+        // NOTE(gr3yknigh1): Fixed-size blocks are preallocated in one chunk, so they can't grow [2026/10/17]
+        assert(block_count_limit == blocks_count);
     }
 
     Block_Allocator result;
@@ -491,71 +3041,73 @@ mm::make_block_allocator(Int64U blocks_count, SizeU block_size, SizeU block_fixe
     result.block_count_limit = block_count_limit;
     result.blocks.count = blocks_count;
 
-    // TODO(gr3yknigh1): Allocate each block near the actuall data? [2025/03/09]
-
-    if (block_count_limit) {
+    if (block_fixed_size) {
         result.blocks.head = allocate_structs<Block>(blocks_count);
+        assert(result.blocks.head);
         noxx::zero_type(result.blocks.head, blocks_count);
-    } else {
-        result.blocks.head = allocate_struct<Block>();
-        noxx::zero_type(result.blocks.head);
-    }
-    assert(result.blocks.head);
-
-    Byte *data_cursor = nullptr;
-    if (block_fixed_size) {
-        data_cursor = static_cast<Byte *>(allocate(blocks_count * block_size));
-    }
-
-    Block *current_block = result.blocks.head;
 
-    for (Int64U block_index = 0; block_index < blocks_count; ++block_index) {
+        SizeU block_stride = get_fixed_block_stride(&result);
 
-        if (block_fixed_size) {
-            current_block->stack = make_stack_view(data_cursor, block_size);
-        } else {
-            current_block->stack = make_stack_view(block_size);
-        }
-
-        if (block_index == blocks_count - 1) {
-            result.blocks.tail = current_block;
-            continue;
-        }
+        result.fixed_data = static_cast<Byte *>(allocate(blocks_count * block_stride, ALLOCATE_ZERO_MEMORY));
+        assert(result.fixed_data);
 
-        Block *next_block = nullptr;
+        for (Int64U block_index = 0; block_index < blocks_count; ++block_index) {
+            Block *block = result.blocks.head + block_index;
+            block->index = block_index;
+            block->stack = make_stack_view(result.fixed_data + block_index * block_stride, block_size);
 
-        if (block_count_limit) {
-            next_block = result.blocks.head + block_index + 1;
-        } else {
-            next_block = allocate_struct<Block>();
+            if (block_index > 0) {
+                block->previous = block - 1;
+                block->previous->next = block;
+            }
         }
 
-        current_block->next = next_block;
-        next_block->previous = current_block;
+        result.blocks.tail = result.blocks.head + blocks_count - 1;
+    } else {
+        for (Int64U block_index = 0; block_index < blocks_count; ++block_index) {
+            Block *block = make_joined_block(block_size, block_index);
+            insert_into_block_set(&result, block, blocks_count);
+
+            if (result.blocks.tail != nullptr) {
+                result.blocks.tail->next = block;
+                block->previous = result.blocks.tail;
+            } else {
+                result.blocks.head = block;
+            }
 
-        if (block_fixed_size) {
-            data_cursor += block_size;
+            result.blocks.tail = block;
         }
-
-        current_block = current_block->next;
     }
 
+    result.free_block_hint = result.blocks.head;
+
     return result;
 }
 
 
 
 void *
-mm::allocate(mm::Block_Allocator *allocator, SizeU size, mm::Allocate_Options options)
+mm::allocate(mm::Block_Allocator *allocator, SizeU size, mm::Allocate_Options options, SizeU alignment)
 {
     assert(allocator && size);
 
     if (allocator->block_fixed_size != 0) {
         assert(size == allocator->block_fixed_size);
+        assert(alignment <= DEFAULT_ALIGNMENT);
     }
 
-    FOR_LINKED_LIST(it, &allocator->blocks) {
-        void *result = mm::allocate(&it->stack, size);
+    for (Block *it = allocator->free_block_hint; it != nullptr; it = it->next) {
+        void *result = mm::allocate(&it->stack, size, alignment);
+
+        //
+        // NOTE(gr3yknigh1): Skipping full blocks for good, and blocks which can't fit the allocation too. Without it,
+        // filling N blocks is quadratic, because each allocation walks all blocks before it. Blocks are not full
+        // when allocation size doesn't divide the block, their rest is reused only after `reset`. [2026/10/17]
+        //
+        if (it == allocator->free_block_hint && (result == nullptr || it->stack.occupied == it->stack.capacity)) {
+            allocator->free_block_hint = it->next;
+        }
+
         if (result != nullptr) {
 
             if (NOC_HAS_FLAG(options, ALLOCATE_ZERO_MEMORY)) {
@@ -569,18 +3121,7 @@ mm::allocate(mm::Block_Allocator *allocator, SizeU size, mm::Allocate_Options op
     //
     // Block count limit is exceeded
     //
-    if (allocator->block_count_limit && allocator->block_fixed_size) {
-        //                              ^^^^^^^^^^^^^^^^^^^^^^^^^^^
-        // TODO(gr3yknigh1): Wrap `Block` in allocation-chunks (likewise data blobs). Because we can't free
-        // such blocks and semantics can allow only make `Pool`-like allocations or variable-size blocks, where each
-        // block and data is a separate allocations. [2025/03/10]
-        //
-        // TODO(gr3yknigh1): Try make block and data-blob allocation joined, when only `block_fixed_size` parameter is
-        // specified [2025/03/10]
-        //
-
-        // All blocks should be preallocated
-        assert(allocator->blocks.count == allocator->block_count_limit);
+    if (allocator->block_count_limit && allocator->blocks.count >= allocator->block_count_limit) {
         return nullptr;
     }
 
@@ -589,11 +3130,12 @@ mm::allocate(mm::Block_Allocator *allocator, SizeU size, mm::Allocate_Options op
     // for preallocated blocks for grow. We need add function like `block_allocator_pre_allocate(block_size, block_count);` in order to make it more compact.
     // [2025/03/10]
     //
-    mm::Block *new_block = mm::allocate_struct<mm::Block>();
-    noxx::zero_type(new_block);
+    mm::Block *new_block = make_joined_block(noc_align_to_page_size(size + alignment - 1), allocator->blocks.count);
+    insert_into_block_set(allocator, new_block, allocator->blocks.count + 1);
 
     if (allocator->blocks.count > 0) {
         allocator->blocks.tail->next = new_block;
+        new_block->previous = allocator->blocks.tail;
     } else {
         allocator->blocks.head = new_block;
     }
@@ -601,13 +3143,11 @@ mm::allocate(mm::Block_Allocator *allocator, SizeU size, mm::Allocate_Options op
     allocator->blocks.tail = new_block;
     allocator->blocks.count++;
 
-    if (allocator->block_fixed_size) {
-        new_block->stack = mm::make_stack_view(allocator->block_fixed_size);
-    } else {
-        new_block->stack = mm::make_stack_view(noc_align_to_page_size(size));
+    if (allocator->free_block_hint == nullptr) {
+        allocator->free_block_hint = new_block;
     }
 
-    void *result = mm::allocate(&new_block->stack, size);
+    void *result = mm::allocate(&new_block->stack, size, alignment);
 
     if (result && NOC_HAS_FLAG(options, ALLOCATE_ZERO_MEMORY)) {
         noc_memory_zero(result, size);
@@ -626,36 +3166,24 @@ mm::destroy_block_allocator(mm::Block_Allocator *allocator)
         return true;
     }
 
-    assert((allocator->block_fixed_size && allocator->block_count_limit)
-        || (!allocator->block_fixed_size && !allocator->block_count_limit));
-
     bool result = true;
 
     if (allocator->block_fixed_size) {
-        result = mm::deallocate( static_cast<void *>( allocator->blocks.head->stack.data ) );
+        result = mm::deallocate( static_cast<void *>( allocator->fixed_data ) );
         if (result) {
             result = mm::deallocate( static_cast<void *>( allocator->blocks.head ) );
         }
     } else {
+        Block *it = allocator->blocks.head;
 
-        FOR_LINKED_LIST(it, &allocator->blocks) {
-            result = mm::deallocate(it->stack.data);
-
-            if (result && it->previous != nullptr) {
-                result = mm::deallocate( static_cast<void *>( it->previous ) );
-            }
-
-            if (result && it->next == nullptr) {
-                result = mm::deallocate( static_cast<void *>( it ) );
-                break;
-            }
-
-            if (!result) {
-                break;
-            }
+        while (result && it != nullptr) {
+            Block *next_block = it->next;
+            result = mm::deallocate( static_cast<void *>( it ) );
+            it = next_block;
         }
-    }
 
+        result = result && mm::deallocate(allocator->block_set);
+    }
 
     return result;
 }
@@ -669,14 +3197,18 @@ mm::can_hold(mm::Stack_View *view, SizeU size)
 }
 
 void *
-mm::allocate(mm::Stack_View *view, SizeU size)
+mm::allocate(mm::Stack_View *view, SizeU size, SizeU alignment)
 {
-    if (!mm::can_hold(view, size)) {
+    assert(mm::is_power_of_two(alignment));
+
+    SizeU padding = mm::get_alignment_padding(noxx::get_offset(view->data, view->occupied), alignment);
+
+    if (!mm::can_hold(view, size + padding)) {
         return nullptr;
     }
 
-    void *result = noxx::get_offset(view->data, view->occupied);
-    view->occupied += size;
+    void *result = noxx::get_offset(view->data, view->occupied + padding);
+    view->occupied += padding + size;
     return result;
 }
 
@@ -708,19 +3240,57 @@ mm::reset(mm::Stack_View *view)
     return true;
 }
 
+mm::Block *
+mm::get_owner_block(mm::Block_Allocator *allocator, void *data)
+{
+    assert(allocator);
+
+    if (data == nullptr || !allocator->blocks.count) {
+        return nullptr;
+    }
+
+    if (allocator->block_fixed_size) {
+        Byte *byte = static_cast<Byte *>(data);
+
+        SizeU block_stride = get_fixed_block_stride(allocator);
+
+        if (byte < allocator->fixed_data || byte >= allocator->fixed_data + allocator->blocks.count * block_stride) {
+            return nullptr;
+        }
+
+        return allocator->blocks.head + (byte - allocator->fixed_data) / block_stride;
+    }
+
+    //
+    // NOTE(gr3yknigh1): Header at `data - BLOCK_HEADER_SIZE` isn't read until it's found in `block_set`, because for
+    // pointer, which isn't first allocation in it's block (or isn't owned by allocator at all), there is payload or
+    // foreign memory. [2026/10/17]
+    //
+    Block *candidate = reinterpret_cast<Block *>(static_cast<Byte *>(data) - BLOCK_HEADER_SIZE);
+
+    if (*find_block_set_slot(allocator, candidate) != candidate) {
+        return nullptr;
+    }
+
+    return candidate;
+}
+
 bool
 mm::reset(mm::Block_Allocator *allocator, void *data)
 {
-    bool result = false;
+    Block *block = get_owner_block(allocator, data);
 
-    FOR_LINKED_LIST(it, &allocator->blocks) {
-        if (it->stack.data == data) {
-            result = mm::reset(&it->stack);
-            break;
-        }
+    if (block == nullptr) {
+        return false;
     }
 
-    return result;
+    Block *hint = allocator->free_block_hint;
+
+    if (hint == nullptr || block->index < hint->index) {
+        allocator->free_block_hint = block;
+    }
+
+    return mm::reset(&block->stack);
 }
 
 void *
@@ -741,20 +3311,22 @@ mm::next(mm::Block_Allocator *allocator, void *data)
 {
     assert(allocator && data);
 
-    // NOTE(gr3yknigh1): Very inefficient [2025/03/10]
-    // @perf
+    Block *block = get_owner_block(allocator, data);
 
-    FOR_LINKED_LIST(it, &allocator->blocks) {
-        if (it->stack.data == data && it->next != nullptr) {
-            return it->next->stack.data;
-        }
+    if (block == nullptr || block->next == nullptr) {
+        return nullptr;
     }
-    return nullptr;
+
+    return block->next->stack.data;
 }
 
 
 #if defined(NOC_DETECT_PLATFORM_WINDOWS)
     #include "garden_runtime_win32.cpp"
+#elif defined(NOC_DETECT_PLATFORM_LINUX)
+    #include "garden_runtime_linux.cpp"
 #else
     #error "Unhandled platform! No runtime was included"
 #endif
+
+#include "garden_assets.cpp"
@@ -11,10 +11,12 @@
 #pragma once
 
 #include <stdio.h>
+#include <stddef.h> // max_align_t
 
 #include <source_location>
-#include <list>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 #include <glm/glm.hpp>
 #include <glm/ext.hpp>
@@ -112,6 +114,22 @@
 
 struct Asset;
 
+//!
+//! @brief Reference to the asset in `Asset_Store`: low 16 bits are slot index, high 16 bits are generation of the
+//! slot. Slot's generation changes when asset is released (see `asset_release`), so old handles go stale instead of
+//! pointing to the next asset in that slot. Zero is null handle, generations never get zero.
+//!
+struct Asset_Handle {
+    Int32U value;
+
+    constexpr bool is_null(void) const noexcept { return this->value == 0; }
+    constexpr Int16U index(void) const noexcept { return static_cast<Int16U>(this->value & 0xFFFF); }
+    constexpr Int16U generation(void) const noexcept { return static_cast<Int16U>(this->value >> 16); }
+
+    constexpr bool operator==(const Asset_Handle &other) const noexcept = default;
+};
+
+EXPECT_TYPE_SIZE(Asset_Handle, sizeof(Int32U));
 
 //! @note Two triangles.
 constexpr Int8U TILEMAP_VERTEX_COUNT_PER_TILE = 6;
@@ -125,10 +143,19 @@ struct Tilemap {
     Int32S tile_x_pixel_count;
     Int32S tile_y_pixel_count;
 
+    //!
+    //! @brief Allocated, or borrowed from asset archive (see `asset_location_contains`).
+    //!
     Int32S *indexes;
     SizeU indexes_count;
 
-    Asset *texture_asset;
+    Asset_Handle texture_asset; //!< Released with the tilemap (see `asset_unload`).
+
+    //!
+    //! @brief Allocated null-terminated path of tilemap image. Workers only parse tilemap, texture is loaded from this
+    //! path on main thread (see `asset_finish`).
+    //!
+    char *texture_path;
 
     constexpr Int32S tiles_count(void) noexcept { return this->row_count * this->col_count; }
 };
@@ -164,6 +191,7 @@ struct Source_Location {
     const char *function_name;
 
 
+    constexpr Source_Location() noexcept : file_name(nullptr), line(0), column(0), function_name(nullptr) {}
     constexpr Source_Location(std::source_location location) noexcept : file_name(location.file_name()), line(location.line()), column(location.column()), function_name(location.function_name()) {}
 };
 
@@ -233,6 +261,36 @@ struct Vertex {
 #pragma pack(pop)
 EXPECT_TYPE_SIZE(Vertex, sizeof(Float32) * 4 + sizeof(packed_rgba_t));
 
+//!
+//! @brief Compact vertex: position is relative to some origin (tilemap chunk), which is applied by the model matrix,
+//! UVs are normalized to [0; 1] (`65535` is `1.0`).
+//!
+#pragma pack(push, 1)
+struct Packed_Vertex {
+    Int16U x, y;
+    Int16U s, t;
+    packed_rgba_t color;
+};
+#pragma pack(pop)
+EXPECT_TYPE_SIZE(Packed_Vertex, sizeof(Int16U) * 4 + sizeof(packed_rgba_t));
+
+enum struct Vertex_Format {
+    Regular, //!< `Vertex`
+    Packed,  //!< `Packed_Vertex`
+};
+
+constexpr SizeU
+vertex_format_get_size(Vertex_Format format)
+{
+    return format == Vertex_Format::Packed ? sizeof(Packed_Vertex) : sizeof(Vertex);
+}
+
+//!
+//! @brief Quads are drawn as indexed triangles (see `generate_quad_indexes`), so corners aren't repeated.
+//!
+constexpr Int8U QUAD_VERTEX_COUNT = 4;
+constexpr Int8U QUAD_INDEX_COUNT = 6;
+
 #pragma pack(push, 1)
 struct Color_RGBA_U8 {
     Int8U r, g, b, a;
@@ -264,6 +322,18 @@ struct Camera {
     Camera_ViewMode view_mode = Camera_ViewMode::Perspective;
 };
 
+Camera make_camera(Camera_ViewMode view_mode);
+
+void      camera_rotate(Camera *camera, float x_offset, float y_offset);
+glm::mat4 camera_get_view_matrix(Camera *camera);
+glm::mat4 camera_get_projection_matrix(Camera *camera, int viewport_width, int viewport_height);
+
+//!
+//! @brief World rectangle seen by orthogonal camera. Matches the model transform of the runtimes: translation by
+//! camera position and by half of the viewport.
+//!
+Rect_F32 camera_get_view_rect(Camera *camera, int viewport_width, int viewport_height);
+
 //!
 //! @param[out] rect Output array of vertexes
 //!
@@ -275,6 +345,25 @@ Int32U generate_rect(Vertex *rect, Float32 x, Float32 y, Float32 width, Float32
 Int32U generate_rect_with_atlas(
     Vertex *rect, Float32 x, Float32 y, Float32 width, Float32 height, Rect_F32 location, Atlas *altas, Color4 color);
 
+//!
+//! @brief Same as `generate_rect_with_atlas`, but writes only `QUAD_VERTEX_COUNT` corners: bottom-left,
+//! bottom-right, top-right, top-left.
+//!
+Int32U generate_quad_with_atlas(
+    Vertex *quad, Float32 x, Float32 y, Float32 width, Float32 height, Rect_F32 location, Atlas *atlas, Color4 color);
+
+//!
+//! @brief Writes `QUAD_INDEX_COUNT` indexes per quad for quads, which vertexes are stored one after another. The
+//! pattern is the same for every buffer of quads, so single index buffer can be shared.
+//!
+void generate_quad_indexes(Int32U *indexes, Int32U quads_count);
+
+//!
+//! @brief Converts vertexes to `Packed_Vertex`. Positions are made relative to `origin_x`/`origin_y` and should fit
+//! into `Int16U`, UVs are clamped to [0; 1].
+//!
+void pack_vertexes(Packed_Vertex *packed, const Vertex *vertexes, Int32U vertexes_count, Float32 origin_x, Float32 origin_y);
+
 //!
 //! @param[out] vertexes Array of preallocated geometry-buffer to which this function will write.
 //!
@@ -284,6 +373,284 @@ Int32U generate_rect_with_atlas(
 //!
 Int32U generate_geometry_from_tilemap(Vertex *vertexes, Int32U vertexes_capacity, Tilemap *tilemap, Float32 origin_x, Float32 origin_y, Color4 color, Atlas *atlas);
 
+//!
+//! @brief UVs (`s0, t0, s1, t1`) of each tile index, computed once for pair of tilemap and atlas. Generation loads
+//! them instead of dividing for each vertex (see `make_tilemap_geometry`). Values are the same as
+//! `generate_quad_with_atlas` computes.
+//!
+struct Tilemap_UV_Table {
+    Float32 *uvs;        //!< Four per tile index, 16 bytes aligned.
+    Int16U *packed_uvs;  //!< Same UVs as `Packed_Vertex` stores them (see `pack_vertexes`).
+    Int32U count;        //!< Tiles with index out of the table have UVs computed as before.
+};
+
+constexpr Int32U TILEMAP_UV_TABLE_MAX_COUNT = 64 * 1024;
+
+//!
+//! @brief Makes table for tile indexes up to the biggest one in `tilemap` (but no more than
+//! `TILEMAP_UV_TABLE_MAX_COUNT`).
+//!
+bool make_tilemap_uv_table(Tilemap_UV_Table *table, Tilemap *tilemap, Atlas *atlas);
+void tilemap_uv_table_destroy(Tilemap_UV_Table *table);
+
+//!
+//! @brief Side of the tile in world units (see `generate_geometry_from_tilemap`).
+//!
+constexpr Float32 TILEMAP_TILE_SIZE = 100;
+
+//!
+//! @brief Chunks are squares of this much tiles per side. Edge chunks can be smaller.
+//!
+constexpr Int32S TILEMAP_CHUNK_TILE_COUNT = 16;
+
+static_assert(TILEMAP_CHUNK_TILE_COUNT * TILEMAP_TILE_SIZE <= 65535, "Chunk positions should fit into Packed_Vertex");
+
+struct Tilemap_Chunk {
+    Rect_F32 bounds; //!< In world units. Origin of `Packed_Vertex` positions.
+
+    Int32U first_vertex; //!< Into `Tilemap_Geometry::vertexes`.
+    Int32U vertexes_count;
+};
+
+//!
+//! @brief Bytes of `Tilemap_Geometry::vertexes`, which should be sent to GPU again.
+//!
+struct Tilemap_Dirty_Range {
+    SizeU offset;
+    SizeU size;
+};
+
+//!
+//! @brief If more tiles change between flushes, whole geometry is marked dirty.
+//!
+constexpr Int32U TILEMAP_MAX_DIRTY_TILES = 4096;
+
+//!
+//! @brief Tilemap geometry, which is generated once and split in chunks. Chunks are stored row by row, and vertexes of
+//! each chunk are contiguous, so visible chunks of one chunk row form single range (see `tilemap_geometry_cull`).
+//! Inside the chunk tiles are stored row by row too.
+//!
+//! Each tile is a quad, drawn with `indexes` (see `generate_quad_indexes`).
+//!
+struct Tilemap_Geometry {
+    Tilemap_Chunk *chunks;
+    Int32S chunk_row_count;
+    Int32S chunk_col_count;
+
+    Vertex_Format format;
+
+    union {
+        void *data;
+        Vertex *regular;
+        Packed_Vertex *packed;
+    } vertexes;
+    Int32U vertexes_count;
+
+    Int32U *indexes;
+    Int32U indexes_count;
+
+    //
+    // NOTE(gr3yknigh1): Parameters of generation, so single tile can be generated again (see `tilemap_set_tile`).
+    // [2026/10/17]
+    //
+    Int32S row_count;
+    Int32S col_count;
+    Float32 origin_x;
+    Float32 origin_y;
+    Color4 color;
+    Atlas atlas;
+
+    //
+    // Dirty tiles:
+    //
+    Int64U *dirty_marks; //!< Bit per tile, so each tile is queued once.
+    Int32U *dirty_tiles; //!< Offsets of changed tiles in `Tilemap::indexes`.
+    Int32U dirty_tiles_count;
+    bool is_all_dirty;
+
+    Tilemap_Dirty_Range *dirty_ranges; //!< Filled by `tilemap_geometry_flush_dirty`.
+    Int32U dirty_ranges_count;
+};
+
+//!
+//! @brief Range of `Tilemap_Geometry::indexes` to draw. For `Vertex_Format::Packed` positions should be translated
+//! by the origin of the range.
+//!
+struct Tilemap_Draw_Range {
+    Int32U first_index;
+    Int32U indexes_count;
+
+    Float32 origin_x;
+    Float32 origin_y;
+};
+
+//!
+//! @brief Generates quads of whole tilemap. UVs are taken from `Tilemap_UV_Table`, which is made for the call, and 4
+//! tiles of chunk row are generated per iteration with SSE2 (non-temporal stores, if geometry is bigger than
+//! `NOC_MEMORY_NON_TEMPORAL_THRESHOLD`). Without SIMD (see `noc_memory_get_simd_level`) tiles are generated one by
+//! one with `generate_quad_with_atlas`, output is the same.
+//!
+bool make_tilemap_geometry(
+    Tilemap_Geometry *geometry, Tilemap *tilemap, Float32 origin_x, Float32 origin_y, Color4 color, Atlas *atlas,
+    Vertex_Format format = Vertex_Format::Regular);
+void tilemap_geometry_destroy(Tilemap_Geometry *geometry);
+
+//!
+//! @brief Writes quads of all tiles again into geometry made by `make_tilemap_geometry` (e.g. after many tiles of
+//! `tilemap` changed). `table` should be made for the same tilemap and atlas.
+//!
+void tilemap_geometry_generate(Tilemap_Geometry *geometry, Tilemap *tilemap, const Tilemap_UV_Table *table);
+
+//!
+//! @brief Emits ranges of chunks, which overlap `view`. Only visible chunks are visited, so cost doesn't depend on the
+//! map size. Visible chunks of chunk row are merged into single range, except for `Vertex_Format::Packed`, where each
+//! chunk has it's own origin.
+//!
+//! @param[out] ranges Needs room for `chunk_row_count` ranges (`Regular`) or for count of chunks (`Packed`). Can be
+//! nullptr if geometry is empty.
+//!
+//! @return Count of written ranges.
+//!
+Int32U tilemap_geometry_cull(const Tilemap_Geometry *geometry, Rect_F32 view, Tilemap_Draw_Range *ranges, Int32U ranges_capacity);
+
+//!
+//! @brief Changes index of the tile and generates again only it's quad. Tile is marked dirty, so renderer
+//! uploads only changed bytes (see `tilemap_geometry_flush_dirty`).
+//!
+void tilemap_set_tile(Tilemap_Geometry *geometry, Tilemap *tilemap, Int32S col_index, Int32S row_index, Int32S tile_index);
+
+//!
+//! @brief Turns tiles, which changed since previous flush, into sorted and merged byte ranges in
+//! `geometry->dirty_ranges`, and clears dirty marks. Costs O(n log n) in count of changed tiles.
+//!
+//! @return Count of dirty ranges.
+//!
+Int32U tilemap_geometry_flush_dirty(Tilemap_Geometry *geometry);
+
+//
+// Sorting:
+//
+
+//!
+//! @brief Sort key with payload (usually index of the thing, which is sorted).
+//!
+struct Sort_Item {
+    Int64U key;
+    Int32U value;
+};
+
+//!
+//! @brief Stable LSD radix sort, byte per pass. Histograms of all bytes are counted in one pass over keys, and bytes,
+//! which are the same in every key (like high bits of small layers or handles), are skipped.
+//!
+//! @param[in] scratch Room for `count` items.
+//!
+//! @return `items` or `scratch`, whichever ended up holding sorted items.
+//!
+Sort_Item *radix_sort(Sort_Item *items, Sort_Item *scratch, SizeU count);
+
+//
+// Sprite batching:
+//
+
+//!
+//! @brief Sprite, which gameplay wants to draw this frame (see `sprite_batch_push`).
+//!
+struct Sprite {
+    Rect_F32 rect;     //!< In world units.
+    Rect_F32 location; //!< In pixels of the texture.
+    Atlas atlas;       //!< Size of the texture, for UVs.
+    Color4 color;
+
+    Int8U layer;   //!< Layers are drawn one after another, in increasing order.
+    Float32 depth; //!< Sprites with bigger depth are drawn first (they are farther).
+
+    Asset_Handle texture;
+    Asset_Handle shader;
+};
+
+struct Sprite_State {
+    Asset_Handle shader;
+    Asset_Handle texture;
+
+    constexpr bool operator==(const Sprite_State &other) const noexcept = default;
+};
+
+//!
+//! @brief Bits of asset slot index in the sort key. Asset store should have no more slots.
+//!
+constexpr Int32U SPRITE_SORT_KEY_SLOT_BITS = 12;
+
+//!
+//! @brief Key is `layer (8) | shader slot (12) | texture slot (12) | depth (32)`, from high bits to low. State goes
+//! before depth, so sprites of one layer are grouped by shader and texture, and depth orders sprites only inside of
+//! the group. Sprites with different state, which overlap, should be put on different layers.
+//!
+Int64U make_sprite_sort_key(Int8U layer, Sprite_State state, Float32 depth);
+
+//!
+//! @brief Range of `Sprite_Batch::indexes`, which is drawn with single shader and texture.
+//!
+struct Sprite_Draw {
+    Sprite_State state;
+
+    Int32U first_index;
+    Int32U indexes_count;
+};
+
+//!
+//! @brief Collects sprites of the frame and turns them into minimal list of draws: sprites are sorted by key (see
+//! `make_sprite_sort_key`) and neighbours with the same state are merged, so renderer switches shader or texture only
+//! between draws.
+//!
+struct Sprite_Batch {
+    Int32U capacity; //!< In sprites.
+    Int32U sprites_count;
+
+    Vertex *vertexes;      //!< `QUAD_VERTEX_COUNT` per sprite, in order of push.
+    Sprite_State *states;  //!< Per sprite.
+    Sort_Item *items;      //!< Key and index of each sprite.
+    Sort_Item *scratch_items;
+
+    //
+    // NOTE(gr3yknigh1): Filled by `sprite_batch_build`. [2026/10/17]
+    //
+    Vertex *sorted_vertexes;
+    Sprite_Draw *draws;
+    Int32U draws_count;
+
+    //!
+    //! @brief Quad indexes for whole capacity (see `generate_quad_indexes`). They are the same each frame, so can be
+    //! uploaded once.
+    //!
+    Int32U *indexes;
+    Int32U indexes_count;
+};
+
+constexpr Int32U SPRITE_BATCH_DEFAULT_CAPACITY = 16 * 1024;
+
+bool make_sprite_batch(Sprite_Batch *batch, Int32U capacity = SPRITE_BATCH_DEFAULT_CAPACITY);
+void sprite_batch_destroy(Sprite_Batch *batch);
+
+//!
+//! @brief Generates quad of the sprite and remembers it's key.
+//!
+//! @return False if batch is full.
+//!
+bool sprite_batch_push(Sprite_Batch *batch, const Sprite *sprite);
+
+//!
+//! @brief Sorts sprites, writes their quads in sorted order into `sorted_vertexes` and merges them into `draws`.
+//!
+//! @return Count of draws.
+//!
+Int32U sprite_batch_build(Sprite_Batch *batch);
+
+//!
+//! @brief Forgets sprites of the frame. Call after batch is drawn.
+//!
+void sprite_batch_reset(Sprite_Batch *batch);
+
 //
 // MM (memory management):
 //
@@ -305,21 +672,65 @@ struct Buffer_View {
 
 typedef Int32U Allocate_Options;
 
-void *allocate(SizeU size, mm::Allocate_Options options = ALLOCATE_NO_OPTS);
+//!
+//! @brief Alignment of allocations, if other is not specified. Same as `malloc` gives.
+//!
+constexpr SizeU DEFAULT_ALIGNMENT = alignof(max_align_t);
+
+//!
+//! @brief Pass as alignment to put allocation on it's own cache line (no false sharing, aligned SIMD loads and stores).
+//!
+constexpr SizeU CACHE_LINE_SIZE = 64;
+
+//!
+//! @brief Alignment which typed allocations (`allocate_struct`, `allocate_structs`) use by default. Types with
+//! `alignas` get their alignment, others get `DEFAULT_ALIGNMENT`. Packed types (like `Vertex`) have alignment of one,
+//! but arrays of them still should start aligned for SIMD.
+//!
+template <typename Ty>
+constexpr SizeU
+default_alignment_of(void) noexcept
+{
+    return alignof(Ty) > DEFAULT_ALIGNMENT ? alignof(Ty) : DEFAULT_ALIGNMENT;
+}
+
+constexpr bool
+is_power_of_two(SizeU value) noexcept
+{
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+//!
+//! @brief Number of bytes which should be skipped from `pointer` to make it aligned.
+//!
+inline SizeU
+get_alignment_padding(const void *pointer, SizeU alignment) noexcept
+{
+    SizeU address = reinterpret_cast<SizeU>(pointer);
+    return (alignment - (address & (alignment - 1))) & (alignment - 1);
+}
+
+//!
+//! @brief Allocates from the heap. If `GARDEN_TRACK_ALLOCATIONS` is defined, allocation is counted for the `location`
+//! call site (see `get_allocation_stats`).
+//!
+void *allocate(SizeU size, mm::Allocate_Options options = ALLOCATE_NO_OPTS, Source_Location location = Source_Location(std::source_location::current()));
 bool deallocate(void *p);
 
 template <typename Ty>
 inline Ty *
-allocate_struct(Allocate_Options options = ALLOCATE_NO_OPTS)
+allocate_struct(Allocate_Options options = ALLOCATE_NO_OPTS, Source_Location location = Source_Location(std::source_location::current()))
 {
-    return static_cast<Ty *>(allocate(sizeof(Ty), options));
+    static_assert(alignof(Ty) <= DEFAULT_ALIGNMENT, "Heap gives only DEFAULT_ALIGNMENT, use arena with explicit alignment");
+    return static_cast<Ty *>(allocate(sizeof(Ty), options, location));
 }
 
 template <typename Ty>
 inline Ty *
-allocate_structs(Int64U count, Allocate_Options options = ALLOCATE_NO_OPTS)
+allocate_structs(Int64U count, Allocate_Options options = ALLOCATE_NO_OPTS, Source_Location location = Source_Location(std::source_location::current()))
 {
-    return static_cast<Ty *>(allocate(sizeof(Ty) * count, options));
+    static_assert(alignof(Ty) <= DEFAULT_ALIGNMENT, "Heap gives only DEFAULT_ALIGNMENT, use arena with explicit alignment");
+    return static_cast<Ty *>(allocate(sizeof(Ty) * count, options, location));
 }
 
 //!
@@ -333,20 +744,20 @@ struct Fixed_Arena {
 
 Fixed_Arena  make_static_arena(SizeU capacity);
 bool         destroy(Fixed_Arena *arena);
-void *       allocate(Fixed_Arena *arena, SizeU size, Allocate_Options options = ALLOCATE_NO_OPTS);
+void *       allocate(Fixed_Arena *arena, SizeU size, Allocate_Options options = ALLOCATE_NO_OPTS, SizeU alignment = DEFAULT_ALIGNMENT);
 
 template <typename Ty>
 inline Ty *
-allocate_structs(Fixed_Arena *arena, Int64U count, Allocate_Options options = ALLOCATE_NO_OPTS)
+allocate_structs(Fixed_Arena *arena, Int64U count, Allocate_Options options = ALLOCATE_NO_OPTS, SizeU alignment = default_alignment_of<Ty>())
 {
-    return static_cast<Ty *>(allocate(arena, sizeof(Ty) * count, options));
+    return static_cast<Ty *>(allocate(arena, sizeof(Ty) * count, options, alignment));
 }
 
 template <typename Ty>
 inline Ty *
-allocate_struct(Fixed_Arena *arena, Allocate_Options options = ALLOCATE_NO_OPTS)
+allocate_struct(Fixed_Arena *arena, Allocate_Options options = ALLOCATE_NO_OPTS, SizeU alignment = default_alignment_of<Ty>())
 {
-    return static_cast<Ty *>(allocate(arena, sizeof(Ty), options));
+    return static_cast<Ty *>(allocate(arena, sizeof(Ty), options, alignment));
 }
 
 //!
@@ -356,6 +767,115 @@ allocate_struct(Fixed_Arena *arena, Allocate_Options options = ALLOCATE_NO_OPTS)
 //!
 SizeU reset(Fixed_Arena *arena);
 
+//!
+//! @brief Arena which reserves big range of address space up front and commits pages only when allocations reach
+//! them. Never moves: pointers stay valid while arena grows, and there is no copying.
+//!
+struct Virtual_Arena {
+    Byte *data;
+
+    //!
+    //! @brief Size of reserved address range. Allocation fails only when this is exhausted.
+    //!
+    SizeU reserved;
+
+    //!
+    //! @brief Size of the range (from `data`), which is backed by physical memory.
+    //!
+    SizeU committed;
+
+    SizeU occupied;
+
+    //!
+    //! @brief Biggest `occupied` since creation or previous `decommit_to_high_water`.
+    //!
+    SizeU high_water;
+};
+
+//!
+//! @brief Granularity in which `Virtual_Arena` commits pages. Bigger than page size, so growth makes less syscalls.
+//!
+constexpr SizeU VIRTUAL_ARENA_COMMIT_GRANULARITY = 64 * 1024;
+
+//!
+//! @brief Address range, which is reserved for arena by default. Costs nothing until committed.
+//!
+constexpr SizeU VIRTUAL_ARENA_DEFAULT_RESERVE_SIZE = 64ULL * 1024 * 1024 * 1024;
+
+Virtual_Arena make_virtual_arena(SizeU reserve_size = VIRTUAL_ARENA_DEFAULT_RESERVE_SIZE);
+bool          destroy(Virtual_Arena *arena);
+void *        allocate(Virtual_Arena *arena, SizeU size, Allocate_Options options = ALLOCATE_NO_OPTS, SizeU alignment = DEFAULT_ALIGNMENT);
+
+template <typename Ty>
+inline Ty *
+allocate_structs(Virtual_Arena *arena, Int64U count, Allocate_Options options = ALLOCATE_NO_OPTS, SizeU alignment = default_alignment_of<Ty>())
+{
+    return static_cast<Ty *>(allocate(arena, sizeof(Ty) * count, options, alignment));
+}
+
+template <typename Ty>
+inline Ty *
+allocate_struct(Virtual_Arena *arena, Allocate_Options options = ALLOCATE_NO_OPTS, SizeU alignment = default_alignment_of<Ty>())
+{
+    return static_cast<Ty *>(allocate(arena, sizeof(Ty), options, alignment));
+}
+
+//!
+//! @brief Sets occupied field to zero. Committed pages are kept, so next frame does not pay for commit again.
+//!
+//! @returns Number of bytes which was occupied.
+//!
+SizeU reset(Virtual_Arena *arena);
+
+//!
+//! @brief Gives back physical memory above the high-water mark (biggest `occupied` since previous call) and starts new
+//! high-water window. Call it periodically for arenas which are reset each frame, so spike does not pin memory forever.
+//!
+//! @returns Number of bytes which was decommitted.
+//!
+SizeU decommit_to_high_water(Virtual_Arena *arena);
+
+//!
+//! @brief Remembers `occupied` of arena-like allocator (`Fixed_Arena`, `Virtual_Arena`, `Stack_View`) and rolls it
+//! back at the end of the scope. Frees temporary allocations without wiping allocations made before the scope.
+//!
+//! @code
+//! {
+//!     mm::Temp_Scope temp(mm::get_scratch_arena());
+//!     char *buffer = static_cast<char *>(mm::allocate(temp.arena, size));
+//!     ...
+//! } // buffer is freed here
+//! @endcode
+//!
+template <typename Arena_Type>
+struct Temp_Scope {
+    Arena_Type *arena;
+    SizeU occupied;
+
+    explicit Temp_Scope(Arena_Type *arena_) noexcept : arena(arena_), occupied(arena_->occupied) {}
+    ~Temp_Scope(void) noexcept { this->arena->occupied = this->occupied; }
+
+    Temp_Scope(const Temp_Scope &) = delete;
+    Temp_Scope &operator=(const Temp_Scope &) = delete;
+};
+
+//!
+//! @brief Address range, which is reserved for scratch arena of each thread.
+//!
+constexpr SizeU SCRATCH_ARENA_RESERVE_SIZE = 4ULL * 1024 * 1024 * 1024;
+
+//!
+//! @brief Returns arena of the calling thread for temporary allocations (parsing, loading). Created on first use.
+//! Always allocate from it inside of `Temp_Scope`.
+//!
+Virtual_Arena *get_scratch_arena(void);
+
+//!
+//! @brief Releases scratch arena of the calling thread. Threads, which used it, should call it before exit, otherwise
+//! reserved range is lost (same as with `pool_flush_thread_cache`).
+//!
+void release_scratch_arena(void);
+
 struct Stack_View {
     void *data;
     SizeU capacity;
@@ -366,7 +886,7 @@ bool can_hold(Stack_View *view, SizeU size);
 
 bool reset(Stack_View *view);
 
-void *allocate(Stack_View *view, SizeU size);
+void *allocate(Stack_View *view, SizeU size, SizeU alignment = DEFAULT_ALIGNMENT);
 
 //!
 //! @brief Initializes a view in stack-like data-block, and do not own it. Free it yourself!
@@ -382,6 +902,11 @@ struct Block {
     Block *next;
     Block *previous;
 
+    //!
+    //! @brief Position of the block in the list. Used to order blocks without walking the list.
+    //!
+    Int64U index;
+
     Stack_View stack;
 };
 
@@ -406,8 +931,35 @@ struct Block_Allocator {
     //! limit to block allocation.
     //!
     Int64U block_count_limit;
+
+    //!
+    //! @brief In fixed-size mode data of all blocks is a single allocation: data of the block with index `i` starts at
+    //! `fixed_data + i * stride`, where stride is `block_fixed_size` rounded up to `DEFAULT_ALIGNMENT`. So owner
+    //! block of a pointer is found with arithmetic. Nullptr otherwise.
+    //!
+    Byte *fixed_data;
+
+    //!
+    //! @brief Open addressing set of variable-size blocks. Owner of a pointer is looked up here, so memory before the
+    //! pointer (which may be payload of other allocation) is never read. Capacity is power of two and at least twice
+    //! as big as count of blocks. Nullptr in fixed-size mode.
+    //!
+    Block **block_set;
+    Int64U block_set_capacity;
+
+    //!
+    //! @brief Search for free space starts from here. All blocks before it are full, or were too small for some
+    //! allocation. Nullptr if all blocks are skipped.
+    //!
+    Block *free_block_hint;
 };
 
+//!
+//! @brief Size of header, which is placed right before the data of each variable-size block. Rounded up, so data
+//! stays aligned.
+//!
+constexpr SizeU BLOCK_HEADER_SIZE = (sizeof(Block) + 15) & ~static_cast<SizeU>(15);
+
 Block_Allocator make_block_allocator();
 
 //!
@@ -415,79 +967,253 @@ Block_Allocator make_block_allocator();
 //!
 Block_Allocator make_block_allocator(Int64U blocks_count, SizeU block_size, SizeU block_fixed_size = 0, Int64U block_count_limit = 0);
 
-void *allocate(Block_Allocator *allocator, SizeU size, Allocate_Options options = ALLOCATE_NO_OPTS);
+//!
+//! @note Fixed-size blocks start at `DEFAULT_ALIGNMENT` boundary, so they can't be over-aligned.
+//!
+void *allocate(Block_Allocator *allocator, SizeU size, Allocate_Options options = ALLOCATE_NO_OPTS, SizeU alignment = DEFAULT_ALIGNMENT);
+
+template <typename Ty>
+inline Ty *
+allocate_struct(Block_Allocator *allocator, Allocate_Options options = ALLOCATE_NO_OPTS, SizeU alignment = default_alignment_of<Ty>())
+{
+    return static_cast<Ty *>(allocate(allocator, sizeof(Ty), options, alignment));
+}
+
+bool reset(Block_Allocator *allocator, void *data);
+
+//!
+//! @brief Finds block which owns the data in constant time.
+//!
+//! @pre In fixed-size mode `data` can point anywhere inside of the block. Otherwise it should point to the start of
+//! block data (the value returned by `first`, `next` or by the first allocation in a block).
+//!
+//! @return Nullptr if data is not owned by this allocator or (in variable-size mode) isn't start of block data.
+//!
+Block *get_owner_block(Block_Allocator *allocator, void *data);
+
+void *first(Block_Allocator *allocator);
+void *next(Block_Allocator *allocator, void *data);
+
+bool destroy_block_allocator(Block_Allocator *allocator);
+
+//!
+//! @brief Allocations which was made from one call site of `allocate`.
+//!
+struct Allocation_Site {
+    Source_Location location;
+
+    Int64U allocations_count;
+    Int64U deallocations_count;
+
+    //!
+    //! @brief Bytes which are still not deallocated. Non zero value at exit is a leak.
+    //!
+    Int64S live_bytes;
+    Int64U total_bytes;
+};
+
+struct Allocation_Stats {
+    Int64S live_bytes;
+
+    //!
+    //! @brief Max of `live_bytes` over the whole run.
+    //!
+    Int64S high_water_bytes;
+
+    Int64U allocations_count;
+    Int64U deallocations_count;
+    Int64U sites_count;
+};
+
+//!
+//! @brief Allocations are tracked only if `GARDEN_TRACK_ALLOCATIONS` is defined. Each thread counts allocations in
+//! it's own table of call sites, without locks. Tables are merged only when stats are requested.
+//!
+constexpr bool
+is_allocation_tracking_enabled(void) noexcept
+{
+#if defined(GARDEN_TRACK_ALLOCATIONS)
+    return GARDEN_TRACK_ALLOCATIONS;
+#else
+    return false;
+#endif
+}
+
+//!
+//! @brief Merges call site tables of all threads. Sites with same location from different threads are summed up.
+//!
+//! @param[out] sites Output buffer. Can be nullptr, if only count is needed.
+//! @return Count of unique call sites (can be bigger than `sites_capacity`, then only part of sites is written).
+//!
+SizeU collect_allocation_sites(Allocation_Site *sites, SizeU sites_capacity);
+
+Allocation_Stats get_allocation_stats(void);
+
+//!
+//! @brief Dump merged call sites into console.
+//!
+//! @param only_live Skip call sites, which have no live allocations.
+//!
+//! @return True if any live allocations was dumped into console.
+//!
+bool dump_allocation_records(bool only_live = true);
+
+constexpr Int32U ALLOCATION_DUMP_MAGIC = 0x524D4147; // "GAMR"
+constexpr Int32U ALLOCATION_DUMP_VERSION = 1;
+
+#pragma pack(push, 1)
+
+//!
+//! @brief Header of binary dump (see `dump_allocation_records_to_file`). Followed by `sites_count` of
+//! `Allocation_Dump_Site`.
+//!
+struct Allocation_Dump_Header {
+    Int32U magic;
+    Int32U version;
+
+    Int64S live_bytes;
+    Int64S high_water_bytes;
+    Int64U allocations_count;
+    Int64U deallocations_count;
+    Int64U sites_count;
+};
+
+//!
+//! @brief Each site is followed by file name and function name (without null-terminator).
+//!
+struct Allocation_Dump_Site {
+    Int32U line;
+    Int32U column;
+
+    Int64U allocations_count;
+    Int64U deallocations_count;
+    Int64S live_bytes;
+    Int64U total_bytes;
+
+    Int16U file_name_length;
+    Int16U function_name_length;
+};
+
+#pragma pack(pop)
+
+//!
+//! @brief Writes stats and all call sites into file in binary format, for offline analysis.
+//!
+bool dump_allocation_records_to_file(const char *file_path);
+
+
+struct Basic_Allocator {};
+
+template<typename Allocator_Type>
+constexpr bool
+external_lifetime()
+{
+    return true;
+}
+
+template<>
+constexpr bool
+external_lifetime<Basic_Allocator>()
+{
+    return false;
+}
+
+inline void *
+allocate([[maybe_unused]] Basic_Allocator *allocator, SizeU size, Allocate_Options options = ALLOCATE_NO_OPTS, Source_Location location = Source_Location(std::source_location::current())) noexcept
+{
+    return allocate(size, options, location);
+}
+
+inline bool
+deallocate([[maybe_unused]] Basic_Allocator *allocator, void *data) noexcept
+{
+    deallocate(data);
+    return true; // XXX
+}
 
 template <typename Ty>
 inline Ty *
-allocate_struct(Block_Allocator *allocator, Allocate_Options options = ALLOCATE_NO_OPTS)
+allocate_struct([[maybe_unused]] Basic_Allocator *allocator, Allocate_Options options = ALLOCATE_NO_OPTS, Source_Location location = Source_Location(std::source_location::current()))
 {
-    return static_cast<Ty *>(allocate(allocator, sizeof(Ty), options));
+    static_assert(alignof(Ty) <= DEFAULT_ALIGNMENT, "Heap gives only DEFAULT_ALIGNMENT, use arena with explicit alignment");
+    return static_cast<Ty *>(allocate(allocator, sizeof(Ty), options, location));
 }
 
-bool reset(Block_Allocator *allocator, void *data);
-
-void *first(Block_Allocator *allocator);
-void *next(Block_Allocator *allocator, void *data);
-
-bool destroy_block_allocator(Block_Allocator *allocator);
-
-struct Allocation_Record {
-    Allocate_Options options;
-    SizeU size;
-    void *result;
-    Source_Location location;
-};
+//
+// Pool allocator:
+//
 
 //!
-//! @brief Returns pointer to allocation record list which was made with `allocate` function. [2025/04/25]
+//! @brief Biggest size, which is served by the pool. Bigger allocations go to `noc_allocate`.
 //!
-//! @todo(gr3yknigh1): Make it per-thread. [2025/04/25]
-//!
-std::list<Allocation_Record> *get_allocation_records(void);
+constexpr SizeU POOL_MAX_SIZE = 4096;
 
 //!
-//! @brief Dump all records into console.
+//! @brief Thread-caching small object allocator. Sizes are rounded up to one of the size classes, each class has free
+//! list per thread. Thread free lists are refilled (and drained) in batches from shared per-class lists, which are
+//! carved from spans of reserved address range. So lock is taken only once per batch, not per allocation.
 //!
-//! @return True if any allocations was dumped into console.
+//! Memory is never returned to the system, freed objects are reused by the same size class. `allocate` uses it for
+//! sizes up to `POOL_MAX_SIZE`.
 //!
-//! @todo(gr3yknigh1): Add option to dump it all into disk. [2025/04/25]
+//! @return nullptr if `size` is bigger than `POOL_MAX_SIZE` or pool is out of reserved range.
 //!
-bool dump_allocation_records(bool do_hex_dump = false);
+void *pool_allocate(SizeU size);
 
+//!
+//! @return False if `data` was not allocated by the pool.
+//!
+bool pool_deallocate(void *data);
 
-struct Basic_Allocator {};
+bool pool_owns(const void *data);
 
-template<typename Allocator_Type>
-constexpr bool
-external_lifetime()
-{
-    return true;
-}
+//!
+//! @brief Gives free lists of calling thread back to shared lists. Worker threads should call it before exit, otherwise
+//! cached objects are lost.
+//!
+//! @note There is no thread-exit hook on purpose: `thread_local` with destructor pins gameplay module in memory on
+//! Linux, so it can't be reloaded. [2026/10/17]
+//!
+void pool_flush_thread_cache(void);
+
+//!
+//! @brief Allocator type for containers (see `Linked_List`), which takes memory directly from the pool.
+//!
+//! @note Unlike `Basic_Allocator`, allocations are not tracked with `GARDEN_TRACK_ALLOCATIONS`.
+//!
+struct Pool_Allocator {};
 
 template<>
 constexpr bool
-external_lifetime<Basic_Allocator>()
+external_lifetime<Pool_Allocator>()
 {
     return false;
 }
 
 inline void *
-allocate([[maybe_unused]] Basic_Allocator *allocator, SizeU size, Allocate_Options options = ALLOCATE_NO_OPTS) noexcept
+allocate([[maybe_unused]] Pool_Allocator *allocator, SizeU size, Allocate_Options options = ALLOCATE_NO_OPTS) noexcept
 {
-    return allocate(size, options);
+    void *result = size <= POOL_MAX_SIZE ? pool_allocate(size) : noc_allocate(size);
+    if (result && NOC_HAS_FLAG(options, ALLOCATE_ZERO_MEMORY)) {
+        noc_memory_zero(result, size);
+    }
+    return result;
 }
 
 inline bool
-deallocate([[maybe_unused]] Basic_Allocator *allocator, void *data) noexcept
+deallocate([[maybe_unused]] Pool_Allocator *allocator, void *data) noexcept
 {
-    deallocate(data);
-    return true; // XXX
+    if (data != nullptr && !pool_deallocate(data)) {
+        noc_free(data);
+    }
+    return true;
 }
 
 template <typename Ty>
 inline Ty *
-allocate_struct([[maybe_unused]] Basic_Allocator *allocator, Allocate_Options options = ALLOCATE_NO_OPTS)
+allocate_struct(Pool_Allocator *allocator, Allocate_Options options = ALLOCATE_NO_OPTS)
 {
+    static_assert(alignof(Ty) <= DEFAULT_ALIGNMENT, "Pool gives only DEFAULT_ALIGNMENT, use arena with explicit alignment");
     return static_cast<Ty *>(allocate(allocator, sizeof(Ty), options));
 }
 
@@ -505,6 +1231,11 @@ allocate_struct([[maybe_unused]] Basic_Allocator *allocator, Allocate_Options op
 constexpr void
 str8_copy_to(void *destination, const char *source, size_t source_length, size_t destination_size) noexcept
 {
+    if (!std::is_constant_evaluated()) {
+        noc_memory_copy(destination, source, source_length < destination_size ? source_length : destination_size);
+        return;
+    }
+
     size_t index = 0;
 
     while (index < source_length && index < destination_size) {
@@ -514,95 +1245,168 @@ str8_copy_to(void *destination, const char *source, size_t source_length, size_t
 }
 
 //!
-//! @brief Owning string type which is implemented using RAII.
+//! @brief Strings, which fit into this size (with null-terminator), are stored inside of `Basic_Str8` without
+//! allocation. Enough for most of report messages.
+//!
+constexpr size_t STR8_INLINE_CAPACITY = 48;
+
+//!
+//! @brief Owning string type which is implemented using RAII. Memory is taken from `Allocator_Type`, but if allocator
+//! has external lifetime (arenas) string never gives it back.
 //!
-class Str8 {
+//! Short strings are stored inline, then `data` points into the string itself. So it can be copied only with
+//! constructors, not with `memcpy`.
+//!
+template <typename Allocator_Type = mm::Basic_Allocator>
+class Basic_Str8 {
 public:
     char *data;
     size_t length;
+    Allocator_Type *allocator;
 
-    constexpr inline Str8(void) noexcept : data(nullptr), length(0) {}
+    constexpr inline Basic_Str8(void) noexcept : data(nullptr), length(0), allocator(nullptr) {}
 
     constexpr explicit
-    Str8(const char *data_) noexcept
-        : Str8(data_, noc_str8z_length(data_))
+    Basic_Str8(const char *data_) noexcept
+        : Basic_Str8(data_, noxx::str8z_length(data_))
     { }
 
+    //!
+    //! @param allocator_ Can be nullptr for stateless allocators (`mm::Basic_Allocator`, `mm::Pool_Allocator`).
+    //!
     constexpr explicit
-    Str8(const char *data_, size_t length_) noexcept
-        : data(nullptr), length(length_)
+    Basic_Str8(const char *data_, size_t length_, Allocator_Type *allocator_ = nullptr) noexcept
+        : data(nullptr), length(length_), allocator(allocator_)
     {
         if (data_ && length_) {
-            size_t data_buffer_size = this->length + 1;
-
-            void *data_buffer = mm::allocate(data_buffer_size, ALLOCATE_ZERO_MEMORY);
-            assert(data_buffer);
-
-            str8_copy_to(data_buffer, data_, this->length, data_buffer_size);
-
-            this->data = static_cast<char *>(data_buffer);
+            this->data = this->allocate_buffer(this->length + 1);
+            str8_copy_to(this->data, data_, this->length, this->length);
+            this->data[this->length] = 0;
         }
     }
 
     constexpr explicit
-    Str8(const Str8 &other) noexcept
-        : Str8(other.data, other.length)
+    Basic_Str8(const Basic_Str8 &other) noexcept
+        : Basic_Str8(other.data, other.length, other.allocator)
     { }
 
     constexpr explicit
-    Str8(Str8 &&other) noexcept
-        : data(std::exchange(other.data, nullptr)), length(std::exchange(other.length, 0))
-    { }
+    Basic_Str8(Basic_Str8 &&other) noexcept
+        : data(nullptr), length(0), allocator(other.allocator)
+    {
+        this->steal(&other);
+    }
 
-    Str8 &
-    operator=(const Str8& other) noexcept
+    Basic_Str8 &
+    operator=(const Basic_Str8& other) noexcept
     {
-        this->destroy();
+        if (this != &other) {
+            this->destroy();
+
+            this->allocator = other.allocator;
+            this->length = other.length;
+
+            if (other.data && other.length) {
+                this->data = this->allocate_buffer(this->length + 1);
+                str8_copy_to(this->data, other.data, this->length + 1, this->length + 1);
+            }
+        }
 
-        return *this = Str8(other);
+        return *this;
     }
 
-    Str8 &
-    operator=(Str8&& other) noexcept
+    Basic_Str8 &
+    operator=(Basic_Str8&& other) noexcept
     {
-        this->destroy();
+        if (this != &other) {
+            this->destroy();
 
-        this->data = std::exchange(other.data, nullptr);
-        this->length = std::exchange(other.length, 0);
+            this->allocator = other.allocator;
+            this->steal(&other);
+        }
 
         return *this;
     }
 
-    ~Str8(void) noexcept
+    ~Basic_Str8(void) noexcept
     {
         this->destroy();
     }
 
+    constexpr bool
+    is_inline(void) const noexcept
+    {
+        return this->data == this->inline_data;
+    }
+
     void
     destroy(void) noexcept
     {
-        if (this->data) {
-            mm::deallocate(static_cast<void *>(this->data));
+        if constexpr (!mm::external_lifetime<Allocator_Type>()) {
+            if (this->data && !this->is_inline()) {
+                mm::deallocate(this->allocator, static_cast<void *>(this->data));
+            }
         }
+
+        this->data = nullptr;
         this->length = 0;
     }
+
+private:
+    char inline_data[STR8_INLINE_CAPACITY];
+
+    constexpr char *
+    allocate_buffer(size_t size) noexcept
+    {
+        if (size <= STR8_INLINE_CAPACITY) {
+            return this->inline_data;
+        }
+
+        // NOTE(gr3yknigh1): No ALLOCATE_ZERO_MEMORY, whole buffer is overwritten right after. [2026/10/17]
+        void *buffer = mm::allocate(this->allocator, size);
+        assert(buffer);
+
+        return static_cast<char *>(buffer);
+    }
+
+    constexpr void
+    steal(Basic_Str8 *other) noexcept
+    {
+        if (other->is_inline()) {
+            str8_copy_to(this->inline_data, other->inline_data, other->length + 1, STR8_INLINE_CAPACITY);
+            this->data = this->inline_data;
+        } else {
+            this->data = other->data;
+        }
+
+        this->length = other->length;
+
+        other->data = nullptr;
+        other->length = 0;
+    }
 };
 
+using Str8 = Basic_Str8<mm::Basic_Allocator>;
+
+template <typename Allocator_Type>
 bool
-str8_is_equals(const Str8 *a, const Str8 *b) noexcept
+str8_is_equals(const Basic_Str8<Allocator_Type> *a, const Basic_Str8<Allocator_Type> *b) noexcept
 {
     if (a->length != b->length) {
         return false;
     }
 
-    // TODO(gr3yknigh1): Do vectorization [2025/01/03]
-    for (Int64U i = 0; i < a->length; ++i) {
-        if (a->data[i] != b->data[i]) {
-            return false;
-        }
+    return noc_memory_is_equals(a->data, b->data, a->length);
+}
+
+constexpr size_t
+str8_get_length(const char *s) noexcept
+{
+    if (std::is_constant_evaluated()) {
+        return noxx::str8z_length(s);
     }
 
-    return true;
+    return noc_str8z_length(s);
 }
 
 struct Str8_View {
@@ -612,28 +1416,23 @@ struct Str8_View {
     constexpr inline bool empty(void) const noexcept { return this->length == 0; }
 
     constexpr inline Str8_View() noexcept : data(nullptr), length(0) {}
-    constexpr inline Str8_View(const char *data_) noexcept : data(data_), length(noxx::str8z_length(data_)) {}
+    constexpr inline Str8_View(const char *data_) noexcept : data(data_), length(str8_get_length(data_)) {}
     constexpr inline Str8_View(const char *data_, size_t length_) noexcept : data(data_), length(length_) {}
 
-    constexpr inline Str8_View(const Str8 &str) : Str8_View(str.data, str.length) {}
+    template <typename Allocator_Type>
+    constexpr inline Str8_View(const Basic_Str8<Allocator_Type> &str) : Str8_View(str.data, str.length) {}
 };
 
 
+template <typename Allocator_Type>
 bool
-str8_is_equals(const Str8 *a, const Str8_View *b)
+str8_is_equals(const Basic_Str8<Allocator_Type> *a, const Str8_View *b)
 {
     if (a->length != b->length) {
         return false;
     }
 
-    // TODO(gr3yknigh1): Do vectorization [2025/01/03]
-    for (Int64U i = 0; i < a->length; ++i) {
-        if (a->data[i] != b->data[i]) {
-            return false;
-        }
-    }
-
-    return true;
+    return noc_memory_is_equals(a->data, b->data, a->length);
 }
 
 
@@ -672,14 +1471,17 @@ str8_view_is_equals(Str8_View a, Str8_View b)
         return false;
     }
 
-    // TODO(gr3yknigh1): Do vectorization [2025/01/03]
-    for (size_t i = 0; i < a.length; ++i) {
-        if (a.data[i] != b.data[i]) {
-            return false;
+    if (std::is_constant_evaluated()) {
+        for (size_t i = 0; i < a.length; ++i) {
+            if (a.data[i] != b.data[i]) {
+                return false;
+            }
         }
+
+        return true;
     }
 
-    return true;
+    return noc_memory_is_equals(a.data, b.data, a.length);
 }
 
 constexpr bool
@@ -689,16 +1491,50 @@ str8_view_is_equals(Str8_View a, const char *str)
     return str8_view_is_equals(a, b);
 }
 
+//!
+//! @brief FNV-1a hash of the bytes of the view.
+//!
+constexpr Int64U
+str8_view_hash(Str8_View view) noexcept
+{
+    Int64U hash = 0xCBF29CE484222325ULL;
+
+    for (size_t i = 0; i < view.length; ++i) {
+        hash ^= static_cast<Int8U>(view.data[i]);
+        hash *= 0x100000001B3ULL;
+    }
+
+    return hash;
+}
+
+constexpr bool
+str8_view_endswith(Str8_View view, Str8_View end)
+{
+    if (view.length < end.length) {
+        return false;
+    }
+
+    return str8_view_is_equals(Str8_View(view.data + view.length - end.length, end.length), end);
+}
+
 constexpr size_t
 str16_get_length(const wchar_t *s) noexcept
 {
-    size_t result = 0;
+    if (std::is_constant_evaluated()) {
+        size_t result = 0;
+
+        while (s[result] != 0) {
+            result++;
+        }
 
-    while (s[result] != 0) {
-        result++;
+        return result;
     }
 
-    return result;
+    if constexpr (sizeof(wchar_t) == sizeof(Int16U)) {
+        return noc_str16z_length(reinterpret_cast<const Int16U *>(s));
+    } else {
+        return noc_str32z_length(reinterpret_cast<const Int32U *>(s));
+    }
 }
 
 struct Str16_View {
@@ -724,45 +1560,6 @@ str16_view_copy_to_nullterminated(Str16_View view, wchar_t *out_buffer, size_t o
     return true;
 }
 
-inline bool
-str16_view_endswith(Str16_View view, Str16_View end) noexcept
-{
-    if (view.length < end.length) {
-        return false;
-    }
-
-    for (size_t end_index = end.length - 1, view_index = view.length - 1; end_index > 0; --end_index, --view_index) {
-        if (end.data[end_index] != view.data[view_index]) {
-            return false;
-        }
-    }
-
-    return true;
-}
-
-inline bool
-str16_view_endswith(Str16_View view, Str8_View end) noexcept
-{
-    if (view.length < end.length) {
-        return false;
-    }
-
-    for (size_t end_index = end.length - 1, view_index = view.length - 1; end_index > 0; --end_index, --view_index) {
-
-        const char *c16 = reinterpret_cast<const char *>(view.data + view_index);
-
-        if (end.data[end_index] != c16[0]) {
-            return false;
-        }
-
-        if (c16[1] != 0) {
-            return false;
-        }
-    }
-
-    return true;
-}
-
 constexpr bool
 str16_view_is_equals(const Str16_View a, const Str16_View b) noexcept
 {
@@ -770,14 +1567,17 @@ str16_view_is_equals(const Str16_View a, const Str16_View b) noexcept
         return false;
     }
 
-    // TODO(gr3yknigh1): Do vectorization [2025/01/03]
-    for (size_t i = 0; i < a.length; ++i) {
-        if (a.data[i] != b.data[i]) {
-            return false;
+    if (std::is_constant_evaluated()) {
+        for (size_t i = 0; i < a.length; ++i) {
+            if (a.data[i] != b.data[i]) {
+                return false;
+            }
         }
+
+        return true;
     }
 
-    return true;
+    return noc_memory_is_equals(a.data, b.data, a.length * sizeof(*a.data));
 }
 
 constexpr bool
@@ -787,33 +1587,46 @@ str16_view_is_equals(Str16_View a, const wchar_t *str) noexcept
     return str16_view_is_equals(a, b);
 }
 
-constexpr bool
+//!
+//! @brief Compares UTF-16 (or UTF-32, where `wchar_t` is 32 bits) string with UTF-8 one, code unit by code unit.
+//!
+//! Only ASCII strings (which paths of assets are) are equal this way: each byte of `b` is widened with zeroes.
+//!
+inline bool
 str16_view_is_equals(const Str16_View a, const Str8_View b) noexcept
 {
     if (a.length != b.length) {
         return false;
     }
 
-    // TODO(gr3yknigh1): Do vectorization [2025/01/03]
-    for (size_t i = 0; i < a.length; ++i) {
-        // TODO(gr3yknigh1): Maybe make c16 be `Byte c16[2]` ? [2025/04/07]
-        const Byte *c16 = reinterpret_cast<const Byte *>(a.data + i);
+    if constexpr (sizeof(wchar_t) == sizeof(Int16U)) {
+        return noc_str16_is_equals_str8(reinterpret_cast<const Int16U *>(a.data), b.data, a.length);
+    } else {
+        return noc_str32_is_equals_str8(reinterpret_cast<const Int32U *>(a.data), b.data, a.length);
+    }
+}
 
-        if (c16[1] != 0) {
-            return false;
-        }
+inline bool
+str16_view_endswith(Str16_View view, Str16_View end) noexcept
+{
+    if (view.length < end.length) {
+        return false;
+    }
 
-        Byte c8 = b.data[i];
+    return str16_view_is_equals(Str16_View(view.data + view.length - end.length, end.length), end);
+}
 
-        if (c16[0] != c8) {
-            return false;
-        }
+inline bool
+str16_view_endswith(Str16_View view, Str8_View end) noexcept
+{
+    if (view.length < end.length) {
+        return false;
     }
 
-    return true;
+    return str16_view_is_equals(Str16_View(view.data + view.length - end.length, end.length), end);
 }
 
-constexpr bool
+inline bool
 str16_view_is_equals(const Str16_View a, const char *str) noexcept
 {
     Str8_View b(str);
@@ -857,6 +1670,101 @@ void      lexer_skip_whitespace(Lexer *lexer);
 bool      lexer_is_endline(Lexer *lexer, bool *is_crlf = nullptr);
 bool      lexer_is_end(Lexer *lexer);
 
+//
+// Tokenizer:
+//
+// NOTE(gr3yknigh1): Loaders tokenize whole buffer in one pass and then walk the token array, instead of calling the
+// lexer for each character. Bytes are classified 64 at a time (whitespace, digits, identifier characters), so runs of
+// them are skipped with bit scan. Line comments (`//`) are dropped, newlines are kept. [2026/10/17]
+//
+// NOTE(gr3yknigh1): Aim was order of magnitude faster tilemap parsing, what we have is about 2x (see `tilemap_parse`
+// benchmark): tokens of big maps are bound by writing the token array, and tile indexes skip tokens entirely and go
+// through `parse_uint_list`, which is bound by locating numbers in the window and writing values out. [2026/10/17]
+//
+
+enum class Token_Kind : Int8U {
+    Ident,     //!< `[A-Za-z_][A-Za-z0-9_]*`
+    Int,       //!< `-?[0-9]+`, see `token_get_int`.
+    String,    //!< `"..."` on single line, quotes are not part of the text.
+    Directive, //!< `@name` or `#name`, prefix is part of the text.
+    Newline,   //!< `\n` (`\r` before it is skipped as whitespace).
+    Symbol,    //!< Any other single character.
+};
+
+//!
+//! @brief Text of tokens longer than this is cut (only absurdly long identifiers and strings are).
+//!
+constexpr SizeU TOKEN_MAX_LENGTH = UINT16_MAX;
+
+//!
+//! @brief Tilemaps have token for each tile, so token is kept in 8 bytes: text is not copied and integers are parsed
+//! only when parser asks for them.
+//!
+struct Token {
+    Int32U offset;
+    Int16U length;
+    Token_Kind kind;
+};
+
+EXPECT_TYPE_SIZE(Token, 8);
+
+struct Token_List {
+    const char *buffer;
+    SizeU buffer_size;
+
+    Token *tokens;
+    SizeU count;
+    SizeU capacity;
+};
+
+//!
+//! @brief Line and column (both starting from 1) of the token in the source.
+//!
+struct Token_Location {
+    Int32U line;
+    Int32U column;
+};
+
+//!
+//! @brief Tokens are grown in chunks in the `arena`, so nothing else should be allocated from it until tokenization is
+//! done. Usually it's scratch arena inside of `Temp_Scope` of the loader.
+//!
+Token_List     tokenize(mm::Virtual_Arena *arena, const char *buffer, SizeU buffer_size);
+
+Str8_View      token_get_text(const Token_List *list, const Token *token);
+Int32S         token_get_int(const Token_List *list, const Token *token);
+bool           token_is(const Token_List *list, const Token *token, Token_Kind kind, Str8_View text);
+
+//!
+//! @brief Computes location by counting lines from the start of the buffer. Meant for error messages only.
+//!
+Token_Location token_get_location(const Token_List *list, const Token *token);
+Token_Location token_get_location(const char *buffer, SizeU offset);
+
+enum class Parse_Status : Int8U {
+    Ok,
+    Unexpected_Character,
+    Overflow,
+    Too_Many_Values,
+    Too_Few_Values,
+};
+
+struct Uint_List_Parse_Result {
+    Parse_Status status;
+    SizeU count;        //!< Count of values written.
+    SizeU error_offset; //!< Offset of the value or character, which caused the error. Size of buffer if it ended too early.
+};
+
+//!
+//! @brief Decodes exactly `values_count` unsigned integers, separated by whitespace (newlines included), into
+//! `values`. Line comments are skipped. For grids of numbers, like tile indexes, without going through tokens.
+//!
+//! Buffer is classified 64 bytes at a time, numbers are found from the bit masks and decoded with SWAR.
+//!
+//! @param max_value Numbers greater than this are reported as `Parse_Status::Overflow`.
+//!
+Uint_List_Parse_Result parse_uint_list(const char *buffer, SizeU buffer_size, Int32U *values, SizeU values_count, Int32U max_value);
+
 //
 // Containers:
 //
@@ -1082,7 +1990,7 @@ struct Linked_List {
         try {
             std::construct_at(new_node, new_element);
         } catch (...) {
-            mm::deallocate(new_node);
+            mm::deallocate(this->allocator, new_node);
             throw;
         }
 
@@ -1185,14 +2093,17 @@ Char8 SEVERENITY_LETTERS[static_cast<SizeU>(Severenity::_Count)] {
 };
 
 struct Report {
-    Str8 message;
+    Basic_Str8<mm::Pool_Allocator> message;
     Severenity severenity;
     Source_Location source_location;
     Int64U count;
 };
 
+//!
+//! @brief Frame reporter gets message on each input event, so both nodes and message strings are taken from the pool.
+//!
 struct Reporter {
-    Linked_List<Report> reports;
+    Linked_List<Report, mm::Pool_Allocator> reports;
 
 
     // TODO(gr3yknigh1): Replace Source_Location with Traceback. [2025/05/06]
@@ -1209,7 +2120,7 @@ struct Reporter {
             }
         }
 
-        reports.push_back(Report(Str8(message.data, message.length), severenity, source_location, 1));
+        reports.push_back(Report(Basic_Str8<mm::Pool_Allocator>(message.data, message.length), severenity, source_location, 1));
     }
 };
 
@@ -1219,6 +2130,76 @@ struct Reporter {
 
 int get_offset_from_coords_of_2d_grid_array_rm(int width, int x, int y);
 
+//
+// Perf helpers:
+//
+
+//
+// NOTE(gr3yknigh1): Counter and cycle functions are implemented by platform layer. [2026/10/17]
+//
+Int64S perf_get_counter_frequency(void);
+Int64S perf_get_counter(void);
+uint64_t perf_get_cycles_count(void);
+
+#pragma pack(push, 1)
+struct Perf_Block_Record {
+    const char *label;
+    const char *function;
+    const char *file_path;
+    uint64_t line_number;
+    uint64_t cycles_begin;
+    uint64_t cycles_end;
+    Int64S counter_begin;
+    Int64S counter_end;
+};
+#pragma pack(pop)
+
+void perf_block_record_print(const Perf_Block_Record *record);
+
+#define PERF_BLOCK_RECORD(NAME) NAME##__BLOCK_RECORD
+
+#if defined(PERF_ENABLED)
+
+    #define PERF_BLOCK_BEGIN(NAME) \
+        Perf_Block_Record PERF_BLOCK_RECORD(NAME); \
+        do { \
+            PERF_BLOCK_RECORD(NAME).label = STRINGIFY(NAME); \
+            PERF_BLOCK_RECORD(NAME).function = __FUNCTION__; \
+            PERF_BLOCK_RECORD(NAME).file_path = __FILE__; \
+            PERF_BLOCK_RECORD(NAME).line_number = __LINE__; \
+            PERF_BLOCK_RECORD(NAME).cycles_begin = perf_get_cycles_count(); \
+            PERF_BLOCK_RECORD(NAME).counter_begin = perf_get_counter(); \
+        } while (0)
+
+    #define PERF_BLOCK_END(NAME) \
+        do { \
+            PERF_BLOCK_RECORD(NAME).cycles_end = perf_get_cycles_count(); \
+            PERF_BLOCK_RECORD(NAME).counter_end = perf_get_counter(); \
+            perf_block_record_print(&PERF_BLOCK_RECORD(NAME)); \
+        } while (0)
+
+#else
+
+    #define PERF_BLOCK_BEGIN(NAME)
+
+    #define PERF_BLOCK_END(NAME)
+
+#endif // if defined(PERF_ENABLED)
+
+//
+// Time:
+//
+
+struct Clock {
+    Int64S ticks_begin;
+    Int64S ticks_end;
+    Int64S frequency;
+};
+
+Clock make_clock(void);
+
+double clock_tick(Clock *clock);
+
 //
 // Keyboard input
 //
@@ -1275,11 +2256,16 @@ struct Platform_Context {
 
     Camera *camera = nullptr;
 
-    mm::Fixed_Arena persist_arena;
+    mm::Virtual_Arena persist_arena;
 
-    // NOTE(gr3yknigh1): Platform runtime will call issue a draw call if vertexes_count > 0 [2025/03/03]
-    mm::Fixed_Arena vertexes_arena;
+    //!
+    //! @brief Assets, which runtime loads for gameplay. Null handles, if runtime has no GPU (headless).
+    //!
+    Asset_Handle atlas_texture{};
+    Asset_Handle basic_shader{};
 
-    Vertex *vertexes{};
-    SizeU vertexes_count = 0;
+    //!
+    //! @brief Gameplay pushes sprites in `on_draw`, runtime draws them and resets the batch.
+    //!
+    Sprite_Batch sprite_batch{};
 };
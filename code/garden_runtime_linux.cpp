@@ -0,0 +1,943 @@
+//!
+//! This is platform code which is specific to Linux.
+//!
+//! Runtime is headless: there is no window, no input and no OpenGL context. It loads gameplay module, runs the same
+//! update/draw path as `wWinMain` (minus GL calls) for fixed number of frames and prints per-frame timings. Used for
+//! profiling frame-loop on machines without display.
+//!
+//! FILE          code\garden_runtime_linux.cpp
+//!
+//! AUTHORS
+//!               Ilya Akkuzin <gr3yknigh1@gmail.com>
+//!
+//! NOTICE        (c) Copyright 2025 by Ilya Akkuzin. All rights reserved.
+//!
+#include <atomic>   // std::atomic_flag
+#include <utility>
+
+#include <assert.h> // assert
+#include <errno.h>  // errno, EINTR
+#include <stdio.h>  // puts, printf
+#include <stdlib.h> // strtoull, strtof, qsort
+#include <time.h>   // clock_gettime
+
+#include <dlfcn.h>        // dlopen, dlsym, dlclose, dlerror
+#include <limits.h>       // PATH_MAX, NAME_MAX
+#include <pthread.h>      // pthread_create, pthread_join
+#include <unistd.h>       // readlink, read, write, close
+#include <x86intrin.h>    // __rdtsc
+#include <sys/epoll.h>    // epoll_create1, epoll_ctl, epoll_wait
+#include <sys/eventfd.h>  // eventfd
+#include <sys/inotify.h>  // inotify_init1, inotify_add_watch
+
+#include <glm/glm.hpp>
+#include <glm/ext.hpp>
+#include <glm/ext/matrix_transform.hpp>
+
+#include <noc/noc.h>
+
+#include "garden_gameplay.h"
+#include "garden_runtime.h"
+#include "garden_assets.h"
+
+//
+// Asset watcher:
+//
+
+enum struct File_Action {
+    Added,
+    Removed,
+    Modified,
+    RenamedOldName,
+    RenamedNewName,
+};
+
+struct Watch_Context;
+
+typedef void (* watch_notification_routine_t)(Watch_Context *watch_context, const Str8_View file_name, File_Action action, void *parameter);
+
+constexpr SizeU  WATCH_DIRECTORY_CAPACITY = 8;
+constexpr SizeU  WATCH_PENDING_EVENT_CAPACITY = 64;
+constexpr Int64S WATCH_DEFAULT_COALESCE_WINDOW_MS = 50;
+
+//!
+//! @brief Event which waits for the end of coalesce window before notification routine is called.
+//!
+struct Watch_Pending_Event {
+    Int64S deadline; //! @note In units of `perf_get_counter`.
+    File_Action action;
+    SizeU directory_index;
+    char file_name[NAME_MAX + 1];
+};
+
+struct Watch_Context {
+    std::atomic_flag should_stop;
+
+    int inotify_fd;
+    int epoll_fd;
+    int stop_fd; //! @note Eventfd, which wakes up worker when `watch_context_stop` is called.
+
+    pthread_t thread;
+    bool is_thread_launched;
+
+    const char *directories[WATCH_DIRECTORY_CAPACITY];
+    int directory_watches[WATCH_DIRECTORY_CAPACITY];
+    SizeU directories_count;
+
+    //!
+    //! @brief Events for the same path, which arrive within this window, are merged into single notification. Editors
+    //! tend to write file several times per save, and each notification means full asset reload.
+    //!
+    Int64S coalesce_window_ms;
+
+    Watch_Pending_Event pending_events[WATCH_PENDING_EVENT_CAPACITY];
+    SizeU pending_events_count;
+
+    watch_notification_routine_t notification_routine;
+    void *parameter;
+};
+
+bool make_watch_context(Watch_Context *context, void *parameter = nullptr, watch_notification_routine_t notification_routine = nullptr, Int64S coalesce_window_ms = WATCH_DEFAULT_COALESCE_WINDOW_MS);
+bool watch_context_add_directory(Watch_Context *context, const char *directory);
+bool watch_context_launch_thread(Watch_Context *context);
+
+//!
+//! @brief Wakes up worker, waits for it to finish and releases watch descriptors. Events which still wait for their
+//! coalesce window are dropped.
+//!
+bool watch_context_stop(Watch_Context *context);
+
+void *watch_thread_worker(void *param);
+
+//
+// Gameplay module:
+//
+
+struct Gameplay {
+    void *module;
+
+    Game_On_Init_Fn_Type *on_init;
+    Game_On_Load_Fn_Type *on_load;
+    Game_On_Tick_Fn_Type *on_tick;
+    Game_On_Draw_Fn_Type *on_draw;
+    Game_On_Fini_Fn_Type *on_fini;
+};
+
+//!
+//! @param[in] module_name Name of the shared object. Resolved relative to the folder of executable (like
+//! `LoadLibraryA` does on Windows).
+//!
+Gameplay load_gameplay(const char *module_name);
+void unload_gameplay(Gameplay *gameplay);
+
+void asset_watch_routine(Watch_Context *, const Str8_View, File_Action, void *);
+
+//!
+//! @brief Writes path to the folder of the running executable (without trailing separator) into buffer.
+//!
+bool linux_get_executable_folder(char *buffer, SizeU buffer_size);
+
+//
+// Headless:
+//
+
+struct Headless_Options {
+    //!
+    //! @brief Number of frames to run before exit.
+    //!
+    Int64U frame_count;
+
+    //!
+    //! @brief If greater than zero, passed to gameplay instead of measured delta time. Makes runs reproducible.
+    //!
+    Float32 fixed_delta_time;
+
+    //!
+    //! @brief Optional path to the tilemap, which geometry will be generated before mainloop (like in `wWinMain`).
+    //!
+    const char *tilemap_path;
+
+    //!
+    //! @brief Optional path to the asset archive (see `make_asset_store_from_image`). Assets are loaded from
+    //! `GARDEN_ASSETS_FOLDER` otherwise.
+    //!
+    const char *asset_image_path;
+
+    //!
+    //! @brief Print timing of each frame in CSV format.
+    //!
+    bool print_frames;
+
+    //!
+    //! @brief Optional path, where allocation records are written at exit (see `mm::dump_allocation_records_to_file`).
+    //!
+    const char *allocations_dump_path;
+};
+
+bool headless_parse_options(Headless_Options *options, int argc, char **argv);
+
+struct Frame_Timing {
+    Int64S update_counter;
+    Int64S draw_counter;
+    Int64U cycles;
+    SizeU vertexes_count;
+};
+
+void headless_print_frame_timings(const Frame_Timing *timings, Int64U timings_count, Int64S counter_frequency, bool print_frames);
+
+
+#if GARDEN_GAMEPLAY_CODE
+
+#include "garden_gameplay.cpp"
+
+#elif GARDEN_BENCHMARK_CODE
+
+#include "garden_benchmark.cpp"
+
+#elif GARDEN_TOOLS_CODE
+
+#include "garden_tools.cpp"
+
+#else
+
+#if !defined(GARDEN_ASSETS_FOLDER)
+    #error "Dev asset directory is not defined!"
+#endif
+
+int
+main(int argc, char **argv)
+{
+    Headless_Options options;
+    if (!headless_parse_options(&options, argc, argv)) {
+        puts("usage: garden [--frames COUNT] [--fixed-dt SECONDS] [--tilemap PATH] [--asset-image PATH] [--print-frames] [--allocations-dump PATH]");
+        return 1;
+    }
+
+    constexpr int viewport_width = 1280;
+    constexpr int viewport_height = 720;
+
+    //
+    // Media:
+    //
+    Asset_Store store;
+    [[maybe_unused]] bool is_store_made = false;
+
+    if (options.asset_image_path != nullptr) {
+        is_store_made = make_asset_store_from_image(&store, options.asset_image_path);
+    } else {
+        is_store_made = make_asset_store_from_folder(&store, GARDEN_ASSETS_FOLDER);
+    }
+
+    assert(is_store_made);
+
+    //
+    // Hot-reload: Setup
+    //
+
+    Reload_Context reload_context;
+    reload_context.store = &store;
+    reload_context.should_reload_gameplay.clear();
+
+    //
+    // NOTE(gr3yknigh1): Folder of executable is watched for rebuilt gameplay module. [2026/10/17]
+    //
+    char executable_folder[PATH_MAX] = {};
+
+    Watch_Context watch_context;
+    [[maybe_unused]] bool is_watching = make_watch_context(&watch_context, &reload_context, asset_watch_routine) &&
+                                        linux_get_executable_folder(executable_folder, sizeof(executable_folder)) &&
+                                        watch_context_add_directory(&watch_context, GARDEN_ASSETS_FOLDER) &&
+                                        watch_context_add_directory(&watch_context, executable_folder) &&
+                                        watch_context_launch_thread(&watch_context);
+    assert(is_watching);
+
+    Camera camera = make_camera(Camera_ViewMode::Orthogonal);
+
+    glm::mat4 model = glm::identity<glm::mat4>();
+    glm::mat4 projection = camera_get_projection_matrix(&camera, viewport_width, viewport_height);
+
+    //
+    // Setup tilemap:
+    //
+    Tilemap_Geometry tilemap_geometry{};
+    Tilemap_Draw_Range *tilemap_draw_ranges = nullptr;
+
+    if (options.tilemap_path != nullptr) {
+        Asset_Handle tilemap_handle = asset_load_async(&store, Asset_Type::Tilemap, options.tilemap_path);
+        Asset *tilemap_asset = asset_store_get(&store, tilemap_handle);
+        assert(tilemap_asset);
+
+        // NOTE(gr3yknigh1): Geometry is generated before mainloop, so there is nothing to overlap with. [2026/10/17]
+        asset_store_wait_loading(&store);
+        [[maybe_unused]] Asset *completed_asset = asset_store_pop_completed(&store);
+        assert(completed_asset == tilemap_asset && tilemap_asset->state == Asset_State::Loaded);
+
+        Tilemap *tilemap = &tilemap_asset->u.tilemap;
+        Texture *tilemap_texture = &asset_store_get(&store, tilemap->texture_asset)->u.texture;
+
+        Atlas tilemap_atlas{
+            static_cast<Float32>(tilemap_texture->width),
+            static_cast<Float32>(tilemap_texture->height)
+        };
+
+        [[maybe_unused]] bool is_geometry_made = make_tilemap_geometry(
+            &tilemap_geometry, tilemap, 100, 100, {255, 255, 255, 255}, &tilemap_atlas);
+        assert(is_geometry_made);
+
+        tilemap_draw_ranges = mm::allocate_structs<Tilemap_Draw_Range>(tilemap_geometry.chunk_row_count);
+        assert(tilemap_draw_ranges);
+    }
+
+    //
+    // Load game code:
+    //
+    Gameplay gameplay = load_gameplay(STRINGIFY(GARDEN_GAMEPLAY_DLL_NAME));
+
+    Platform_Context platform_context{};
+
+    platform_context.camera = &camera;
+    platform_context.persist_arena = mm::make_virtual_arena();
+    assert(platform_context.persist_arena.data);
+
+    [[maybe_unused]] bool is_sprite_batch_made = make_sprite_batch(&platform_context.sprite_batch);
+    assert(is_sprite_batch_made);
+
+    Game_Context *game_context = reinterpret_cast<Game_Context *>(gameplay.on_init(&platform_context));
+    gameplay.on_load(&platform_context, game_context);
+
+    //
+    // Game mainloop:
+    //
+    Frame_Timing *frame_timings = mm::allocate_structs<Frame_Timing>(options.frame_count, ALLOCATE_ZERO_MEMORY);
+    assert(frame_timings);
+
+    Clock clock = make_clock();
+
+    for (Int64U frame_index = 0; frame_index < options.frame_count; ++frame_index) {
+        double dt = clock_tick(&clock);
+
+        if (options.fixed_delta_time > 0) {
+            dt = options.fixed_delta_time;
+        }
+
+        Frame_Timing *timing = frame_timings + frame_index;
+
+        if (reload_context.should_reload_gameplay.test()) {
+            puts("I: Gameplay code was reloaded!");
+
+            reload_context.should_reload_gameplay.clear();
+            unload_gameplay(&gameplay);
+            gameplay = load_gameplay(STRINGIFY(GARDEN_GAMEPLAY_DLL_NAME));
+            gameplay.on_load(&platform_context, game_context);
+        }
+
+        Int64U cycles_begin = perf_get_cycles_count();
+        Int64S update_begin = perf_get_counter();
+
+        //
+        // Update:
+        //
+
+        PERF_BLOCK_BEGIN(UPDATE);
+
+            gameplay.on_tick(&platform_context, game_context, static_cast<float>(dt));
+
+            //
+            // Asset Hot reload:
+            //
+
+            for (Asset *it = asset_store_pop_dirty(&store); it != nullptr; it = asset_store_pop_dirty(&store)) {
+                if (it->state == Asset_State::NotLoaded || it->state == Asset_State::Loading) {
+                    continue;
+                }
+
+                [[maybe_unused]] bool is_queued = asset_reload_async(&store, it);
+                assert(is_queued);
+            }
+
+            for (Asset *it = asset_store_pop_completed(&store); it != nullptr; it = asset_store_pop_completed(&store)) {
+                // NOTE(gr3yknigh1): No GPU upload here, because there is no GL context [2026/10/17]
+                assert(it->state == Asset_State::Loaded);
+
+                printf("I: Asset was reloaded: %s\n", it->location.u.file.path.data);
+            }
+
+        PERF_BLOCK_END(UPDATE);
+
+        Int64S draw_begin = perf_get_counter();
+
+        //
+        // Draw:
+        //
+
+        PERF_BLOCK_BEGIN(DRAW);
+
+            model = glm::identity<glm::mat4>();
+            model = glm::translate(model, camera.position);
+            model = glm::translate(model, glm::vec3(viewport_width / 2, viewport_height / 2, 0));
+
+            projection = camera_get_projection_matrix(&camera, viewport_width, viewport_height);
+
+            gameplay.on_draw(&platform_context, game_context, static_cast<float>(dt));
+
+            //
+            // NOTE(gr3yknigh1): Same culling as GL runtime does, only visible tilemap vertexes are counted. [2026/10/17]
+            //
+            Int32U tilemap_vertexes_count = 0;
+            Int32U tilemap_draw_ranges_count = tilemap_geometry_cull(
+                &tilemap_geometry, camera_get_view_rect(&camera, viewport_width, viewport_height),
+                tilemap_draw_ranges, tilemap_geometry.chunk_row_count);
+
+            for (Int32U range_index = 0; range_index < tilemap_draw_ranges_count; ++range_index) {
+                tilemap_vertexes_count += tilemap_draw_ranges[range_index].indexes_count / QUAD_INDEX_COUNT * QUAD_VERTEX_COUNT;
+            }
+
+            // NOTE(gr3yknigh1): Sprites are sorted and merged into draws, like GL runtime does. [2026/10/17]
+            sprite_batch_build(&platform_context.sprite_batch);
+
+            timing->vertexes_count = tilemap_vertexes_count + platform_context.sprite_batch.sprites_count * QUAD_VERTEX_COUNT;
+
+            sprite_batch_reset(&platform_context.sprite_batch);
+
+        PERF_BLOCK_END(DRAW);
+
+        Int64S frame_end = perf_get_counter();
+
+        timing->update_counter = draw_begin - update_begin;
+        timing->draw_counter = frame_end - draw_begin;
+        timing->cycles = perf_get_cycles_count() - cycles_begin;
+    }
+
+    headless_print_frame_timings(frame_timings, options.frame_count, perf_get_counter_frequency(), options.print_frames);
+
+    gameplay.on_fini(&platform_context, game_context);
+
+    unload_gameplay(&gameplay);
+
+    [[maybe_unused]] bool is_watch_stopped = watch_context_stop(&watch_context);
+    assert(is_watch_stopped);
+
+    mm::deallocate(frame_timings);
+
+    if (tilemap_draw_ranges != nullptr) {
+        mm::deallocate(tilemap_draw_ranges);
+        tilemap_geometry_destroy(&tilemap_geometry);
+    }
+
+    sprite_batch_destroy(&platform_context.sprite_batch);
+    mm::destroy(&platform_context.persist_arena);
+
+    [[maybe_unused]] bool is_store_destroyed = asset_store_destroy(&store);
+    assert(is_store_destroyed);
+
+    if (mm::is_allocation_tracking_enabled()) {
+        mm::dump_allocation_records();
+
+        if (options.allocations_dump_path != nullptr && !mm::dump_allocation_records_to_file(options.allocations_dump_path)) {
+            printf("E: Failed to write allocation records to '%s'\n", options.allocations_dump_path);
+        }
+    }
+
+    mm::release_scratch_arena();
+
+    return 0;
+}
+
+#endif // GARDEN_GAMEPLAY_CODE, GARDEN_BENCHMARK_CODE, GARDEN_TOOLS_CODE
+
+bool
+headless_parse_options(Headless_Options *options, int argc, char **argv)
+{
+    assert(options);
+
+    options->frame_count = 1000;
+    options->fixed_delta_time = 1.0f / 60.0f;
+    options->tilemap_path = nullptr;
+    options->asset_image_path = nullptr;
+    options->print_frames = false;
+    options->allocations_dump_path = nullptr;
+
+    for (int arg_index = 1; arg_index < argc; ++arg_index) {
+        Str8_View arg = argv[arg_index];
+        bool has_value = arg_index + 1 < argc;
+
+        if (str8_view_is_equals(arg, "--frames") && has_value) {
+            options->frame_count = strtoull(argv[++arg_index], nullptr, 10);
+        } else if (str8_view_is_equals(arg, "--fixed-dt") && has_value) {
+            options->fixed_delta_time = strtof(argv[++arg_index], nullptr);
+        } else if (str8_view_is_equals(arg, "--tilemap") && has_value) {
+            options->tilemap_path = argv[++arg_index];
+        } else if (str8_view_is_equals(arg, "--asset-image") && has_value) {
+            options->asset_image_path = argv[++arg_index];
+        } else if (str8_view_is_equals(arg, "--allocations-dump") && has_value) {
+            options->allocations_dump_path = argv[++arg_index];
+        } else if (str8_view_is_equals(arg, "--print-frames")) {
+            options->print_frames = true;
+        } else {
+            return false;
+        }
+    }
+
+    return options->frame_count > 0;
+}
+
+static int
+compare_float64(const void *a, const void *b)
+{
+    Float64 x = *static_cast<const Float64 *>(a);
+    Float64 y = *static_cast<const Float64 *>(b);
+    return (x > y) - (x < y);
+}
+
+void
+headless_print_frame_timings(const Frame_Timing *timings, Int64U timings_count, Int64S counter_frequency, bool print_frames)
+{
+    assert(timings && timings_count);
+
+    Float64 counter_to_ms = 1000.0 / static_cast<Float64>(counter_frequency);
+
+    if (print_frames) {
+        puts("frame,update_ms,draw_ms,cycles,vertexes");
+
+        for (Int64U frame_index = 0; frame_index < timings_count; ++frame_index) {
+            const Frame_Timing *timing = timings + frame_index;
+            printf(
+                "%lu,%.4f,%.4f,%lu,%lu\n", frame_index, timing->update_counter * counter_to_ms,
+                timing->draw_counter * counter_to_ms, timing->cycles, timing->vertexes_count);
+        }
+    }
+
+    Float64 *samples = mm::allocate_structs<Float64>(timings_count);
+    assert(samples);
+
+    struct {
+        const char *label;
+        Int64S Frame_Timing::*counter;
+    } columns[] = {
+        { "update", &Frame_Timing::update_counter },
+        { "draw",   &Frame_Timing::draw_counter },
+    };
+
+    printf("PERF: headless frames = (%lu)\n", timings_count);
+
+    for (SizeU column_index = 0; column_index < STATIC_ARRAY_COUNT(columns); ++column_index) {
+        Float64 total = 0;
+
+        for (Int64U frame_index = 0; frame_index < timings_count; ++frame_index) {
+            samples[frame_index] = timings[frame_index].*columns[column_index].counter * counter_to_ms;
+            total += samples[frame_index];
+        }
+
+        qsort(samples, timings_count, sizeof(*samples), compare_float64);
+
+        printf(
+            "PERF: [%s] ms: min = (%.4f) avg = (%.4f) p50 = (%.4f) p99 = (%.4f) max = (%.4f)\n",
+            columns[column_index].label, samples[0], total / timings_count, samples[timings_count / 2],
+            samples[(timings_count * 99) / 100], samples[timings_count - 1]);
+    }
+
+    mm::deallocate(samples);
+}
+
+static void
+watch_context_close_descriptors(Watch_Context *context)
+{
+    int *descriptors[] = { &context->epoll_fd, &context->stop_fd, &context->inotify_fd };
+
+    for (SizeU descriptor_index = 0; descriptor_index < STATIC_ARRAY_COUNT(descriptors); ++descriptor_index) {
+        if (*descriptors[descriptor_index] >= 0) {
+            close(*descriptors[descriptor_index]);
+            *descriptors[descriptor_index] = -1;
+        }
+    }
+}
+
+bool
+make_watch_context(Watch_Context *context, void *parameter, watch_notification_routine_t notification_routine, Int64S coalesce_window_ms)
+{
+    assert(context);
+
+    noxx::zero_type(context);
+
+    context->should_stop.clear();
+
+    context->inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    context->stop_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    context->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+
+    bool result = context->inotify_fd >= 0 && context->stop_fd >= 0 && context->epoll_fd >= 0;
+
+    epoll_event event;
+    noxx::zero_type(&event);
+
+    if (result) {
+        event.events = EPOLLIN;
+        event.data.fd = context->inotify_fd;
+        result = epoll_ctl(context->epoll_fd, EPOLL_CTL_ADD, context->inotify_fd, &event) == 0;
+    }
+
+    if (result) {
+        event.events = EPOLLIN;
+        event.data.fd = context->stop_fd;
+        result = epoll_ctl(context->epoll_fd, EPOLL_CTL_ADD, context->stop_fd, &event) == 0;
+    }
+
+    if (!result) {
+        watch_context_close_descriptors(context);
+        return false;
+    }
+
+    context->coalesce_window_ms = coalesce_window_ms;
+    context->parameter = parameter;
+    context->notification_routine = notification_routine;
+
+    return true;
+}
+
+bool
+watch_context_add_directory(Watch_Context *context, const char *directory)
+{
+    assert(context && directory);
+
+    if (context->directories_count >= WATCH_DIRECTORY_CAPACITY) {
+        return false;
+    }
+
+    //
+    // NOTE(gr3yknigh1): IN_MODIFY is not listened on purpose: it is raised on each `write` call, so we could start
+    // reload in the middle of the save. IN_CLOSE_WRITE and IN_MOVED_TO cover both in-place and rename saves. [2026/10/17]
+    //
+    int watch = inotify_add_watch(
+        context->inotify_fd, directory,
+        IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO);
+
+    if (watch < 0) {
+        return false;
+    }
+
+    context->directories[context->directories_count] = directory;
+    context->directory_watches[context->directories_count] = watch;
+    context->directories_count++;
+
+    return true;
+}
+
+bool
+watch_context_launch_thread(Watch_Context *context)
+{
+    assert(context && !context->is_thread_launched);
+
+    if (pthread_create(&context->thread, nullptr, watch_thread_worker, context) != 0) {
+        return false;
+    }
+
+    context->is_thread_launched = true;
+    return true;
+}
+
+bool
+watch_context_stop(Watch_Context *context)
+{
+    assert(context);
+
+    context->should_stop.test_and_set();
+
+    if (context->is_thread_launched) {
+        Int64U value = 1;
+        if (write(context->stop_fd, &value, sizeof(value)) != sizeof(value)) {
+            return false;
+        }
+
+        if (pthread_join(context->thread, nullptr) != 0) {
+            return false;
+        }
+
+        context->is_thread_launched = false;
+    }
+
+    for (SizeU directory_index = 0; directory_index < context->directories_count; ++directory_index) {
+        inotify_rm_watch(context->inotify_fd, context->directory_watches[directory_index]);
+    }
+    context->directories_count = 0;
+
+    watch_context_close_descriptors(context);
+
+    return true;
+}
+
+static void
+watch_context_notify(Watch_Context *context, SizeU directory_index, const char *file_name, File_Action action)
+{
+    if (context->notification_routine == nullptr) {
+        return;
+    }
+
+    // TODO(gr3yknigh1): Replace with some kind of Path_Join function [2026/10/17]
+    char file_full_path[PATH_MAX];
+    int file_full_path_length = snprintf(
+        file_full_path, sizeof(file_full_path), "%s/%s", context->directories[directory_index], file_name);
+
+    if (file_full_path_length < 0 || static_cast<SizeU>(file_full_path_length) >= sizeof(file_full_path)) {
+        return;
+    }
+
+    Str8_View file_full_path_view(file_full_path, static_cast<SizeU>(file_full_path_length));
+    context->notification_routine(context, file_full_path_view, action, context->parameter);
+}
+
+static void
+watch_context_push_event(Watch_Context *context, const inotify_event *event, Int64S now)
+{
+    SizeU directory_index = 0;
+    while (directory_index < context->directories_count && context->directory_watches[directory_index] != event->wd) {
+        ++directory_index;
+    }
+
+    if (directory_index == context->directories_count || event->len == 0) {
+        return;
+    }
+
+    File_Action action = File_Action::Modified;
+
+    if (event->mask & IN_CREATE) {
+        action = File_Action::Added;
+    } else if (event->mask & IN_DELETE) {
+        action = File_Action::Removed;
+    } else if (event->mask & IN_MOVED_FROM) {
+        action = File_Action::RenamedOldName;
+    } else if (event->mask & IN_MOVED_TO) {
+        action = File_Action::RenamedNewName;
+    }
+
+    Int64S deadline = now + context->coalesce_window_ms * perf_get_counter_frequency() / 1000;
+    Str8_View file_name = event->name;
+
+    //
+    // NOTE(gr3yknigh1): Merging with pending event for same path. Last action wins and window is restarted, so burst
+    // of writes produces exactly one notification after the writer is done. [2026/10/17]
+    //
+    for (SizeU pending_index = 0; pending_index < context->pending_events_count; ++pending_index) {
+        Watch_Pending_Event *pending = context->pending_events + pending_index;
+
+        if (pending->directory_index == directory_index && str8_view_is_equals(file_name, pending->file_name)) {
+            pending->action = action;
+            pending->deadline = deadline;
+            return;
+        }
+    }
+
+    if (context->pending_events_count >= WATCH_PENDING_EVENT_CAPACITY || file_name.length > NAME_MAX) {
+        watch_context_notify(context, directory_index, event->name, action);
+        return;
+    }
+
+    Watch_Pending_Event *pending = context->pending_events + context->pending_events_count++;
+    pending->deadline = deadline;
+    pending->action = action;
+    pending->directory_index = directory_index;
+
+    [[maybe_unused]] bool is_copied = str8_view_copy_to_nullterminated(file_name, pending->file_name, sizeof(pending->file_name));
+    assert(is_copied);
+}
+
+//!
+//! @return Timeout for `epoll_wait` in milliseconds till closest deadline of pending event, or -1 if there is nothing
+//! pending.
+//!
+static int
+watch_context_flush_events(Watch_Context *context, Int64S now)
+{
+    Int64S closest_deadline = -1;
+
+    for (SizeU pending_index = 0; pending_index < context->pending_events_count;) {
+        Watch_Pending_Event *pending = context->pending_events + pending_index;
+
+        if (pending->deadline <= now) {
+            watch_context_notify(context, pending->directory_index, pending->file_name, pending->action);
+
+            // NOTE(gr3yknigh1): Order of pending events does not matter, swap with last [2026/10/17]
+            *pending = context->pending_events[--context->pending_events_count];
+            continue;
+        }
+
+        if (closest_deadline < 0 || pending->deadline < closest_deadline) {
+            closest_deadline = pending->deadline;
+        }
+
+        ++pending_index;
+    }
+
+    if (closest_deadline < 0) {
+        return -1;
+    }
+
+    Int64S counter_per_ms = perf_get_counter_frequency() / 1000;
+    return static_cast<int>((closest_deadline - now + counter_per_ms - 1) / counter_per_ms);
+}
+
+void *
+watch_thread_worker(void *param)
+{
+    Watch_Context *context = static_cast<Watch_Context *>(param);
+
+    alignas(inotify_event) char events_buffer[4096];
+    int timeout_ms = -1;
+
+    while (!context->should_stop.test()) {
+        epoll_event ready_events[2];
+        int ready_events_count = epoll_wait(context->epoll_fd, ready_events, STATIC_ARRAY_COUNT(ready_events), timeout_ms);
+
+        if (ready_events_count < 0 && errno != EINTR) {
+            break;
+        }
+
+        Int64S now = perf_get_counter();
+
+        for (int ready_index = 0; ready_index < ready_events_count; ++ready_index) {
+            if (ready_events[ready_index].data.fd != context->inotify_fd) {
+                continue; // NOTE(gr3yknigh1): Stop was requested, loop condition will handle it [2026/10/17]
+            }
+
+            for (;;) {
+                ssize_t bytes_read = read(context->inotify_fd, events_buffer, sizeof(events_buffer));
+
+                if (bytes_read <= 0) {
+                    break;
+                }
+
+                for (ssize_t offset = 0; offset < bytes_read;) {
+                    const inotify_event *event = reinterpret_cast<const inotify_event *>(events_buffer + offset);
+                    watch_context_push_event(context, event, now);
+                    offset += sizeof(*event) + event->len;
+                }
+            }
+        }
+
+        timeout_ms = watch_context_flush_events(context, perf_get_counter());
+    }
+
+    mm::pool_flush_thread_cache();
+    return nullptr;
+}
+
+void
+asset_watch_routine([[maybe_unused]] Watch_Context *watch_context, const Str8_View file_name, File_Action action, void *parameter)
+{
+    //
+    // NOTE(gr3yknigh1): Editors which save through temporary file produce rename instead of modification. [2026/10/17]
+    //
+    if (action != File_Action::Modified && action != File_Action::RenamedNewName && action != File_Action::Added) {
+        return;
+    }
+
+    Reload_Context *reload_context = reinterpret_cast<Reload_Context *>(parameter);
+
+    if (reload_context->store->place == Asset_Store_Place::Folder) {
+        Asset_Handle asset = asset_store_find(reload_context->store, file_name);
+
+        if (!asset.is_null()) {
+            asset_store_mark_dirty(reload_context->store, asset);
+            return;
+        }
+    }
+
+    if (str8_view_endswith(file_name, STRINGIFY(GARDEN_GAMEPLAY_DLL_NAME))) {
+        reload_context->should_reload_gameplay.test_and_set();
+    }
+}
+
+Int64S
+perf_get_counter_frequency(void)
+{
+    // NOTE(gr3yknigh1): Counter is in nanoseconds [2026/10/17]
+    return 1000 * 1000 * 1000;
+}
+
+Int64S
+perf_get_counter(void)
+{
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    Int64S perf_counter = static_cast<Int64S>(now.tv_sec) * 1000 * 1000 * 1000 + now.tv_nsec;
+    return perf_counter;
+}
+
+uint64_t
+perf_get_cycles_count(void)
+{
+    uint64_t cycles_count = __rdtsc();
+    return cycles_count;
+}
+
+bool
+linux_get_executable_folder(char *buffer, SizeU buffer_size)
+{
+    ssize_t path_length = readlink("/proc/self/exe", buffer, buffer_size - 1);
+
+    if (path_length <= 0) {
+        return false;
+    }
+
+    while (path_length > 0 && buffer[path_length - 1] != '/') {
+        --path_length;
+    }
+
+    if (path_length > 0) {
+        --path_length; // NOTE(gr3yknigh1): Dropping trailing separator [2026/10/17]
+    }
+
+    buffer[path_length] = 0;
+    return true;
+}
+
+Gameplay
+load_gameplay(const char *module_name)
+{
+    Gameplay gameplay;
+
+    char module_path[PATH_MAX] = {};
+
+    [[maybe_unused]] bool is_folder_found = linux_get_executable_folder(module_path, sizeof(module_path));
+    assert(is_folder_found);
+
+    SizeU folder_length = noc_str8z_length(module_path);
+    SizeU name_length = noc_str8z_length(module_name);
+    assert(folder_length + 1 + name_length + 1 <= sizeof(module_path));
+
+    module_path[folder_length] = '/';
+    noc_memory_copy(module_path + folder_length + 1, module_name, name_length + 1);
+
+    //
+    // NOTE(gr3yknigh1): Unlike Windows, there is no need to copy module before loading: linker replaces file on
+    // rebuild, and `dlclose` + `dlopen` will pick up new one. [2026/10/17]
+    //
+    gameplay.module = dlopen(module_path, RTLD_NOW | RTLD_LOCAL);
+    if (gameplay.module == nullptr) {
+        printf("E: Failed to load gameplay module: %s\n", dlerror());
+    }
+    assert(gameplay.module);
+
+    gameplay.on_init = reinterpret_cast<Game_On_Init_Fn_Type *>(dlsym(gameplay.module, GAME_ON_INIT_FN_NAME));
+    assert(gameplay.on_init);
+
+    gameplay.on_load = reinterpret_cast<Game_On_Load_Fn_Type *>(dlsym(gameplay.module, GAME_ON_LOAD_FN_NAME));
+    assert(gameplay.on_load);
+
+    gameplay.on_tick = reinterpret_cast<Game_On_Tick_Fn_Type *>(dlsym(gameplay.module, GAME_ON_TICK_FN_NAME));
+    assert(gameplay.on_tick);
+
+    gameplay.on_draw = reinterpret_cast<Game_On_Draw_Fn_Type *>(dlsym(gameplay.module, GAME_ON_DRAW_FN_NAME));
+    assert(gameplay.on_draw);
+
+    gameplay.on_fini = reinterpret_cast<Game_On_Fini_Fn_Type *>(dlsym(gameplay.module, GAME_ON_FINI_FN_NAME));
+    assert(gameplay.on_fini);
+
+    return gameplay;
+}
+
+void
+unload_gameplay(Gameplay *gameplay)
+{
+    [[maybe_unused]] int close_result = dlclose(gameplay->module);
+    assert(close_result == 0);
+}
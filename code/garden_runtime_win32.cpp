@@ -54,69 +54,16 @@
 
 #include "garden_gameplay.h"
 #include "garden_runtime.h"
+#include "garden_assets.h"
 
 
 typedef int bool32_t;
-typedef unsigned int size32_t;
 
 
 wchar_t path16_get_separator(void);
 
 bool path16_get_parent(const wchar_t *path, SizeU path_length, Str16_View *out);
 
-//
-// Perf helpers:
-//
-
-Int64S perf_get_counter_frequency(void);
-Int64S perf_get_counter(void);
-uint64_t perf_get_cycles_count(void);
-
-#pragma pack(push, 1)
-struct Perf_Block_Record {
-    const char *label;
-    const char *function;
-    const char *file_path;
-    uint64_t line_number;
-    uint64_t cycles_begin;
-    uint64_t cycles_end;
-    Int64S counter_begin;
-    Int64S counter_end;
-};
-#pragma pack(pop)
-
-void perf_block_record_print(const Perf_Block_Record *record);
-
-#define PERF_BLOCK_RECORD(NAME) NAME##__BLOCK_RECORD
-
-#if defined(PERF_ENABLED)
-
-    #define PERF_BLOCK_BEGIN(NAME) \
-        Perf_Block_Record PERF_BLOCK_RECORD(NAME); \
-        do { \
-            PERF_BLOCK_RECORD(NAME).label = STRINGIFY(NAME); \
-            PERF_BLOCK_RECORD(NAME).function = __FUNCTION__; \
-            PERF_BLOCK_RECORD(NAME).file_path = __FILE__; \
-            PERF_BLOCK_RECORD(NAME).line_number = __LINE__; \
-            PERF_BLOCK_RECORD(NAME).cycles_begin = perf_get_cycles_count(); \
-            PERF_BLOCK_RECORD(NAME).counter_begin = perf_get_counter(); \
-        } while (0)
-
-    #define PERF_BLOCK_END(NAME) \
-        do { \
-            PERF_BLOCK_RECORD(NAME).cycles_end = perf_get_cycles_count(); \
-            PERF_BLOCK_RECORD(NAME).counter_end = perf_get_counter(); \
-            perf_block_record_print(&PERF_BLOCK_RECORD(NAME)); \
-        } while (0)
-
-#else
-
-    #define PERF_BLOCK_BEGIN(NAME)
-
-    #define PERF_BLOCK_END(NAME)
-
-#endif // if defined(PERF_ENABLED)
-
 //
 // WGL: Context initialization.
 //
@@ -180,25 +127,13 @@ static void      win32_init_opengl_context_extensions(void);
 static HGLRC     win32_init_opengl_context(HDC device_context);
 LRESULT CALLBACK win32_window_message_handler(HWND window, UINT message, WPARAM wparam, LPARAM lparam);
 
-//
-// Camera
-//
-
-
-Camera make_camera(Camera_ViewMode view_mode);
-
-void      camera_rotate(Camera *camera, float x_offset, float y_offset);
-glm::mat4 camera_get_view_matrix(Camera *camera);
-glm::mat4 camera_get_projection_matrix(Camera *camera, int viewport_width, int viewport_height);
-
 //
 // OpenGL API wrappers
 //
-GLuint compile_shader_from_str8(const char *string, GLenum type);
-GLuint link_shader_program(GLuint vertex_shader, GLuint fragment_shader);
 
 struct Vertex_Buffer_Attribute {
     bool is_normalized;
+    bool is_integer; //!< Passed to shader as integer, not converted to float.
     unsigned int type;
     unsigned int count;
     size32_t size;
@@ -228,10 +163,21 @@ Vertex_Buffer_Attribute *vertex_buffer_layout_push_attr   (Vertex_Buffer_Layout
 Vertex_Buffer_Attribute *vertex_buffer_layout_push_float  (Vertex_Buffer_Layout *layout, unsigned int count);
 Vertex_Buffer_Attribute *vertex_buffer_layout_push_integer(Vertex_Buffer_Layout *layout, unsigned int count);
 
+//!
+//! @param is_normalized If true, values are mapped to [0; 1], otherwise converted to float as is.
+//!
+Vertex_Buffer_Attribute *vertex_buffer_layout_push_unsigned_short(Vertex_Buffer_Layout *layout, unsigned int count, bool is_normalized);
+
+//!
+//! @brief Pushes attributes of `Vertex` or `Packed_Vertex`: position, UV and color. Both match `basic.sl`.
+//!
+bool vertex_buffer_layout_push_format(Vertex_Buffer_Layout *layout, Vertex_Format format);
+
 
 struct Vertex_Buffer {
     GLuint id;
     GLuint vertex_array_id;
+    GLuint index_buffer_id; //!< Zero if buffer isn't indexed.
 
     Vertex_Buffer_Layout layout;
 };
@@ -239,6 +185,11 @@ struct Vertex_Buffer {
 bool make_vertex_buffer(Vertex_Buffer *buffer);
 bool bind_vertex_buffer(Vertex_Buffer *buffer);
 
+//!
+//! @brief Uploads static index buffer and attaches it to the vertex array of the buffer.
+//!
+bool vertex_buffer_set_indexes(Vertex_Buffer *buffer, const Int32U *indexes, SizeU indexes_count);
+
 //!
 //! @brief Initializes vertex buffer layout.
 //!
@@ -404,111 +355,6 @@ bool win32_apply_changes_to_key(Input_State *input_state, Win32_Key_State key_st
 bool win32_is_vk_pressed(Int32S vk);
 
 
-//
-// Time:
-//
-
-struct Clock {
-    Int64S ticks_begin;
-    Int64S ticks_end;
-    Int64S frequency;
-};
-
-Clock make_clock(void);
-
-double clock_tick(Clock *clock);
-
-//
-// Media:
-//
-
-enum struct Bitmap_Picture_Header_Type : Int32U {
-    BitmapCoreHeader = 12,
-    Os22XBitmapHeader_S = 16,
-    BitmapInfoHeader = 40,
-    BitmapV2InfoHeader = 52,
-    BitmapV3InfoHeader = 56,
-    Os22XBitmapHeader = 64,
-    BitmapV4Header = 108,
-    BitmapV5Header = 124,
-};
-
-enum struct Bitmap_Picture_Compression_Method : Int32U {
-    RGB = 0,
-    RLE8 = 1,
-    RLE4 = 2,
-    Bitfields = 3,
-    JPEG = 4,
-    PNG = 5,
-    AlphaBitfields = 6,
-    CMYK = 11,
-    CMYKRLE8 = 12,
-    CMYKRLE4 = 13,
-};
-
-#pragma pack(push, 1)
-struct Bitmap_Picture_DIB_Header {
-    Bitmap_Picture_Header_Type header_size;
-    Int32U width;
-    Int32U height;
-    Int16U planes_count;
-    Int16U depth;
-    Bitmap_Picture_Compression_Method compression_method;
-    Int32U image_size;
-    Int32U x_pixel_per_meter;
-    Int32U y_pixel_per_meter;
-    Int32U color_used;
-    Int32U color_important;
-};
-#pragma pack(pop)
-
-#pragma pack(push, 1)
-struct Bitmap_Picture_Header {
-    Int16U type;
-    Int32U file_size;
-    Int16U reserved[2];
-    Int32U data_offset;
-};
-#pragma pack(pop)
-
-#pragma pack(push, 1)
-struct Color_BGRA_U8 {
-    Int8U b, g, r, a;
-};
-#pragma pack(pop)
-
-#pragma pack(push, 1)
-struct Bitmap_Picture {
-    Bitmap_Picture_Header header;
-    Bitmap_Picture_DIB_Header dib_header;
-
-    union {
-        void *data;
-        Color_BGRA_U8 *bgra;
-    } u;
-};
-#pragma pack(pop)
-
-bool load_bitmap_picture_info_from_file(Bitmap_Picture *picture, FILE *file);
-bool load_bitmap_picture_pixel_data_from_file(Bitmap_Picture *picture, FILE *file);
-
-
-//
-// Media:
-//
-
-enum struct Color_Layout {
-    Nothing,
-    BGRA_U8,
-};
-
-
-//
-// @pre
-//   - Bind target texture with glBindTexture(GL_TEXTURE_2D, ...);
-//
-void gl_make_texture_from_pixels(void *pixels, size32_t width, size32_t height, Color_Layout layout, GLenum internal_format);
-
 
 void gl_clear_all_errors(void);
 void gl_die_on_first_error(void);
@@ -539,6 +385,9 @@ typedef void (* watch_notification_routine_t)(Watch_Context *watch_context, cons
 
 struct Watch_Context {
     std::atomic_flag should_stop;
+    HANDLE stop_event; //! @note Wakes up worker, which waits for directory changes (see `watch_context_stop`).
+    HANDLE thread;
+
     const wchar_t *target_dir;
     watch_notification_routine_t notification_routine;
     void *parameter;
@@ -546,10 +395,16 @@ struct Watch_Context {
 
 bool make_watch_context(Watch_Context *context, void *parameter = nullptr, const wchar_t *target_dir = nullptr, watch_notification_routine_t notification_routine = nullptr);
 DWORD watch_context_launch_thread(Watch_Context *context, HANDLE *out_thread_handle = nullptr);
+
+//!
+//! @brief Wakes up worker and waits for it to finish.
+//!
+bool watch_context_stop(Watch_Context *context);
+
 void watch_thread_worker(PVOID param);
 
 //
-// Assets:
+// Gameplay module:
 //
 
 struct Gameplay {
@@ -565,162 +420,6 @@ struct Gameplay {
 Gameplay load_gameplay(const char *module_path);
 void unload_gameplay(Gameplay *gameplay);
 
-enum struct Asset_Type {
-    Texture,
-    Shader,
-    Tilemap,
-    Count_
-};
-
-enum struct Asset_Store_Place {
-    //!
-    //! @brief That indicates, that `Asset_Store` represented by some kind of folder. Probably usefull for development[2025/04/06]
-    //!
-    Folder,
-
-    //!
-    //! @brief That indicates, that `Asset_Store` located inside the single file. Probably usefull only on exports.
-    //!
-    Image,
-};
-
-struct Asset_Store {
-    static constexpr Int16U max_asset_count = 1024;
-
-    mm::Block_Allocator asset_pool;
-    mm::Block_Allocator asset_content;
-
-    // TODO(gr3yknigh1): Add support for using `store image-file` (single file) [2025/03/06]
-    // TODO(gr3yknigh1): Support for utf-8 or wide paths? [2025/03/06]
-
-    Asset_Store_Place place;
-
-    union {
-        const char *folder;
-    } u;
-};
-
-#if !defined(FOR_EACH_ASSET)
-    #define FOR_EACH_ASSET(IT, ASSET_STORE_PTR) \
-        for (Asset *IT = static_cast<Asset *>(first(&(ASSET_STORE_PTR)->asset_pool)); IT != nullptr; IT = static_cast<Asset *>(next(&(ASSET_STORE_PTR)->asset_pool, static_cast<void *>(IT)) ))
-#endif
-
-struct Reload_Context {
-    Asset_Store *store;
-
-    //
-    // NOTE(gr3yknigh1): Found no place for this. Think about it later, if it becomes a problem [2025/03/10]
-    //
-    std::atomic_flag should_reload_gameplay;
-};
-
-enum struct Asset_Location_Type {
-    None,
-    File,
-    Buffer,
-};
-
-struct File_Info {
-    FILE *handle;
-    SizeU size;
-    Str8 path;
-
-    ~File_Info(void) noexcept {}
-};
-
-struct Asset_Location {
-    Asset_Location_Type type;
-
-    union Location_Union {
-        File_Info file;
-        mm::Buffer_View buffer_view;
-
-        ~Location_Union(void) noexcept {}
-    } u;
-
-    ~Asset_Location(void) noexcept {}
-};
-
-
-bool make_asset_store_from_folder(Asset_Store *store, const char *folder_path);
-bool asset_store_destroy(Asset_Store *store);
-
-struct Texture {
-    int width;
-    int height;
-    Color_Layout layout;
-
-    GLuint unit;
-    GLuint id;
-
-    union {
-        void *data;
-        Color_BGRA_U8 *bgra_u8;
-    } pixels;
-};
-
-enum struct Asset_State {
-    NotLoaded,
-    LoadFailure,
-    Loaded,
-    UnloadFailure,
-    Unloaded
-};
-
-
-enum struct Shader_Module_Type {
-    Vertex,
-    Fragment,
-
-    Count_
-};
-
-struct Shader_Module {
-    GLuint id;
-};
-
-struct Shader {
-    GLuint program_id;
-    char *source_code;
-
-    Shader_Module modules[static_cast<SizeU>(Shader_Module_Type::Count_)];
-};
-
-struct Asset {
-    Asset_Type type;
-    Asset_Location location;
-    Asset_State state;
-
-    std::atomic_flag should_reload;
-
-    union {
-        Texture texture;
-        Shader shader;
-        Tilemap tilemap;
-    } u;
-
-    ~Asset(void) noexcept {}
-};
-
-Asset *asset_load(Asset_Store *store, Asset_Type type, const Str8_View file_path);
-
-// helper
-bool load_tilemap_from_buffer(Asset_Store *store, char *buffer, SizeU buffer_size, Tilemap *tilemap);
-bool asset_image_send_to_gpu(Asset_Store *store, Asset *asset, int unit, Shader *shader);
-
-bool shader_bind(Shader *shader);
-
-bool asset_from_bitmap_picture(Asset *asset, Bitmap_Picture *picture);
-
-bool asset_reload(Asset_Store *store, Asset *asset);
-bool asset_unload(Asset_Store *store, Asset *asset);
-
-struct Shader_Compile_Result {
-    GLuint shader_program_id;
-};
-
-Shader_Compile_Result compile_shader(char *source_code, SizeU file_size);
-
 void asset_watch_routine(Watch_Context *, const Str16_View, File_Action, void *);
 
 #pragma message( "GARDEN_GAMEPLAY_CODE='" STRINGIFY(GARDEN_GAMEPLAY_CODE) "'" )
@@ -743,6 +442,14 @@ DllMain([[maybe_unused]] HINSTANCE instance, DWORD reason, [[maybe_unused]] LPVO
     return TRUE;
 }
 
+#elif GARDEN_BENCHMARK_CODE
+
+#include "garden_benchmark.cpp"
+
+#elif GARDEN_TOOLS_CODE
+
+#include "garden_tools.cpp"
+
 #else
 
 #if !defined(GARDEN_ASSETS_FOLDER)
@@ -873,9 +580,7 @@ wWinMain(HINSTANCE instance, [[maybe_unused]] HINSTANCE previous_instance, [[may
     Vertex_Buffer_Layout vertex_buffer_layout{};
     assert(make_vertex_buffer_layout(&page_arena, &vertex_buffer_layout, 4));
 
-    assert(vertex_buffer_layout_push_float(&vertex_buffer_layout, 2));
-    assert(vertex_buffer_layout_push_float(&vertex_buffer_layout, 2));
-    assert(vertex_buffer_layout_push_integer(&vertex_buffer_layout, 1));
+    assert(vertex_buffer_layout_push_format(&vertex_buffer_layout, Vertex_Format::Regular));
 
     vertex_buffer_layout_build_attrs(&vertex_buffer_layout);
 
@@ -887,32 +592,42 @@ wWinMain(HINSTANCE instance, [[maybe_unused]] HINSTANCE previous_instance, [[may
     Asset_Store store;
     assert(make_asset_store_from_folder(&store, STRINGIFY(GARDEN_ASSETS_FOLDER)));
 
-    Asset *basic_shader_asset = asset_load(&store, Asset_Type::Shader, R"(P:\garden\assets\basic.sl)");
+    //
+    // NOTE(gr3yknigh1): Atlas and tilemap are read by workers, while main thread compiles shader. [2026/10/17]
+    //
+    Asset_Handle atlas_handle = asset_load_async(&store, Asset_Type::Texture, R"(P:\garden\assets\garden_atlas.bmp)");
+    Asset *atlas_asset = asset_store_get(&store, atlas_handle);
+    assert(atlas_asset);
+
+    Asset_Handle tilemap_handle = asset_load_async(&store, Asset_Type::Tilemap, R"(P:\garden\assets\demo.tilemap.tp)");
+    Asset *tilemap_asset = asset_store_get(&store, tilemap_handle);
+    assert(tilemap_asset);
+
+    Asset_Handle basic_shader_handle = asset_load(&store, Asset_Type::Shader, R"(P:\garden\assets\basic.sl)");
+    Asset *basic_shader_asset = asset_store_get(&store, basic_shader_handle);
     assert(basic_shader_asset);
 
     Shader *basic_shader = &basic_shader_asset->u.shader;
 
     glUseProgram(basic_shader->program_id);
 
-    GLint model_uniform_loc = glGetUniformLocation(basic_shader->program_id, "model");
-    assert(model_uniform_loc != -1);
-
-    GLint projection_uniform_loc = glGetUniformLocation(basic_shader->program_id, "projection");
-    assert(projection_uniform_loc != -1);
-
     Camera camera = make_camera(Camera_ViewMode::Orthogonal);
 
     glm::mat4 model = glm::identity<glm::mat4>();
     glm::mat4 projection = camera_get_projection_matrix(&camera, window_width, window_height);
 
-    glUniformMatrix4fv(model_uniform_loc, 1, GL_FALSE, glm::value_ptr(model));
-    glUniformMatrix4fv(projection_uniform_loc, 1, GL_FALSE, glm::value_ptr(projection));
+    glUniformMatrix4fv(basic_shader->model_location, 1, GL_FALSE, glm::value_ptr(model));
+    glUniformMatrix4fv(basic_shader->projection_location, 1, GL_FALSE, glm::value_ptr(projection));
 
     //
     // Atlas:
     //
-    Asset *atlas_asset = asset_load(&store, Asset_Type::Texture, R"(P:\garden\assets\garden_atlas.bmp)");
-    assert(atlas_asset);
+    asset_store_wait_loading(&store);
+
+    for (Asset *it = asset_store_pop_completed(&store); it != nullptr; it = asset_store_pop_completed(&store)) {
+        assert(it->state == Asset_State::Loaded);
+    }
+
     assert(asset_image_send_to_gpu(&store, atlas_asset, 0, basic_shader));
 
     //
@@ -932,8 +647,7 @@ wWinMain(HINSTANCE instance, [[maybe_unused]] HINSTANCE previous_instance, [[may
     //
     // Setup tilemap atlas:
     //
-    Asset *tilemap_asset = asset_load(&store, Asset_Type::Tilemap, R"(P:\garden\assets\demo.tilemap.tp)");
-    assert(asset_image_send_to_gpu(&store, tilemap_asset->u.tilemap.texture_asset, 1, basic_shader));
+    assert(asset_image_send_to_gpu(&store, asset_store_get(&store, tilemap_asset->u.tilemap.texture_asset), 1, basic_shader));
 
     Vertex_Buffer tilemap_vertex_buffer{};
     assert(make_vertex_buffer(&tilemap_vertex_buffer));
@@ -942,9 +656,7 @@ wWinMain(HINSTANCE instance, [[maybe_unused]] HINSTANCE previous_instance, [[may
     Vertex_Buffer_Layout tilemap_vertex_buffer_layout{};
     assert(make_vertex_buffer_layout(&page_arena, &tilemap_vertex_buffer_layout, 4));
 
-    assert(vertex_buffer_layout_push_float(&tilemap_vertex_buffer_layout, 2));    // Position
-    assert(vertex_buffer_layout_push_float(&tilemap_vertex_buffer_layout, 2));    // UV
-    assert(vertex_buffer_layout_push_integer(&tilemap_vertex_buffer_layout, 1));  // Color
+    assert(vertex_buffer_layout_push_format(&tilemap_vertex_buffer_layout, Vertex_Format::Packed));
 
     vertex_buffer_layout_build_attrs(&tilemap_vertex_buffer_layout);
 
@@ -952,18 +664,33 @@ wWinMain(HINSTANCE instance, [[maybe_unused]] HINSTANCE previous_instance, [[may
 
     Tilemap *tilemap = &tilemap_asset->u.tilemap;
     Float32 tilemap_position_x = 100, tilemap_position_y = 100;
-    Texture *tilemap_texture = &tilemap->texture_asset->u.texture;
+    Texture *tilemap_texture = &asset_store_get(&store, tilemap->texture_asset)->u.texture;
 
     Atlas tilemap_atlas{
         static_cast<Float32>(tilemap_texture->width),
         static_cast<Float32>(tilemap_texture->height)
     };
 
-    Vertex *tilemap_vertexes = mm::allocate_structs<Vertex>(tilemap->tiles_count() * TILEMAP_VERTEX_COUNT_PER_TILE); //! @todo Free later. #memory
-    Int32U tilemap_vertexes_count = generate_geometry_from_tilemap(
-        tilemap_vertexes, tilemap->tiles_count() * TILEMAP_VERTEX_COUNT_PER_TILE, //! @todo #refactor
-        tilemap, tilemap_position_x, tilemap_position_y,
-        {255, 255, 255, 255}, &tilemap_atlas);
+    //
+    // NOTE(gr3yknigh1): Packed quads take 48 bytes per tile instead of 120 of six `Vertex`. [2026/10/17]
+    //
+    Tilemap_Geometry tilemap_geometry{};
+    assert(make_tilemap_geometry(
+        &tilemap_geometry, tilemap, tilemap_position_x, tilemap_position_y, {255, 255, 255, 255}, &tilemap_atlas,
+        Vertex_Format::Packed));
+
+    Int32U tilemap_draw_ranges_capacity = tilemap_geometry.chunk_row_count * tilemap_geometry.chunk_col_count;
+    Tilemap_Draw_Range *tilemap_draw_ranges = mm::allocate_structs<Tilemap_Draw_Range>(tilemap_draw_ranges_capacity);
+    assert(tilemap_draw_ranges);
+
+    //
+    // NOTE(gr3yknigh1): Geometry is uploaded once, each frame only visible chunks are drawn from it. [2026/10/17]
+    //
+    assert(bind_vertex_buffer(&tilemap_vertex_buffer));
+    glBufferData(
+        GL_ARRAY_BUFFER, tilemap_geometry.vertexes_count * vertex_format_get_size(tilemap_geometry.format),
+        tilemap_geometry.vertexes.data, GL_STATIC_DRAW);
+    assert(vertex_buffer_set_indexes(&tilemap_vertex_buffer, tilemap_geometry.indexes, tilemap_geometry.indexes_count));
 
     //
     // Game mainloop:
@@ -981,8 +708,20 @@ wWinMain(HINSTANCE instance, [[maybe_unused]] HINSTANCE previous_instance, [[may
     Platform_Context platform_context{};
 
     platform_context.camera = &camera;
-    platform_context.persist_arena = mm::make_static_arena(1024);
-    platform_context.vertexes_arena = mm::make_static_arena(sizeof(Vertex) * 1024);
+    platform_context.persist_arena = mm::make_virtual_arena();
+    assert(platform_context.persist_arena.data);
+
+    platform_context.atlas_texture = atlas_handle;
+    platform_context.basic_shader = basic_shader_handle;
+
+    assert(make_sprite_batch(&platform_context.sprite_batch));
+
+    //
+    // NOTE(gr3yknigh1): Sprite quads always take same indexes, so they are uploaded once for whole capacity. [2026/10/17]
+    //
+    assert(bind_vertex_buffer(&entity_vertex_buffer));
+    assert(vertex_buffer_set_indexes(
+        &entity_vertex_buffer, platform_context.sprite_batch.indexes, platform_context.sprite_batch.indexes_count));
 
     Game_Context *game_context = reinterpret_cast<Game_Context *>(gameplay.on_init(&platform_context));
     gameplay.on_load(&platform_context, game_context);
@@ -1091,49 +830,43 @@ wWinMain(HINSTANCE instance, [[maybe_unused]] HINSTANCE previous_instance, [[may
             // Asset Hot reload:
             //
 
-            FOR_EACH_ASSET(it, &store) {
-                if (it->state == Asset_State::NotLoaded) {
+            for (Asset *it = asset_store_pop_dirty(&store); it != nullptr; it = asset_store_pop_dirty(&store)) {
+                if (it->state == Asset_State::NotLoaded || it->state == Asset_State::Loading) {
                     continue;
                 }
 
-                if (it->location.type != Asset_Location_Type::File) {
-                    continue;
-                }
-
-                if (!it->should_reload.test()) {
-                    continue;
-                }
+                assert(asset_reload_async(&store, it));
+            }
 
-                assert(asset_reload(&store, it));
+            //
+            // NOTE(gr3yknigh1): Only GPU upload is left for main thread, file reading and decoding happen on asset
+            // workers. [2026/10/17]
+            //
+            for (Asset *it = asset_store_pop_completed(&store); it != nullptr; it = asset_store_pop_completed(&store)) {
+                assert(it->state == Asset_State::Loaded);
 
                 if (it->type == Asset_Type::Texture) {
                     assert(asset_image_send_to_gpu(&store, it, it->u.texture.unit, basic_shader));
                 }
 
+                // NOTE(gr3yknigh1): Reloaded tilemap comes with new texture asset, previous one is released. [2026/10/17]
+                if (it->type == Asset_Type::Tilemap) {
+                    assert(asset_image_send_to_gpu(&store, asset_store_get(&store, it->u.tilemap.texture_asset), 1, basic_shader));
+                }
+
                 if (it->type == Asset_Type::Shader) {
                     Shader *shader = &it->u.shader;
 
                     glUseProgram(shader->program_id);
 
-                    model_uniform_loc = glGetUniformLocation(shader->program_id, "model");
-                    assert(model_uniform_loc != -1);
-
-                    projection_uniform_loc = glGetUniformLocation(shader->program_id, "projection");
-                    assert(projection_uniform_loc != -1);
-
                     model = glm::identity<glm::mat4>();
                     projection = camera_get_projection_matrix(&camera, window_width, window_height);
 
-                    glUniformMatrix4fv(model_uniform_loc, 1, GL_FALSE, glm::value_ptr(model));
-                    glUniformMatrix4fv(projection_uniform_loc, 1, GL_FALSE, glm::value_ptr(projection));
+                    glUniformMatrix4fv(shader->model_location, 1, GL_FALSE, glm::value_ptr(model));
+                    glUniformMatrix4fv(shader->projection_location, 1, GL_FALSE, glm::value_ptr(projection));
 
-                    GLuint atlas_texture_uniform_loc = glGetUniformLocation(shader->program_id, "u_texture");
-                    assert(atlas_texture_uniform_loc != -1);
-
-                    glUniform1i(atlas_texture_uniform_loc, atlas_asset->u.texture.unit);
+                    glUniform1i(shader->texture_location, atlas_asset->u.texture.unit);
                 }
-
-                it->should_reload.clear();
             }
 
 
@@ -1150,44 +883,112 @@ wWinMain(HINSTANCE instance, [[maybe_unused]] HINSTANCE previous_instance, [[may
             model = glm::translate(model, glm::vec3(window_width / 2, window_height / 2, 0));
 
             projection = camera_get_projection_matrix(&camera, window_width, window_height);
-            glUniformMatrix4fv(model_uniform_loc, 1, GL_FALSE, glm::value_ptr(model));
-            glUniformMatrix4fv(projection_uniform_loc, 1, GL_FALSE, glm::value_ptr(projection));
+
+            glUseProgram(basic_shader->program_id);
+            glUniformMatrix4fv(basic_shader->model_location, 1, GL_FALSE, glm::value_ptr(model));
+            glUniformMatrix4fv(basic_shader->projection_location, 1, GL_FALSE, glm::value_ptr(projection));
 
             gameplay.on_draw(&platform_context, game_context, static_cast<float>(dt));
 
             glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-            if (tilemap_vertexes_count > 0) {
+            // NOTE(gr3yknigh1): Texture handle is null, while tilemap is reloading. [2026/10/17]
+            Asset *tilemap_texture_asset = asset_store_get(&store, tilemap_asset->u.tilemap.texture_asset);
+
+            //
+            // NOTE(gr3yknigh1): Only tiles changed by `tilemap_set_tile` are sent again. [2026/10/17]
+            //
+            if (tilemap_geometry_flush_dirty(&tilemap_geometry) > 0) {
+                assert(bind_vertex_buffer(&tilemap_vertex_buffer));
+
+                for (Int32U range_index = 0; range_index < tilemap_geometry.dirty_ranges_count; ++range_index) {
+                    const Tilemap_Dirty_Range *range = tilemap_geometry.dirty_ranges + range_index;
+                    glBufferSubData(
+                        GL_ARRAY_BUFFER, static_cast<GLintptr>(range->offset), static_cast<GLsizeiptr>(range->size),
+                        static_cast<Byte *>(tilemap_geometry.vertexes.data) + range->offset);
+                }
+            }
+
+            Int32U tilemap_draw_ranges_count = tilemap_geometry_cull(
+                &tilemap_geometry, camera_get_view_rect(&camera, window_width, window_height),
+                tilemap_draw_ranges, tilemap_draw_ranges_capacity);
+
+            if (tilemap_draw_ranges_count > 0 && tilemap_texture_asset != nullptr) {
                 assert(bind_vertex_buffer(&tilemap_vertex_buffer));
 
                 /// XXX
-                glActiveTexture(GL_TEXTURE0 + tilemap_asset->u.tilemap.texture_asset->u.texture.unit);
-                GLuint texture_uniform_loc = glGetUniformLocation(basic_shader->program_id, "u_texture");
-                assert(texture_uniform_loc != -1);
-                glUniform1i(texture_uniform_loc, tilemap_asset->u.tilemap.texture_asset->u.texture.unit);
-
-                SizeU vertex_buffer_size = tilemap_vertexes_count * sizeof(*tilemap_vertexes);
-                glBufferData(GL_ARRAY_BUFFER, vertex_buffer_size, tilemap_vertexes, GL_DYNAMIC_DRAW);
-                glDrawArrays(GL_TRIANGLES, 0, (GLsizei)(vertex_buffer_size / vertex_buffer_layout.stride)); // TODO(gr3yknigh1): Replace layout [2025/03/30]
+                glActiveTexture(GL_TEXTURE0 + tilemap_texture_asset->u.texture.unit);
+                glUniform1i(basic_shader->texture_location, tilemap_texture_asset->u.texture.unit);
+
+                //
+                // NOTE(gr3yknigh1): Positions of packed vertexes are relative to their chunk. [2026/10/17]
+                //
+                for (Int32U range_index = 0; range_index < tilemap_draw_ranges_count; ++range_index) {
+                    const Tilemap_Draw_Range *range = tilemap_draw_ranges + range_index;
+
+                    glm::mat4 chunk_model = glm::translate(model, glm::vec3(range->origin_x, range->origin_y, 0));
+                    glUniformMatrix4fv(basic_shader->model_location, 1, GL_FALSE, glm::value_ptr(chunk_model));
+
+                    glDrawElements(
+                        GL_TRIANGLES, static_cast<GLsizei>(range->indexes_count), GL_UNSIGNED_INT,
+                        reinterpret_cast<void *>(range->first_index * sizeof(*tilemap_geometry.indexes)));
+                }
+
+                glUniformMatrix4fv(basic_shader->model_location, 1, GL_FALSE, glm::value_ptr(model));
             }
 
-            if (platform_context.vertexes_count > 0) {
+            //
+            // NOTE(gr3yknigh1): Sprites come sorted by layer, shader and texture, so state is switched only between
+            // draws which differ in it. [2026/10/17]
+            //
+            Sprite_Batch *sprite_batch = &platform_context.sprite_batch;
+
+            if (sprite_batch_build(sprite_batch) > 0) {
                 assert(bind_vertex_buffer(&entity_vertex_buffer));
 
-                /// XXX
-                glActiveTexture(GL_TEXTURE0 + atlas_asset->u.texture.unit);
-                GLuint texture_uniform_loc = glGetUniformLocation(basic_shader->program_id, "u_texture");
-                assert(texture_uniform_loc != -1);
-                glUniform1i(texture_uniform_loc, atlas_asset->u.texture.unit);
+                SizeU vertex_buffer_size = sprite_batch->sprites_count * QUAD_VERTEX_COUNT * sizeof(Vertex);
+                glBufferData(GL_ARRAY_BUFFER, vertex_buffer_size, sprite_batch->sorted_vertexes, GL_DYNAMIC_DRAW);
+
+                Asset_Handle bound_shader{};
+                Asset_Handle bound_texture{};
+
+                for (Int32U draw_index = 0; draw_index < sprite_batch->draws_count; ++draw_index) {
+                    const Sprite_Draw *draw = sprite_batch->draws + draw_index;
+
+                    // NOTE(gr3yknigh1): Handles are null or stale, while their assets are reloading. [2026/10/17]
+                    Asset *shader_asset = asset_store_get(&store, draw->state.shader);
+                    Asset *texture_asset = asset_store_get(&store, draw->state.texture);
+
+                    if (shader_asset == nullptr || texture_asset == nullptr) {
+                        continue;
+                    }
+
+                    Shader *shader = &shader_asset->u.shader;
+
+                    if (bound_shader != draw->state.shader) {
+                        glUseProgram(shader->program_id);
+                        glUniformMatrix4fv(shader->model_location, 1, GL_FALSE, glm::value_ptr(model));
+                        glUniformMatrix4fv(shader->projection_location, 1, GL_FALSE, glm::value_ptr(projection));
+
+                        bound_shader = draw->state.shader;
+                        bound_texture = {};
+                    }
 
-                SizeU vertex_buffer_size = platform_context.vertexes_count * sizeof(*platform_context.vertexes);
-                glBufferData(GL_ARRAY_BUFFER, vertex_buffer_size, platform_context.vertexes, GL_DYNAMIC_DRAW);
-                glDrawArrays(GL_TRIANGLES, 0, (GLsizei)(vertex_buffer_size / vertex_buffer_layout.stride));
+                    if (bound_texture != draw->state.texture) {
+                        glActiveTexture(GL_TEXTURE0 + texture_asset->u.texture.unit);
+                        glUniform1i(shader->texture_location, texture_asset->u.texture.unit);
 
-                platform_context.vertexes_count = 0;
-                reset(&platform_context.vertexes_arena);
+                        bound_texture = draw->state.texture;
+                    }
+
+                    glDrawElements(
+                        GL_TRIANGLES, static_cast<GLsizei>(draw->indexes_count), GL_UNSIGNED_INT,
+                        reinterpret_cast<void *>(draw->first_index * sizeof(*sprite_batch->indexes)));
+                }
             }
 
+            sprite_batch_reset(sprite_batch);
+
             //
             // ImGui new frame:
             //
@@ -1222,17 +1023,17 @@ wWinMain(HINSTANCE instance, [[maybe_unused]] HINSTANCE previous_instance, [[may
     ImGui_ImplWin32_Shutdown();
     ImGui::DestroyContext();
 
-    //
-    // TODO(gr3yknigh1): Make ReadDirectoryChangesW asyncronous, so you
-    // can set the flag to stop the worker: watch_context.should_stop.test_and_set();. [2025/05/25]
-    //
-    //WaitForSingleObject(watch_thread, INFINITE); // TODO(gr3yknigh1): Wait for thread [2025/02/23]
+    assert(watch_context_stop(&watch_context));
 
     glDeleteProgram(basic_shader->program_id); // @cleanup Replace with asset_shader_free
 
+    mm::deallocate(tilemap_draw_ranges);
+    tilemap_geometry_destroy(&tilemap_geometry);
+
     mm::destroy(&page_arena);
-    mm::destroy(&platform_context.vertexes_arena);
+    sprite_batch_destroy(&platform_context.sprite_batch);
     mm::destroy(&platform_context.persist_arena);
+    mm::release_scratch_arena();
 
     assert(FreeLibrary(opengl_module));
     CloseWindow(window); // TODO(gr3yknigh1): why it fails? [2025/02/23]
@@ -1504,87 +1305,6 @@ win32_init_opengl_context(HDC device_context)
 
 #endif
 
-GLenum
-gl_convert_shader_module_type_to_gl_enum(Shader_Module_Type type) {
-
-    if (type == Shader_Module_Type::Vertex) {
-        return GL_VERTEX_SHADER;
-    }
-
-    if (type == Shader_Module_Type::Fragment) {
-        return GL_FRAGMENT_SHADER;
-    }
-
-    return 0;
-}
-
-GLuint
-compile_shader_from_str8(const char *string, Shader_Module_Type type)
-{
-    GLenum gl_shader_type = gl_convert_shader_module_type_to_gl_enum(type);
-
-    GLuint id = glCreateShader(gl_shader_type);
-    glShaderSource(id, 1, &string, 0);
-    glCompileShader(id);
-
-    GLint status = GL_TRUE;
-    glGetShaderiv(id, GL_COMPILE_STATUS, &status);
-
-    if (status == GL_FALSE) {
-        //
-        // TODO(gr3yknigh1): Make Shader_Compiler struct with which you should report compile errors [2025/03/28]
-        //
-        GLint log_length = 0;
-        glGetShaderiv(id, GL_INFO_LOG_LENGTH, &log_length);
-        assert(log_length);
-
-        SizeU log_buffer_size = log_length + 1;
-        char *log_buffer = static_cast<char *>(mm::allocate(log_buffer_size));
-        assert(log_buffer);
-
-        glGetShaderInfoLog(id, (GLsizei)log_buffer_size, 0, log_buffer);
-
-        assert(false); // TODO(i.akkuzin): Implement DIE macro [2025/02/08]
-        /* DIE_MF("Failed to compile OpenGL shader! %s", logBuffer); */
-        mm::deallocate(log_buffer);
-    }
-
-    return id;
-}
-
-GLuint
-link_shader_program(GLuint vertex_shader, GLuint fragment_shader)
-{
-    GLuint id = glCreateProgram();
-
-    glAttachShader(id, vertex_shader);
-    glAttachShader(id, fragment_shader);
-    glLinkProgram(id);
-
-    glValidateProgram(id);
-
-    GLint status = GL_TRUE;
-    glGetProgramiv(id, GL_LINK_STATUS, &status);
-
-    if (status == GL_FALSE) {
-        GLint log_length{0};
-        glGetProgramiv(id, GL_INFO_LOG_LENGTH, &log_length);
-
-        SizeU log_buffer_size = log_length + 1;
-        char *log_buffer = static_cast<char *>(mm::allocate(log_buffer_size));
-        assert(log_buffer);
-
-        glGetProgramInfoLog(id, (GLsizei)log_buffer_size, NULL, log_buffer);
-
-        assert(false); // TODO(i.akkuzin): Implement DIE macro [2025/02/08]
-        /* DIE_MF("Failed to link OpenGL program! %s", logBuffer); */
-        mm::deallocate(log_buffer);
-    }
-
-    return id;
-}
-
-
 bool
 make_vertex_buffer_layout(mm::Fixed_Arena *arena, Vertex_Buffer_Layout *layout, size32_t attributes_capacity)
 {
@@ -1633,7 +1353,13 @@ Vertex_Buffer_Attribute *
 vertex_buffer_layout_push_integer(Vertex_Buffer_Layout *layout, unsigned int count)
 {
     size32_t attribute_size = sizeof(int);
-    return vertex_buffer_layout_push_attr(layout, count, GL_INT, attribute_size);
+    Vertex_Buffer_Attribute *attribute = vertex_buffer_layout_push_attr(layout, count, GL_INT, attribute_size);
+
+    if (attribute != nullptr) {
+        attribute->is_integer = true;
+    }
+
+    return attribute;
 }
 
 Vertex_Buffer_Attribute *
@@ -1643,96 +1369,61 @@ vertex_buffer_layout_push_float(Vertex_Buffer_Layout *layout, unsigned int count
     return vertex_buffer_layout_push_attr(layout, count, GL_FLOAT, attribute_size);
 }
 
-void
-vertex_buffer_layout_build_attrs(const Vertex_Buffer_Layout *layout)
+Vertex_Buffer_Attribute *
+vertex_buffer_layout_push_unsigned_short(Vertex_Buffer_Layout *layout, unsigned int count, bool is_normalized)
 {
-    SizeU offset = 0;
-
-    for (unsigned int attribute_index = 0; attribute_index < layout->attributes_count;
-         ++attribute_index) {
-        Vertex_Buffer_Attribute *attribute = layout->attributes + attribute_index;
+    size32_t attribute_size = sizeof(Int16U);
+    Vertex_Buffer_Attribute *attribute = vertex_buffer_layout_push_attr(layout, count, GL_UNSIGNED_SHORT, attribute_size);
 
-        glEnableVertexAttribArray(attribute_index);
-        glVertexAttribPointer(
-            attribute_index, attribute->count, attribute->type,
-            attribute->is_normalized, layout->stride, (void *)offset);
-
-        offset += attribute->size * attribute->count;
+    if (attribute != nullptr) {
+        attribute->is_normalized = is_normalized;
     }
+
+    return attribute;
 }
 
-Camera
-make_camera(Camera_ViewMode view_mode)
+bool
+vertex_buffer_layout_push_format(Vertex_Buffer_Layout *layout, Vertex_Format format)
 {
-    Camera camera{};
-
-    camera.position = {0, 0, 3.0f};
-    camera.front = {0, 0, -1.0f};
-    camera.up = {0, 1.0f, 0};
-
-    camera.yaw = -90.0f;
-    camera.pitch = 0.0f;
+    bool result = true;
 
-    camera.speed = 10.0f;
-    camera.sensitivity = 0.5f;
-    camera.fov = 45.0f;
+    if (format == Vertex_Format::Packed) {
+        result = result && vertex_buffer_layout_push_unsigned_short(layout, 2, false); // Position
+        result = result && vertex_buffer_layout_push_unsigned_short(layout, 2, true);  // UV
+    } else {
+        result = result && vertex_buffer_layout_push_float(layout, 2); // Position
+        result = result && vertex_buffer_layout_push_float(layout, 2); // UV
+    }
 
-    camera.near = 0.1f;
-    camera.far = 100.0f;
+    result = result && vertex_buffer_layout_push_integer(layout, 1); // Color
 
-    camera.view_mode = view_mode;
+    assert(!result || layout->stride == vertex_format_get_size(format));
 
-    return camera;
+    return result;
 }
 
 void
-camera_rotate(Camera *camera, float x_offset, float y_offset)
+vertex_buffer_layout_build_attrs(const Vertex_Buffer_Layout *layout)
 {
-    x_offset *= camera->sensitivity;
-    y_offset *= camera->sensitivity;
-
-    camera->yaw += x_offset * 1;
-    camera->pitch += y_offset * -1;
-
-    camera->pitch = glm::clamp(camera->pitch, -89.0f, 89.0f);
-
-    float yaw_rad = glm::radians(camera->yaw);
-    float pitch_rad = glm::radians(camera->pitch);
+    SizeU offset = 0;
 
-    glm::vec3 direction = LITERAL(glm::vec3) {
-        glm::cos(yaw_rad) * glm::cos(pitch_rad),
-        glm::sin(pitch_rad),
-        glm::sin(yaw_rad) * glm::cos(pitch_rad),
-    };
-    camera->front = glm::normalize(direction);
-}
+    for (unsigned int attribute_index = 0; attribute_index < layout->attributes_count;
+         ++attribute_index) {
+        Vertex_Buffer_Attribute *attribute = layout->attributes + attribute_index;
 
-glm::mat4
-camera_get_view_matrix(Camera *camera)
-{
-    return glm::lookAt(
-        camera->position, camera->position + camera->front, camera->up);
-}
+        glEnableVertexAttribArray(attribute_index);
 
-glm::mat4
-camera_get_projection_matrix(Camera *camera, int viewport_width, int viewport_height)
-{
-    if (camera->view_mode == Camera_ViewMode::Perspective) {
-        return glm::perspective(
-            glm::radians(camera->fov),
-            (float)viewport_width / (float)viewport_height,
-            camera->near, camera->far);
-    }
+        // NOTE(gr3yknigh1): Shader reads color as `int`, float conversion would garble the packed bits. [2026/10/17]
+        if (attribute->is_integer) {
+            glVertexAttribIPointer(attribute_index, attribute->count, attribute->type, layout->stride, (void *)offset);
+        } else {
+            glVertexAttribPointer(
+                attribute_index, attribute->count, attribute->type,
+                attribute->is_normalized, layout->stride, (void *)offset);
+        }
 
-    if (camera->view_mode == Camera_ViewMode::Orthogonal) {
-        return glm::ortho(
-            0.0f, (float)viewport_width,
-            0.0f, (float)viewport_height,
-            camera->near, camera->far);
+        offset += attribute->size * attribute->count;
     }
-
-    assert(false); // TODO(i.akkuzin): Implement DIE macro [2025/02/09]
-    exit(1);
 }
 
 Int64S
@@ -1760,21 +1451,6 @@ perf_get_cycles_count(void)
     return cycles_count;
 }
 
-void
-perf_block_record_print(const Perf_Block_Record *record)
-{
-    Int64S perf_frequency = perf_get_counter_frequency();
-
-    Int64S counter_elapsed = record->counter_end - record->counter_begin;
-    Int64S ms_elapsed = (1000 * counter_elapsed) / perf_frequency;
-    uint64_t cycles_elapsed = record->cycles_end - record->cycles_begin;
-    uint64_t mega_cycles_elapsed = cycles_elapsed / (1000 * 1000);
-
-    printf(
-        "PERF: %s:%llu@%s [%s]: counter = (%llu) ms = (%llu) | Mc = %llu\n", record->file_path, record->line_number,
-        record->function, record->label, counter_elapsed, ms_elapsed, mega_cycles_elapsed);
-}
-
 bool
 win32_apply_changes_to_key(Input_State *input_state, Win32_Key_State key_state, Key_Code *changed_key)
 {
@@ -1855,26 +1531,6 @@ win32_apply_changes_to_key(Input_State *input_state, Win32_Key_State key_state,
     return true;
 }
 
-Clock
-make_clock(void)
-{
-    Clock clock;
-    clock.ticks_begin = perf_get_counter();
-    clock.ticks_end = 0;
-    clock.frequency = perf_get_counter_frequency();
-    return clock;
-}
-
-
-double
-clock_tick(Clock *clock)
-{
-    clock->ticks_end = perf_get_counter();
-    double elapsed = (double)(clock->ticks_end - clock->ticks_begin) / (double)clock->frequency;
-    clock->ticks_begin = perf_get_counter();
-    return elapsed;
-}
-
 bool
 win32_is_vk_pressed(Int32S vk)
 {
@@ -1883,142 +1539,6 @@ win32_is_vk_pressed(Int32S vk)
     return result;
 }
 
-bool
-load_bitmap_picture_info_from_file(Bitmap_Picture *picture, FILE *file)
-{
-    // TODO(gr3yknigh1): Make sure that SEEK_SET is in position [2025/03/10]
-    fread(&picture->header, sizeof(picture->header), 1, file);
-    fread(&picture->dib_header, sizeof(picture->dib_header), 1, file);
-
-    // TODO(gr3yknigh1): Handle read errors [2025/03/10]
-    return true;
-}
-
-bool
-load_bitmap_picture_pixel_data_from_file(Bitmap_Picture *picture, FILE *file)
-{
-    fseek(file, picture->header.data_offset, SEEK_SET);
-    fread(picture->u.data, picture->header.file_size, 1, file);
-    fseek(file, 0, SEEK_SET);
-
-    // TODO(gr3yknigh1): Handle read errors [2025/03/10]
-    return true;
-}
-
-void
-gl_make_texture_from_pixels(void *pixels, size32_t width, size32_t height, Color_Layout layout, GLenum internal_format)
-{
-    assert(layout == Color_Layout::BGRA_U8);
-
-    GLenum format = 0, type = 0;
-
-    if (layout == Color_Layout::BGRA_U8) {
-        format = GL_BGRA;
-        type = GL_UNSIGNED_BYTE;
-    }
-
-    // TODO(gr3yknigh1): Need to add support for more formats [2025/02/23]
-
-    assert(format && type); // NOTE(gr3yknigh1): Should not be zero [2025/02/23]
-    glTexImage2D(GL_TEXTURE_2D, 0, internal_format, width, height, 0, format, type, pixels);
-}
-
-bool
-load_tilemap_from_buffer(Asset_Store *store, char *buffer, SizeU buffer_size, Tilemap *tilemap)
-{
-    Lexer lexer = make_lexer(buffer, buffer_size);
-
-    static constexpr Str8_View s_tilemap_directive = "@tilemap";
-    static constexpr Str8_View s_tilemap_image_bmp_format = "bmp";
-
-    Str8_View tilemap_image_path_view;
-
-    while (!lexer_is_end(&lexer)) {
-        lexer_skip_whitespace(&lexer);
-
-        // NOTE(gr3yknigh1): Skipping comments [2025/02/24]
-        if (lexer_check_peeked(&lexer, "//")) {
-            lexer_skip_until_endline(&lexer);
-            continue;
-        }
-
-        if (lexer_check_peeked( &lexer, s_tilemap_directive )) {
-            // TODO(gr3yknigh1): Fix this cast to signed int [2025/02/24]
-            lexer_advance(&lexer, (int32_t)s_tilemap_directive.length);
-            lexer_skip_whitespace(&lexer);
-
-            assert(lexer_parse_int(&lexer, &tilemap->row_count));
-            lexer_skip_whitespace(&lexer);
-
-            assert(lexer_parse_int(&lexer, &tilemap->col_count));
-            lexer_skip_whitespace(&lexer);
-
-            assert(lexer_parse_str_to_view(&lexer, &tilemap_image_path_view));
-            lexer_skip_whitespace(&lexer);
-
-            // TODO(gr3yknigh1): Add proper error report mechanizm. Error message in window, for example. [2025/02/24]
-            assert(lexer_check_peeked( &lexer, s_tilemap_image_bmp_format ));
-            lexer_advance(&lexer, (int32_t)s_tilemap_image_bmp_format.length);
-
-            lexer_skip_whitespace(&lexer);
-
-            assert(lexer_parse_int(&lexer, &tilemap->tile_x_pixel_count));
-            lexer_skip_whitespace(&lexer);
-
-            assert(lexer_parse_int(&lexer, &tilemap->tile_y_pixel_count));
-            lexer_skip_whitespace(&lexer);
-
-            // NOTE(gr3yknigh1): Bad assumtion [2025/02/24]
-            // assert(Lexer_IsEndline(&lexer));
-
-            // TODO(gr3yknigh1): Move initialization of index array out of here [2025/02/24]
-            // NOTE(gr3yknigh1): This can be fixed with adding stage with Token generation, like
-            // proper lexers does [2025/02/26]
-            tilemap->indexes_count = tilemap->row_count * tilemap->col_count;
-            tilemap->indexes = static_cast<int *>(mm::allocate(tilemap->indexes_count * sizeof(*tilemap->indexes)));
-
-            continue;
-        }
-
-        if (isdigit(lexer.lexeme)) {
-            assert(tilemap->indexes);
-
-            int *indexes_cursor = tilemap->indexes;
-
-            do {
-                SizeU current_index_index = indexes_cursor - tilemap->indexes;
-                assert(current_index_index + 1 <= tilemap->indexes_count);
-
-                assert(lexer_parse_int(&lexer, indexes_cursor));
-                lexer_skip_whitespace(&lexer);
-
-                ++indexes_cursor;
-            } while(isdigit(lexer.lexeme));
-
-            SizeU filled_indexes = indexes_cursor - tilemap->indexes;
-            assert(filled_indexes == tilemap->indexes_count);
-        }
-
-        lexer_advance(&lexer);
-    }
-
-    // TODO(gr3yknigh1): Factor this out [2025/02/24]
-    assert(tilemap_image_path_view.length && tilemap_image_path_view.data);
-
-    char *tilemap_image_path = (char *)mm::allocate(tilemap_image_path_view.length + 1);
-    noc_memory_zero(tilemap_image_path, tilemap_image_path_view.length + 1);
-    assert(str8_view_copy_to_nullterminated(tilemap_image_path_view, tilemap_image_path, tilemap_image_path_view.length + 1));
-
-    // TODO(gr3yknigh1): Generalize format validation [2025/02/24]
-
-    tilemap->texture_asset = asset_load(store, Asset_Type::Texture, tilemap_image_path);
-    assert(tilemap->texture_asset);
-
-    mm::deallocate(tilemap_image_path);
-
-    return tilemap;
-}
-
 bool
 path16_get_parent(const wchar_t *path, SizeU path_length, Str16_View *out)
 {
@@ -2049,11 +1569,21 @@ watch_thread_worker(PVOID param)
 {
     Watch_Context *context = (Watch_Context *)param;
 
+    //
+    // NOTE(gr3yknigh1): Directory is read with overlapped IO, so worker waits for changes and stop event at the same
+    // time, instead of blocking in `ReadDirectoryChangesW` till next change. [2026/10/17]
+    //
     HANDLE watch_dir = CreateFileW(context->target_dir,
         FILE_LIST_DIRECTORY, FILE_SHARE_DELETE | FILE_SHARE_READ | FILE_SHARE_WRITE,
-        nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+        nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
     assert(watch_dir && watch_dir != INVALID_HANDLE_VALUE);
 
+    OVERLAPPED overlapped;
+    noxx::zero_type(&overlapped);
+
+    overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+    assert(overlapped.hEvent);
+
     Int32U file_notify_info_capacity = 1024;
     FILE_NOTIFY_INFORMATION *file_notify_info = mm::allocate_structs<FILE_NOTIFY_INFORMATION>(file_notify_info_capacity, ALLOCATE_ZERO_MEMORY);
     assert(file_notify_info);
@@ -2071,11 +1601,32 @@ watch_thread_worker(PVOID param)
 
     while (!context->should_stop.test()) {
 
-        DWORD bytes_returned = 0;
-        assert(ReadDirectoryChangesW(
+        ResetEvent(overlapped.hEvent);
+
+        if (!ReadDirectoryChangesW(
             watch_dir, file_notify_info, sizeof(*file_notify_info) * file_notify_info_capacity,
-            true, FILE_NOTIFY_CHANGE_LAST_WRITE, &bytes_returned, nullptr, nullptr
-        ));
+            true, FILE_NOTIFY_CHANGE_LAST_WRITE, nullptr, &overlapped, nullptr
+        )) {
+            break;
+        }
+
+        HANDLE wait_handles[] = { overlapped.hEvent, context->stop_event };
+        DWORD wait_result = WaitForMultipleObjects(
+            static_cast<DWORD>(STATIC_ARRAY_COUNT(wait_handles)), wait_handles, FALSE, INFINITE);
+
+        DWORD bytes_returned = 0;
+
+        if (wait_result != WAIT_OBJECT_0) {
+            // NOTE(gr3yknigh1): Buffer is owned by pending read, so waiting for cancellation before freeing it. [2026/10/17]
+            CancelIoEx(watch_dir, &overlapped);
+            GetOverlappedResult(watch_dir, &overlapped, &bytes_returned, TRUE);
+            break;
+        }
+
+        // NOTE(gr3yknigh1): Zero bytes means that buffer overflowed and changes were lost. [2026/10/17]
+        if (!GetOverlappedResult(watch_dir, &overlapped, &bytes_returned, FALSE) || bytes_returned == 0) {
+            continue;
+        }
 
         FILE_NOTIFY_INFORMATION *current_notify_info = file_notify_info;
 
@@ -2121,6 +1672,9 @@ watch_thread_worker(PVOID param)
     }
 
 
+    CloseHandle(overlapped.hEvent);
+    CloseHandle(watch_dir);
+
     mm::deallocate(file_full_path_buffer);
     mm::deallocate(file_notify_info);
 }
@@ -2194,237 +1748,6 @@ unload_gameplay(Gameplay *gameplay)
     assert(FreeLibrary(gameplay->module));
 }
 
-bool
-make_asset_store_from_folder(Asset_Store *store, const char *folder_path)
-{
-    assert(store && folder_path);
-
-    noxx::zero_type(store);
-
-    store->place = Asset_Store_Place::Folder;
-    store->asset_pool = mm::make_block_allocator(Asset_Store::max_asset_count, sizeof(Asset), sizeof(Asset), Asset_Store::max_asset_count);
-    store->u.folder = folder_path;
-
-    store->asset_content = mm::make_block_allocator();
-
-    return true;
-}
-
-bool
-asset_store_destroy(Asset_Store *store)
-{
-    assert(store);
-
-    assert(mm::destroy_block_allocator(&store->asset_pool));
-    assert(mm::destroy_block_allocator(&store->asset_content));
-
-    noxx::zero_type(store);
-
-    return true;
-}
-
-Asset *
-asset_load(Asset_Store *store, Asset_Type type, const Str8_View file_path)
-{
-    // TODO(gr3yknigh1): Handle errors and mark asset as failed to load: Asset_State::LoadFailure [2025/03/10]
-
-    assert(store && !file_path.empty());
-
-    Asset *asset = mm::allocate_struct<Asset>(&store->asset_pool, ALLOCATE_ZERO_MEMORY);
-    assert(asset);
-
-    asset->type = type;
-
-    Asset_Location *location = &asset->location;
-
-    location->type          = Asset_Location_Type::File;
-    location->u.file.path   = Str8(file_path.data, file_path.length) /*asset_store_resolve_file(file)*/;
-    location->u.file.handle = fopen(location->u.file.path.data, "r");
-    assert(location->u.file.handle);
-
-    location->u.file.size   = noc_get_file_size(location->u.file.handle);
-
-    if (asset->type == Asset_Type::Texture) {
-        // NOTE(gr3yknigh1): Assume that file is path to BMP image [2025/03/10]
-        Bitmap_Picture picture;
-        assert(load_bitmap_picture_info_from_file(&picture, location->u.file.handle));
-
-        // TODO(gr3yknigh1): Allocate less data, because file_size includes size of metadata [2025/03/10]
-        //
-        picture.u.data = allocate(&store->asset_content, picture.header.file_size);
-        assert(load_bitmap_picture_pixel_data_from_file(&picture, location->u.file.handle));
-
-        assert(asset_from_bitmap_picture(asset, &picture));
-    } else if (asset->type == Asset_Type::Shader) {
-
-        asset->u.shader.source_code = static_cast<char *>(allocate(&store->asset_content, location->u.file.size));
-        noc_memory_zero(asset->u.shader.source_code, location->u.file.size);
-        fread(asset->u.shader.source_code, location->u.file.size, 1, location->u.file.handle);
-
-        Shader_Compile_Result result = compile_shader(asset->u.shader.source_code, location->u.file.size);
-        asset->u.shader.program_id = result.shader_program_id;
-        assert(asset->u.shader.program_id);
-
-        //
-        // TODO(gr3yknigh1): Delete shader modules. They are no longer needed. [2025/03/28]
-        //
-
-        #if 0
-        /* After linking shaders no longer needed. */
-        glDeleteShader(vertex_module->id);
-        glDeleteShader(fragment_module->id);
-        #endif
-    } else if (asset->type == Asset_Type::Tilemap) {
-
-        SizeU buffer_size = asset->location.u.file.size + 1;
-        void* buffer = mm::allocate(buffer_size, ALLOCATE_ZERO_MEMORY);
-
-        fread(buffer, buffer_size - 1, 1, asset->location.u.file.handle);
-
-        assert(load_tilemap_from_buffer(store, static_cast<char *>(buffer), buffer_size, &asset->u.tilemap));
-
-        mm::deallocate(buffer);
-
-    } else {
-        // TODO(gr3yknigh1): Handle an error [2025/04/06]
-    }
-
-    asset->state = Asset_State::Loaded;
-    fclose(location->u.file.handle);
-    location->u.file.handle = nullptr;  // Saying that the file handle is closed
-
-    return asset;
-}
-
-bool
-asset_reload(Asset_Store *store, Asset *asset)
-{
-    bool result = true;
-
-    assert(store && asset);
-
-    if (asset->state == Asset_State::Loaded) {
-        result = asset_unload(store, asset);
-    }
-
-    if (result && asset->location.type == Asset_Location_Type::File) {
-
-        if (result && asset->location.u.file.handle == nullptr) {
-            // TODO(gr3yknigh1): Wrap fopen in function which accepts Str8_View-s [2025/03/10]
-            asset->location.u.file.handle = fopen(asset->location.u.file.path.data, "r");
-            asset->location.u.file.size = noc_get_file_size(asset->location.u.file.handle);
-            assert(asset->location.u.file.handle);
-        }
-
-        if (asset->type == Asset_Type::Texture) {
-            Bitmap_Picture picture;
-            assert(load_bitmap_picture_info_from_file(&picture, asset->location.u.file.handle));
-
-            //
-            // TODO(gr3yknigh1): Allocate less data, because file_size includes size of metadata [2025/03/10]
-            //
-            picture.u.data = allocate(&store->asset_content, picture.header.file_size);
-            assert(load_bitmap_picture_pixel_data_from_file(&picture, asset->location.u.file.handle));
-
-            assert(asset_from_bitmap_picture(asset, &picture));
-        } else if (asset->type == Asset_Type::Shader) {
-
-            asset->u.shader.source_code = static_cast<char *>(allocate(&store->asset_content, asset->location.u.file.size));
-            noc_memory_zero(asset->u.shader.source_code, asset->location.u.file.size);
-            fread(asset->u.shader.source_code, asset->location.u.file.size, 1, asset->location.u.file.handle);
-
-            Shader_Compile_Result compile_result = compile_shader(asset->u.shader.source_code, asset->location.u.file.size);
-
-            glDeleteProgram(asset->u.shader.program_id); // @cleanup
-            asset->u.shader.program_id = compile_result.shader_program_id;
-            assert(asset->u.shader.program_id);
-        } else if (asset->type == Asset_Type::Tilemap) {
-            SizeU buffer_size = asset->location.u.file.size + 1;
-            void* buffer = mm::allocate(buffer_size);
-            noc_memory_zero(buffer, buffer_size);
-
-            fread(buffer, buffer_size - 1, 1, asset->location.u.file.handle);
-
-            assert(load_tilemap_from_buffer(store, static_cast<char *>(buffer), buffer_size, &asset->u.tilemap));
-
-            mm::deallocate(buffer);
-
-        } else {
-            result = false;
-        }
-
-        if (result && asset->location.u.file.handle != nullptr) {
-            fclose(asset->location.u.file.handle);
-            asset->location.u.file.handle = nullptr;  // Saying that the file handle is closed
-        }
-    }
-
-
-    if (result) {
-        asset->state = Asset_State::Loaded;
-    }
-    return result;
-}
-
-
-bool
-asset_from_bitmap_picture(Asset *asset, Bitmap_Picture *picture)
-{
-    //
-    // Copy image data to more generalized structure
-    //
-    asset->u.texture.width = picture->dib_header.width;
-    asset->u.texture.height = picture->dib_header.height;
-
-    asset->u.texture.layout = Color_Layout::Nothing;
-
-    if (picture->dib_header.compression_method ==  Bitmap_Picture_Compression_Method::Bitfields) {
-        asset->u.texture.layout = Color_Layout::BGRA_U8;
-    }
-
-    assert(asset->u.texture.layout != Color_Layout::Nothing);
-
-    asset->u.texture.pixels.data = picture->u.data;
-
-    return true;
-}
-
-
-bool
-asset_unload(Asset_Store *store, Asset *asset)
-{
-    assert(store && asset);
-    assert(asset->state == Asset_State::Loaded);
-
-    bool result = true;
-
-    if (asset->type == Asset_Type::Texture) {
-        result = reset(&store->asset_content, asset->u.texture.pixels.data );
-    } else if (asset->type == Asset_Type::Shader) {
-        result = reset(&store->asset_content, asset->u.shader.source_code);
-    } else if (asset->type == Asset_Type::Tilemap) {
-        Tilemap *tilemap = &asset->u.tilemap;
-
-        if (tilemap->texture_asset->state == Asset_State::Loaded) {
-            result = asset_unload(store, tilemap->texture_asset);
-        }
-
-        if (result) {
-            mm::deallocate(tilemap->indexes);
-        }
-    } else {
-        result = false;
-    }
-
-    if (result) {
-        asset->state = Asset_State::Unloaded;
-    } else {
-        asset->state = Asset_State::UnloadFailure;
-    }
-
-    return result;
-}
-
 bool make_watch_context(Watch_Context *context, void *parameter, const wchar_t *target_dir, watch_notification_routine_t notification_routine)
 {
     assert(context);
@@ -2459,6 +1782,11 @@ bool make_watch_context(Watch_Context *context, void *parameter, const wchar_t *
         target_dir = image_directory_buffer;
     }
 
+    context->stop_event = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+    if (context->stop_event == nullptr) {
+        return false;
+    }
+
     context->target_dir = target_dir;  // TODO(gr3yknigh1): Do free somewhere [2025/03/01]
     context->parameter = parameter;
     context->notification_routine = notification_routine;
@@ -2469,145 +1797,78 @@ bool make_watch_context(Watch_Context *context, void *parameter, const wchar_t *
 DWORD
 watch_context_launch_thread(Watch_Context *context, PHANDLE out_thread_handle)
 {
+    assert(context && context->thread == nullptr);
+
     DWORD watch_thread_id = 0;
     HANDLE watch_thread = CreateThread(nullptr, 0, (LPTHREAD_START_ROUTINE)watch_thread_worker, context, 0, &watch_thread_id);
     assert(watch_thread && watch_thread != INVALID_HANDLE_VALUE);
 
+    context->thread = watch_thread;
+
     if (out_thread_handle != nullptr) {
         *out_thread_handle = watch_thread;
     }
     return watch_thread_id;
 }
 
-void
-asset_watch_routine([[maybe_unused]] Watch_Context *watch_context, const Str16_View file_name, File_Action action, void *parameter)
+bool
+watch_context_stop(Watch_Context *context)
 {
-    if (action != File_Action::Modified) {
-        return;
-    }
+    assert(context);
 
-    Reload_Context *reload_context = reinterpret_cast<Reload_Context *>(parameter);
+    context->should_stop.test_and_set();
 
-    if (reload_context->store->place == Asset_Store_Place::Folder) {
-        FOR_EACH_ASSET(it, reload_context->store) {
-            if (it->location.type != Asset_Location_Type::File) {
-                continue;
-            }
+    if (!SetEvent(context->stop_event)) {
+        return false;
+    }
 
-            if (str16_view_is_equals(file_name, it->location.u.file.path)) {
-                it->should_reload.test_and_set();
-                return;
-            }
+    if (context->thread != nullptr) {
+        if (WaitForSingleObject(context->thread, INFINITE) != WAIT_OBJECT_0) {
+            return false;
         }
-    }
 
-    if (str16_view_endswith(file_name, STRINGIFY(GARDEN_GAMEPLAY_DLL_NAME))) {
-        reload_context->should_reload_gameplay.test_and_set();
+        CloseHandle(context->thread);
+        context->thread = nullptr;
     }
-}
 
-Shader_Compile_Result
-compile_shader(char *source_code, SizeU file_size)
-{
-    Lexer lexer = make_lexer(source_code, file_size);
+    CloseHandle(context->stop_event);
+    context->stop_event = nullptr;
 
-    constexpr static Str8_View s_line_comment = "//";
-    constexpr static Str8_View s_begin_directive = "#begin";
-    constexpr static Str8_View s_vertex_literal = "vertex";
-    constexpr static Str8_View s_fragment_literal = "fragment";
+    return true;
+}
 
-    Str8_View vertex_source{};
-    Str8_View fragment_source{};
+void
+asset_watch_routine([[maybe_unused]] Watch_Context *watch_context, const Str16_View file_name, File_Action action, void *parameter)
+{
+    if (action != File_Action::Modified) {
+        return;
+    }
 
-    while (!lexer_is_end(&lexer)) {
-        lexer_skip_whitespace(&lexer);
+    Reload_Context *reload_context = reinterpret_cast<Reload_Context *>(parameter);
 
-        // NOTE(gr3yknigh1): Skipping comments [2025/02/24]
-        // TODO(gr3yknigh1): Skip /**/ comments [2025/03/19]
-        if (lexer_check_peeked(&lexer, s_line_comment)) {
-            lexer_skip_until_endline(&lexer);
-            continue;
+    if (reload_context->store->place == Asset_Store_Place::Folder) {
+        //
+        // NOTE(gr3yknigh1): Asset paths are stored in UTF-8, so converting before lookup in path index. [2026/10/17]
+        //
+        char file_name_buffer[MAX_PATH * 3];
+        int file_name_length = WideCharToMultiByte(
+            CP_UTF8, 0, file_name.data, static_cast<int>(file_name.length),
+            file_name_buffer, sizeof(file_name_buffer), nullptr, nullptr);
+
+        Asset_Handle asset{};
+        if (file_name_length > 0) {
+            asset = asset_store_find(reload_context->store, Str8_View(file_name_buffer, static_cast<SizeU>(file_name_length)));
         }
 
-        if (lexer_check_peeked_and_advance(&lexer, s_begin_directive)) {
-            lexer_skip_whitespace(&lexer); // NOTE: Skipping spaces
-
-            if (lexer_check_peeked_and_advance(&lexer, s_vertex_literal)) {
-                assert(vertex_source.empty());
-                lexer_skip_whitespace(&lexer);
-
-                vertex_source = lexer_skip_until(&lexer, s_begin_directive);
-                continue;
-            }  else if (lexer_check_peeked_and_advance(&lexer, s_fragment_literal)) {
-                assert(fragment_source.empty());
-                lexer_skip_whitespace(&lexer);
-
-                fragment_source = lexer_skip_until(&lexer, s_begin_directive);
-                continue;
-            }
+        if (!asset.is_null()) {
+            asset_store_mark_dirty(reload_context->store, asset);
+            return;
         }
-
-        lexer_advance(&lexer);
     }
 
-    assert(!vertex_source.empty() && !fragment_source.empty());
-
-    // TODO(gr3yknigh1): Move to arena [2025/03/28]
-    char *vertex_source_buffer = static_cast<char *>(mm::allocate(vertex_source.length + 1));
-    noc_memory_zero(vertex_source_buffer, vertex_source.length + 1);
-    assert(str8_view_copy_to_nullterminated(vertex_source, vertex_source_buffer, vertex_source.length + 1));
-    GLuint vertex_module_id = compile_shader_from_str8(vertex_source_buffer, Shader_Module_Type::Vertex);
-    assert(vertex_module_id);
-    mm::deallocate(vertex_source_buffer);
-
-    // TODO(gr3yknigh1): Move to arena [2025/03/28]
-    char *fragment_source_buffer = static_cast<char *>(mm::allocate(fragment_source.length + 1));
-    noc_memory_zero(fragment_source_buffer, fragment_source.length + 1);
-
-    assert(str8_view_copy_to_nullterminated(fragment_source, fragment_source_buffer, fragment_source.length + 1));
-    GLuint fragment_module_id = compile_shader_from_str8(fragment_source_buffer, Shader_Module_Type::Fragment);
-    assert(fragment_module_id);
-    mm::deallocate(fragment_source_buffer);
-
-    Shader_Compile_Result result{};
-    result.shader_program_id = link_shader_program(vertex_module_id, fragment_module_id);
-
-    return result;
-}
-
-bool
-asset_image_send_to_gpu(Asset_Store *store, Asset *asset, int unit, Shader *shader)
-{
-    assert(asset->type == Asset_Type::Texture);
-
-    asset->u.texture.unit = unit;
-    glActiveTexture(GL_TEXTURE0 + asset->u.texture.unit);
-    if (asset->u.texture.id) {
-        glDeleteTextures(1, &asset->u.texture.id);
-    }
-    glGenTextures(1, &asset->u.texture.id);
-    glBindTexture(GL_TEXTURE_2D, asset->u.texture.id);
-
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_MIRRORED_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_MIRRORED_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    gl_make_texture_from_pixels(
-        asset->u.texture.pixels.data, asset->u.texture.width, asset->u.texture.height,
-        asset->u.texture.layout, GL_RGBA8);
-    glGenerateMipmap(GL_TEXTURE_2D);
-
-    // NOTE: After loading atlas in GPU, we do not need to keep it in RAM.
-    assert(asset_unload(store, asset));
-
-    if (shader) {
-        GLint texture_uniform_loc = glGetUniformLocation(shader->program_id, "u_texture");
-        assert(texture_uniform_loc != -1);
-
-        glUniform1i(texture_uniform_loc, asset->u.texture.unit);
+    if (str16_view_endswith(file_name, STRINGIFY(GARDEN_GAMEPLAY_DLL_NAME))) {
+        reload_context->should_reload_gameplay.test_and_set();
     }
-
-    return true;
 }
 
 bool
@@ -2633,3 +1894,21 @@ bind_vertex_buffer(Vertex_Buffer *buffer)
 
     return true;
 }
+
+bool
+vertex_buffer_set_indexes(Vertex_Buffer *buffer, const Int32U *indexes, SizeU indexes_count)
+{
+    assert(buffer && indexes);
+
+    glBindVertexArray(buffer->vertex_array_id);
+
+    if (buffer->index_buffer_id == 0) {
+        glGenBuffers(1, &buffer->index_buffer_id);
+    }
+
+    // NOTE(gr3yknigh1): Element buffer binding is part of vertex array state. [2026/10/17]
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer->index_buffer_id);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexes_count * sizeof(*indexes), indexes, GL_STATIC_DRAW);
+
+    return true;
+}
@@ -0,0 +1,386 @@
+//!
+//! Offline tools, which prepare assets for the runtime.
+//!
+//! Built as separate executable from the same unity build (like benchmarks), but with `GARDEN_TOOLS_CODE=1`.
+//! Run without arguments to list the tools.
+//!
+//! FILE          code\garden_tools.cpp
+//!
+//! AUTHORS
+//!               Ilya Akkuzin <gr3yknigh1@gmail.com>
+//!
+//! NOTICE        (c) Copyright 2025 by Ilya Akkuzin. All rights reserved.
+//!
+#include <assert.h> // assert
+#include <stdio.h>  // printf, fopen
+#include <stdlib.h> // strtoul, qsort
+
+#include <filesystem> // std::filesystem::recursive_directory_iterator
+
+#include <noc/noc.h>
+
+#include "garden_runtime.h"
+#include "garden_assets.h"
+
+typedef bool (* tool_routine_t)(int argc, char **argv);
+
+struct Tool {
+    const char *name;
+    const char *usage;
+    tool_routine_t routine;
+};
+
+//
+// Tilemap conversion:
+//
+
+static bool
+tool_tilemap_convert(int argc, char **argv)
+{
+    if (argc < 2) {
+        return false;
+    }
+
+    const char *input_path = argv[0];
+    const char *output_path = argv[1];
+    Int16U index_size = sizeof(Int32S);
+
+    for (int arg_index = 2; arg_index < argc; ++arg_index) {
+        if (str8_view_is_equals(argv[arg_index], "--index-size") && arg_index + 1 < argc) {
+            index_size = static_cast<Int16U>(strtoul(argv[++arg_index], nullptr, 10));
+        } else {
+            return false;
+        }
+    }
+
+    if (index_size != sizeof(Int32S) && index_size != sizeof(Int16U)) {
+        printf("E: [tilemap-convert] Index size should be 2 or 4, got (%u)\n", index_size);
+        return false;
+    }
+
+    SizeU input_size = 0;
+    char *input = static_cast<char *>(noc_native_map_file(input_path, &input_size));
+
+    if (input == nullptr) {
+        printf("E: [tilemap-convert] Failed to map file '%s'\n", input_path);
+        return false;
+    }
+
+    Tilemap tilemap{};
+    Str8_View image_path{};
+
+    bool result = parse_tilemap(input, input_size, &tilemap, &image_path);
+
+    if (result) {
+        //
+        // NOTE(gr3yknigh1): Output is written next to the target and renamed over it, so running game (which watches
+        // the folder) never reads half-written tilemap. [2026/10/17]
+        //
+        std::string temp_path = std::string(output_path) + ".tmp";
+
+        FILE *output = fopen(temp_path.c_str(), "wb");
+        result = output != nullptr && save_tilemap_binary(&tilemap, image_path, index_size, output);
+
+        if (output != nullptr) {
+            result = fclose(output) == 0 && result;
+        }
+
+        std::error_code error;
+        if (result) {
+            std::filesystem::rename(temp_path, output_path, error);
+            result = !error;
+        }
+
+        if (!result) {
+            printf("E: [tilemap-convert] Failed to write '%s'\n", output_path);
+            std::filesystem::remove(temp_path, error);
+        }
+
+        mm::deallocate(tilemap.indexes);
+    }
+
+    if (result) {
+        printf(
+            "I: [tilemap-convert] '%s' -> '%s' (%dx%d, %u byte indexes)\n", input_path, output_path, tilemap.row_count,
+            tilemap.col_count, index_size);
+    }
+
+    [[maybe_unused]] bool is_unmapped = noc_native_unmap_file(input, input_size);
+    assert(is_unmapped);
+
+    return result;
+}
+
+//
+// Asset archive packing:
+//
+
+struct Pack_Item {
+    Asset_Archive_Entry entry;
+    char *source_path; //!< Null-terminated, allocated.
+};
+
+static bool
+pack_get_asset_type(const std::filesystem::path &path, Asset_Type *type)
+{
+    std::filesystem::path extension = path.extension();
+
+    if (extension == ".bmp") {
+        *type = Asset_Type::Texture;
+    } else if (extension == ".sl") {
+        *type = Asset_Type::Shader;
+    } else if (extension == ".tp" || extension == ".tpb") {
+        *type = Asset_Type::Tilemap;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+static int
+pack_compare_items(const void *a, const void *b)
+{
+    Int64U x = static_cast<const Pack_Item *>(a)->entry.path_hash;
+    Int64U y = static_cast<const Pack_Item *>(b)->entry.path_hash;
+    return (x > y) - (x < y);
+}
+
+static bool
+pack_write_padding(FILE *file, SizeU size)
+{
+    static const Byte s_zeroes[ASSET_ARCHIVE_ALIGNMENT] = {};
+
+    while (size > 0) {
+        SizeU chunk_size = size < sizeof(s_zeroes) ? size : sizeof(s_zeroes);
+
+        if (fwrite(s_zeroes, 1, chunk_size, file) != chunk_size) {
+            return false;
+        }
+
+        size -= chunk_size;
+    }
+
+    return true;
+}
+
+//!
+//! @brief Writes the archive: header, entries, paths and page-aligned payloads. Payloads are copied from
+//! `source_path` of each item and their offsets are written into the entries.
+//!
+static bool
+pack_write_archive(FILE *file, Pack_Item *items, Int32U items_count, const char *paths, Int32U paths_size)
+{
+    Asset_Archive_Header header{};
+    header.magic = ASSET_ARCHIVE_MAGIC;
+    header.version = ASSET_ARCHIVE_VERSION;
+    header.entries_count = items_count;
+    header.paths_size = paths_size;
+    header.entries_offset = sizeof(header);
+    header.paths_offset = header.entries_offset + items_count * sizeof(Asset_Archive_Entry);
+
+    // NOTE(gr3yknigh1): Payload gets at least one zero byte after it, so text assets can be read as C strings. [2026/10/17]
+    SizeU offset = NOC_ALIGN_TO(header.paths_offset + paths_size, ASSET_ARCHIVE_ALIGNMENT);
+
+    for (Int32U item_index = 0; item_index < items_count; ++item_index) {
+        Asset_Archive_Entry *entry = &items[item_index].entry;
+        entry->offset = offset;
+        offset = NOC_ALIGN_TO(offset + entry->size + 1, ASSET_ARCHIVE_ALIGNMENT);
+    }
+
+    bool result = fwrite(&header, sizeof(header), 1, file) == 1;
+
+    for (Int32U item_index = 0; result && item_index < items_count; ++item_index) {
+        result = fwrite(&items[item_index].entry, sizeof(Asset_Archive_Entry), 1, file) == 1;
+    }
+
+    result = result && fwrite(paths, 1, paths_size, file) == paths_size;
+
+    SizeU written_size = header.paths_offset + paths_size;
+
+    for (Int32U item_index = 0; result && item_index < items_count; ++item_index) {
+        Pack_Item *item = items + item_index;
+
+        result = pack_write_padding(file, item->entry.offset - written_size);
+
+        SizeU payload_size = 0;
+        void *payload = item->entry.size > 0 ? noc_native_map_file(item->source_path, &payload_size) : nullptr;
+
+        if (item->entry.size > 0) {
+            result = result && payload != nullptr && payload_size == item->entry.size &&
+                     fwrite(payload, 1, payload_size, file) == payload_size;
+        }
+
+        if (payload != nullptr) {
+            [[maybe_unused]] bool is_unmapped = noc_native_unmap_file(payload, payload_size);
+            assert(is_unmapped);
+        }
+
+        written_size = item->entry.offset + item->entry.size;
+    }
+
+    return result && pack_write_padding(file, offset - written_size);
+}
+
+static bool
+tool_pack(int argc, char **argv)
+{
+    if (argc != 2) {
+        return false;
+    }
+
+    const char *folder_path = argv[0];
+    const char *output_path = argv[1];
+
+    constexpr Int32U max_items_count = Asset_Store::max_asset_count;
+    constexpr Int32U max_paths_size = max_items_count * 256;
+
+    Pack_Item *items = mm::allocate_structs<Pack_Item>(max_items_count, ALLOCATE_ZERO_MEMORY);
+    char *paths = static_cast<char *>(mm::allocate(max_paths_size));
+    assert(items && paths);
+
+    Int32U items_count = 0;
+    Int32U paths_size = 0;
+
+    bool result = true;
+
+    std::error_code error;
+    std::filesystem::recursive_directory_iterator iterator(folder_path, error);
+
+    if (error) {
+        printf("E: [pack] Failed to open folder '%s'\n", folder_path);
+        result = false;
+    }
+
+    for (; result && iterator != std::filesystem::recursive_directory_iterator(); iterator.increment(error)) {
+        Asset_Type type;
+
+        if (!iterator->is_regular_file() || !pack_get_asset_type(iterator->path(), &type)) {
+            continue;
+        }
+
+        std::string source_path = iterator->path().string();
+        std::string relative_path = iterator->path().lexically_relative(folder_path).generic_string();
+
+        if (items_count == max_items_count || paths_size + relative_path.size() > max_paths_size) {
+            printf("E: [pack] Too many assets in '%s'\n", folder_path);
+            result = false;
+            break;
+        }
+
+        Pack_Item *item = items + items_count++;
+
+        item->source_path = static_cast<char *>(mm::allocate(source_path.size() + 1));
+        noc_memory_copy(item->source_path, source_path.c_str(), source_path.size() + 1);
+
+        noc_memory_copy(paths + paths_size, relative_path.data(), relative_path.size());
+
+        Str8_View path(paths + paths_size, relative_path.size());
+        item->entry.path_hash = asset_archive_hash_path(path);
+        item->entry.path_offset = paths_size;
+        item->entry.path_length = static_cast<Int32U>(path.length);
+        item->entry.type = static_cast<Int32U>(type);
+
+        paths_size += static_cast<Int32U>(path.length);
+
+        SizeU payload_size = 0;
+        void *payload = noc_native_map_file(item->source_path, &payload_size);
+
+        //
+        // NOTE(gr3yknigh1): Empty files can't be mapped. [2026/10/17]
+        //
+        if (payload == nullptr && iterator->file_size(error) != 0) {
+            printf("E: [pack] Failed to map file '%s'\n", item->source_path);
+            result = false;
+            break;
+        }
+
+        item->entry.size = payload_size;
+        item->entry.content_hash = str8_view_hash(Str8_View(static_cast<const char *>(payload), payload_size));
+
+        if (payload != nullptr) {
+            [[maybe_unused]] bool is_unmapped = noc_native_unmap_file(payload, payload_size);
+            assert(is_unmapped);
+        }
+    }
+
+    if (result && error) {
+        printf("E: [pack] Failed to walk folder '%s'\n", folder_path);
+        result = false;
+    }
+
+    if (result) {
+        qsort(items, items_count, sizeof(*items), pack_compare_items);
+
+        for (Int32U item_index = 1; result && item_index < items_count; ++item_index) {
+            if (items[item_index - 1].entry.path_hash == items[item_index].entry.path_hash) {
+                printf(
+                    "E: [pack] Path hash collision: '%s' and '%s'\n", items[item_index - 1].source_path,
+                    items[item_index].source_path);
+                result = false;
+            }
+        }
+    }
+
+    if (result) {
+        FILE *output = fopen(output_path, "wb");
+        result = output != nullptr && pack_write_archive(output, items, items_count, paths, paths_size);
+
+        if (output != nullptr) {
+            result = fclose(output) == 0 && result;
+        }
+
+        if (!result) {
+            printf("E: [pack] Failed to write '%s'\n", output_path);
+        }
+    }
+
+    if (result) {
+        for (Int32U item_index = 0; item_index < items_count; ++item_index) {
+            const Asset_Archive_Entry *entry = &items[item_index].entry;
+            printf(
+                "I: [pack] %.*s (%llu bytes, offset %llu)\n", static_cast<int>(entry->path_length), paths + entry->path_offset,
+                static_cast<unsigned long long>(entry->size), static_cast<unsigned long long>(entry->offset));
+        }
+
+        printf("I: [pack] '%s' -> '%s' (%u assets)\n", folder_path, output_path, items_count);
+    }
+
+    for (Int32U item_index = 0; item_index < items_count; ++item_index) {
+        mm::deallocate(items[item_index].source_path);
+    }
+
+    mm::deallocate(items);
+    mm::deallocate(paths);
+
+    return result;
+}
+
+static Tool tools[] = {
+    { "tilemap-convert", "<input.tp> <output.tpb> [--index-size 2|4]", tool_tilemap_convert },
+    { "pack",            "<assets-folder> <output.gpak>",             tool_pack },
+};
+
+int
+main(int argc, char **argv)
+{
+    for (SizeU tool_index = 0; argc > 1 && tool_index < STATIC_ARRAY_COUNT(tools); ++tool_index) {
+        Tool *tool = tools + tool_index;
+
+        if (str8_view_is_equals(argv[1], tool->name)) {
+            if (tool->routine(argc - 2, argv + 2)) {
+                return 0;
+            }
+
+            printf("usage: %s %s %s\n", argv[0], tool->name, tool->usage);
+            return 1;
+        }
+    }
+
+    puts("Tools:");
+    for (SizeU tool_index = 0; tool_index < STATIC_ARRAY_COUNT(tools); ++tool_index) {
+        printf("    %s %s\n", tools[tool_index].name, tools[tool_index].usage);
+    }
+
+    return argc > 1;
+}
@@ -0,0 +1,337 @@
+//
+// FILE          noc/benchmarks/benchmark_memory.c
+//
+// Compares `noc_memory_set`, `noc_memory_zero`, `noc_memory_copy` and `noc_memory_find` (on each supported SIMD
+// level) against libc, on sizes from 16 bytes to 64 MiB. Before measuring, result of each routine (and the rest of
+// `noc_memory_find_*` family) is checked against libc or naive implementation on misaligned buffers.
+//
+// AUTHORS
+//               Ilya Akkuzin <gr3yknigh1@gmail.com>
+//
+// NOTICE        (c) Copyright 2025 by Ilya Akkuzin. All rights reserved.
+//
+
+#include <noc/memory.h>
+#include <noc/detect.h>
+
+#include <stdio.h>  // printf
+#include <stdlib.h> // exit
+#include <string.h> // memset, memcpy, memcmp
+
+#if NOC_DETECT_PLATFORM_WINDOWS
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <time.h>
+#endif
+
+#define BENCHMARK_MIN_SIZE 16
+#define BENCHMARK_MAX_SIZE MEGABYTES(64)
+
+//
+// NOTE(gr3yknigh1): Each size is repeated until this amount of bytes is processed, so small sizes are not dominated
+// by timer resolution. [2026/10/17]
+//
+#define BENCHMARK_BYTES_PER_SIZE MEGABYTES(512)
+
+//
+// NOTE(gr3yknigh1): Buffers are allocated with the same alignment, so source is shifted by few cache lines to avoid
+// 4K aliasing between loads and stores, which would make copy look slower than it is. [2026/10/17]
+//
+#define BENCHMARK_SOURCE_OFFSET 192
+
+typedef enum Benchmark_Operation {
+    BENCHMARK_OPERATION_SET,
+    BENCHMARK_OPERATION_ZERO,
+    BENCHMARK_OPERATION_COPY,
+    BENCHMARK_OPERATION_FIND,
+} Benchmark_Operation;
+
+static const char *BENCHMARK_OPERATION_NAMES[] = { "set", "zero", "copy", "find" };
+static const char *BENCHMARK_LEVEL_NAMES[] = { "scalar", "sse2", "avx2" };
+
+//
+// NOTE(gr3yknigh1): Called through volatile pointers, otherwise compiler can drop or inline libc calls, which
+// results are not used. [2026/10/17]
+//
+static void *(*volatile libc_memset)(void *, int, size_t) = memset;
+static void *(*volatile libc_memcpy)(void *, const void *, size_t) = memcpy;
+static void *(*volatile libc_memchr)(const void *, int, size_t) = memchr;
+
+static Int64U
+benchmark_get_time_ns(void)
+{
+#if NOC_DETECT_PLATFORM_WINDOWS
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (Int64U)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (Int64U)now.tv_sec * 1000000000ULL + (Int64U)now.tv_nsec;
+#endif
+}
+
+static void
+benchmark_run_operation(Benchmark_Operation operation, bool use_libc, Byte *destination, const Byte *source, SizeU size)
+{
+    switch (operation) {
+    case BENCHMARK_OPERATION_SET:
+        if (use_libc) libc_memset(destination, 0x5A, size); else noc_memory_set(destination, size, 0x5A);
+        break;
+    case BENCHMARK_OPERATION_ZERO:
+        if (use_libc) libc_memset(destination, 0, size); else noc_memory_zero(destination, size);
+        break;
+    case BENCHMARK_OPERATION_COPY:
+        if (use_libc) libc_memcpy(destination, source, size); else noc_memory_copy(destination, source, size);
+        break;
+    case BENCHMARK_OPERATION_FIND:
+        // NOTE(gr3yknigh1): Destination is filled with zeroes, so the whole buffer is scanned. [2026/10/17]
+        if (use_libc) libc_memchr(destination, 0xFF, size); else noc_memory_find(destination, size, 0xFF);
+        break;
+    }
+}
+
+//
+// NOTE(gr3yknigh1): Checks every size up to 1024 and some big ones, with all combinations of small misalignment.
+// Bytes around destination should stay untouched. [2026/10/17]
+//
+static const Byte *
+benchmark_reference_find_last(const Byte *buffer, SizeU size, Byte value)
+{
+    for (SizeU i = size; i > 0; --i) {
+        if (buffer[i - 1] == value) {
+            return buffer + i - 1;
+        }
+    }
+    return NULL;
+}
+
+static const Byte *
+benchmark_reference_find_any(const Byte *buffer, SizeU size, const Byte *values, SizeU values_count)
+{
+    for (SizeU i = 0; i < size; ++i) {
+        for (SizeU value_index = 0; value_index < values_count; ++value_index) {
+            if (buffer[i] == values[value_index]) {
+                return buffer + i;
+            }
+        }
+    }
+    return NULL;
+}
+
+static const Byte *
+benchmark_reference_find_substring(const Byte *haystack, SizeU haystack_size, const Byte *needle, SizeU needle_size)
+{
+    for (SizeU i = 0; i + needle_size <= haystack_size; ++i) {
+        if (memcmp(haystack + i, needle, needle_size) == 0) {
+            return haystack + i;
+        }
+    }
+    return NULL;
+}
+
+static void
+benchmark_verify_find_fail(const char *name, SizeU size, SizeU offset, const void *result, const void *expected)
+{
+    printf("E: Verification failed: operation = (%s) level = (%s) size = (%lu) offset = (%lu) result = (%p) expected = (%p)\n",
+        name, BENCHMARK_LEVEL_NAMES[noc_memory_get_simd_level()], (unsigned long)size, (unsigned long)offset, result, expected);
+    exit(1);
+}
+
+//
+// NOTE(gr3yknigh1): Buffer is filled with small alphabet, so matches (and partial matches of substrings) happen
+// often. Values outside of the buffer are set to searched ones, to catch reads which are not masked out. [2026/10/17]
+//
+static void
+benchmark_verify_find(Byte *buffer)
+{
+    Int64U seed = 0x2545F4914F6CDD1DULL;
+
+    for (SizeU size = 0; size < 300; ++size) {
+        for (SizeU offset = 0; offset < 64; offset += 7) {
+            libc_memset(buffer, 'a', offset);
+            libc_memset(buffer + offset + size, 'a', 64);
+
+            for (SizeU index = 0; index < size; ++index) {
+                seed ^= seed << 13;
+                seed ^= seed >> 7;
+                seed ^= seed << 17;
+                buffer[offset + index] = (Byte)('a' + seed % (size < 64 ? 4 : 12));
+            }
+
+            const Byte *data = buffer + offset;
+
+            for (Byte value = 'a'; value < 'a' + 5; ++value) {
+                const void *expected = size ? memchr(data, value, size) : NULL;
+                const void *result = noc_memory_find(data, size, value);
+                if (result != expected) {
+                    benchmark_verify_find_fail("find", size, offset, result, expected);
+                }
+
+                expected = benchmark_reference_find_last(data, size, value);
+                result = noc_memory_find_last(data, size, value);
+                if (result != expected) {
+                    benchmark_verify_find_fail("find_last", size, offset, result, expected);
+                }
+            }
+
+            static const Byte values[] = { 'l', 'k', 'j', 'i', 'h', 'g', 'f', 'e', 'd', 'c', 'b', 'a', 'z', 'y', 'x', 'w', 'v', 'u' };
+            for (SizeU values_count = 1; values_count <= sizeof(values); values_count += 3) {
+                const void *expected = benchmark_reference_find_any(data, size, values + sizeof(values) - values_count, values_count);
+                const void *result = noc_memory_find_any(data, size, values + sizeof(values) - values_count, values_count);
+                if (result != expected) {
+                    benchmark_verify_find_fail("find_any", size, offset, result, expected);
+                }
+            }
+
+            for (SizeU needle_size = 0; needle_size < 40 && needle_size <= size + 1; needle_size += 3) {
+                // NOTE(gr3yknigh1): Needle is taken from the end of the data, so it's always found (at least there). [2026/10/17]
+                const Byte *needle = needle_size <= size ? data + size - needle_size : (const Byte *)"abcdabcdabcdabcdabcdabcdabcdabcdabcdabcdabcd";
+
+                const void *expected = benchmark_reference_find_substring(data, size, needle, needle_size);
+                const void *result = noc_memory_find_substring(data, size, needle, needle_size);
+                if (result != expected) {
+                    benchmark_verify_find_fail("find_substring", size, offset, result, expected);
+                }
+            }
+        }
+    }
+}
+
+static void
+benchmark_verify(Benchmark_Operation operation, Byte *destination, Byte *expected, const Byte *source)
+{
+    SizeU sizes[1024 + 4];
+    SizeU sizes_count = 0;
+
+    for (SizeU size = 0; size < 1024; ++size) {
+        sizes[sizes_count++] = size;
+    }
+
+    sizes[sizes_count++] = KILOBYTES(64) + 7;
+    sizes[sizes_count++] = MEGABYTES(1) + 33;
+    sizes[sizes_count++] = NOC_MEMORY_NON_TEMPORAL_THRESHOLD + 65;
+    sizes[sizes_count++] = NOC_MEMORY_NON_TEMPORAL_THRESHOLD * 2 + 1;
+
+    for (SizeU size_index = 0; size_index < sizes_count; ++size_index) {
+        SizeU size = sizes[size_index];
+
+        for (SizeU destination_offset = 0; destination_offset < 33; destination_offset += 3) {
+            for (SizeU source_offset = 0; source_offset < 33; source_offset += 5) {
+                SizeU checked_size = size + destination_offset + 64;
+
+                libc_memset(destination, 0xCC, checked_size);
+                libc_memset(expected, 0xCC, checked_size);
+
+                benchmark_run_operation(operation, false, destination + destination_offset, source + source_offset, size);
+                benchmark_run_operation(operation, true, expected + destination_offset, source + source_offset, size);
+
+                if (memcmp(destination, expected, checked_size) != 0) {
+                    printf("E: Verification failed: operation = (%s) level = (%s) size = (%lu) destination_offset = (%lu) source_offset = (%lu)\n",
+                        BENCHMARK_OPERATION_NAMES[operation], BENCHMARK_LEVEL_NAMES[noc_memory_get_simd_level()],
+                        (unsigned long)size, (unsigned long)destination_offset, (unsigned long)source_offset);
+                    exit(1);
+                }
+
+                if (operation != BENCHMARK_OPERATION_COPY) {
+                    break; // NOTE(gr3yknigh1): Source is not used. [2026/10/17]
+                }
+            }
+
+            if (size > KILOBYTES(64) && destination_offset > 0) {
+                break;
+            }
+        }
+    }
+}
+
+static double
+benchmark_measure(Benchmark_Operation operation, bool use_libc, Byte *destination, const Byte *source, SizeU size)
+{
+    SizeU iterations_count = BENCHMARK_BYTES_PER_SIZE / size;
+    if (iterations_count < 4) {
+        iterations_count = 4;
+    }
+
+    benchmark_run_operation(operation, use_libc, destination, source, size); // NOTE(gr3yknigh1): Warm up. [2026/10/17]
+
+    Int64U begin = benchmark_get_time_ns();
+    for (SizeU iteration_index = 0; iteration_index < iterations_count; ++iteration_index) {
+        benchmark_run_operation(operation, use_libc, destination, source, size);
+    }
+    Int64U elapsed = benchmark_get_time_ns() - begin;
+
+    return (double)size * (double)iterations_count / (double)elapsed; // NOTE(gr3yknigh1): Bytes per ns is GB/s. [2026/10/17]
+}
+
+int
+main(int argc, char **argv)
+{
+    bool verify_only = argc > 1 && strcmp(argv[1], "--verify") == 0;
+
+    SizeU buffer_size = BENCHMARK_MAX_SIZE + 4096;
+
+    Byte *destination = (Byte *)noc_allocate(buffer_size);
+    Byte *expected = (Byte *)noc_allocate(buffer_size);
+    Byte *source = (Byte *)noc_allocate(buffer_size);
+
+    if (!destination || !expected || !source) {
+        printf("E: Failed to allocate buffers\n");
+        return 1;
+    }
+
+    for (SizeU index = 0; index < buffer_size; ++index) {
+        source[index] = (Byte)(index * 31 + 7);
+    }
+
+    NOC_Memory_SIMD_Level supported_level = noc_memory_get_simd_level();
+
+    for (Int32S level = NOC_MEMORY_SIMD_LEVEL_NONE; level <= (Int32S)supported_level; ++level) {
+        noc_memory_set_simd_level((NOC_Memory_SIMD_Level)level);
+
+        for (Int32S operation = 0; operation <= BENCHMARK_OPERATION_COPY; ++operation) {
+            benchmark_verify((Benchmark_Operation)operation, destination, expected, source);
+        }
+
+        benchmark_verify_find(destination);
+    }
+
+    printf("I: Verified levels up to (%s)\n", BENCHMARK_LEVEL_NAMES[supported_level]);
+
+    if (verify_only) {
+        return 0;
+    }
+
+    printf("I: Throughput in GB/s\n");
+    printf("operation,size,libc");
+    for (Int32S level = NOC_MEMORY_SIMD_LEVEL_NONE; level <= (Int32S)supported_level; ++level) {
+        printf(",%s", BENCHMARK_LEVEL_NAMES[level]);
+    }
+    printf("\n");
+
+    libc_memset(destination, 0, buffer_size);
+
+    for (Int32S operation = 0; operation <= BENCHMARK_OPERATION_FIND; ++operation) {
+        for (SizeU size = BENCHMARK_MIN_SIZE; size <= BENCHMARK_MAX_SIZE; size *= 2) {
+            printf("%s,%lu,%.2f", BENCHMARK_OPERATION_NAMES[operation], (unsigned long)size,
+                benchmark_measure((Benchmark_Operation)operation, true, destination, source + BENCHMARK_SOURCE_OFFSET, size));
+
+            for (Int32S level = NOC_MEMORY_SIMD_LEVEL_NONE; level <= (Int32S)supported_level; ++level) {
+                noc_memory_set_simd_level((NOC_Memory_SIMD_Level)level);
+                printf(",%.2f", benchmark_measure((Benchmark_Operation)operation, false, destination, source + BENCHMARK_SOURCE_OFFSET, size));
+            }
+
+            printf("\n");
+        }
+    }
+
+    noc_memory_set_simd_level(supported_level);
+
+    noc_free(destination);
+    noc_free(expected);
+    noc_free(source);
+
+    return 0;
+}
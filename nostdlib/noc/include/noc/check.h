@@ -196,6 +196,7 @@ NOC_TestSuiteExecute(NOC_TestSuite *suite)
 void
 NOC_TestSuiteDestroy(NOC_TestSuite *suite) // XXX
 {
+    (void)suite;
 }
 
 #if !defined(NOC_STRINGIFY)
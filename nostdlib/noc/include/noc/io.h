@@ -24,5 +24,47 @@ NOC_DEFINE bool noc_buf_writer_write_char8(NOC_Buf_Writer *writer, Char8 c);
 NOC_DEFINE bool noc_buf_writer_write_str8z(NOC_Buf_Writer *writer, Str8Z s);
 NOC_DEFINE bool noc_buf_writer_write_str8_view(NOC_Buf_Writer *writer, NOC_Str8_View sv);
 
+//
+// Batched file I/O:
+//
+// NOTE(gr3yknigh1): Whole batch is handed to the OS at once and call returns when every request of the batch is done,
+// so hundreds of files take a few submissions instead of hundreds of serial syscalls. Queue isn't thread-safe: use
+// one queue per thread. [2026/10/17]
+//
+
+typedef enum NOC_IO_Backend {
+    NOC_IO_BACKEND_DEFAULT,  // Best available.
+    NOC_IO_BACKEND_THREADS,  // Blocking calls on the pool of threads.
+    NOC_IO_BACKEND_IO_URING, // Linux only.
+} NOC_IO_Backend;
+
+typedef struct NOC_IO_Request {
+    Str8Z path;
+
+    // NOTE(gr3yknigh1): Destination of `noc_io_read_files`. Ignored by `noc_io_get_file_sizes`. [2026/10/17]
+    Byte *buffer;
+    SizeU capacity;
+
+    SizeU size;   // File size or count of read bytes.
+    Int32S error; // Zero on success, native error code otherwise.
+} NOC_IO_Request;
+
+typedef struct NOC_IO_Queue NOC_IO_Queue;
+
+//
+// NOTE(gr3yknigh1): If requested backend isn't available (io_uring can be disabled by kernel or seccomp), queue
+// falls back to the threads. [2026/10/17]
+//
+NOC_DEFINE NOC_NODISCARD NOC_IO_Queue *noc_io_queue_make(NOC_IO_Backend backend);
+NOC_DEFINE void noc_io_queue_destroy(NOC_IO_Queue *queue);
+NOC_DEFINE NOC_IO_Backend noc_io_queue_get_backend(const NOC_IO_Queue *queue);
+
+//
+// NOTE(gr3yknigh1): Both return true if every request succeeded. Read fills at most `capacity` bytes from the start of
+// the file. [2026/10/17]
+//
+NOC_DEFINE bool noc_io_get_file_sizes(NOC_IO_Queue *queue, NOC_IO_Request *requests, SizeU count);
+NOC_DEFINE bool noc_io_read_files(NOC_IO_Queue *queue, NOC_IO_Request *requests, SizeU count);
+
 
 #endif // NOC_IO_H_INCLUDED
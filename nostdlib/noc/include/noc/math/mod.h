@@ -7,7 +7,7 @@
 #include <noc/types.h>
 
 // #define _NOC_MOD_NAME(__TYPE) noc_##__TYPE##_mod
-// #define _NOC_MOD_DEF(__TYPE) \
+// #define _NOC_MOD_DEF(__TYPE)
 //     __TYPE _NOC_MOD_NAME(__TYPE)(__TYPE x, __TYPE * out_ipart)
 
 #define NOC_MOD(__X, __OUT_IPART_PTR)                                          \
@@ -19,6 +19,29 @@ NOC_DEFINE void *noc_allocate(SizeU size);
 
 NOC_DEFINE void noc_free(void *p);
 
+///
+/// @brief Sizes starting from this are written with non-temporal stores (bypassing cache), because such buffer
+/// wouldn't fit into cache anyway.
+///
+#define NOC_MEMORY_NON_TEMPORAL_THRESHOLD MEGABYTES(16)
+
+typedef enum NOC_Memory_SIMD_Level {
+    NOC_MEMORY_SIMD_LEVEL_NONE = 0,
+    NOC_MEMORY_SIMD_LEVEL_SSE2 = 1,
+    NOC_MEMORY_SIMD_LEVEL_AVX2 = 2,
+} NOC_Memory_SIMD_Level;
+
+///
+/// @brief Returns instruction set which is used by `noc_memory_*` routines. Detected on first call.
+///
+NOC_DEFINE NOC_Memory_SIMD_Level noc_memory_get_simd_level(void);
+
+///
+/// @brief Forces `noc_memory_*` routines to use specified instruction set (for benchmarks and tests).
+/// @returns Level which will be used, it's never higher than CPU supports.
+///
+NOC_DEFINE NOC_Memory_SIMD_Level noc_memory_set_simd_level(NOC_Memory_SIMD_Level level);
+
 ///
 /// @brief Sets the buffer to zero.
 /// @param buffer Buffer to make zero.
@@ -43,13 +66,42 @@ NOC_DEFINE void noc_memory_set(void *buffer, SizeU size, Byte value);
 NOC_DEFINE void noc_memory_copy(void *destination, const void *source, SizeU size);
 
 ///
-/// @breaf Finds and returns a pointer to first byte with specified value in buffer.
+/// @brief Checks if two buffers of the same size have equal contents (like `memcmp(a, b, size) == 0`).
+///
+NOC_DEFINE bool noc_memory_is_equals(const void *a, const void *b, SizeU size);
+
+///
+/// @brief Finds and returns a pointer to first byte with specified value in buffer.
 /// @param buffer Buffer in which it should search value.
 /// @param size Size of buffer.
 /// @param value Value which should be find.
+/// @returns Pointer to the found byte or NULL.
 ///
 NOC_DEFINE const void *noc_memory_find(const void *buffer, SizeU size, Byte value);
 
+///
+/// @brief Same as `noc_memory_find`, but returns pointer to the last byte with specified value.
+///
+NOC_DEFINE const void *noc_memory_find_last(const void *buffer, SizeU size, Byte value);
+
+///
+/// @brief Up to this count of values `noc_memory_find_any` compares each of them with whole vector, bigger sets are
+/// searched with lookup table, one byte at a time.
+///
+#define NOC_MEMORY_FIND_ANY_SIMD_LIMIT 16
+
+///
+/// @brief Finds first byte which is equal to any of `values`.
+/// @returns Pointer to the found byte or NULL.
+///
+NOC_DEFINE const void *noc_memory_find_any(const void *buffer, SizeU size, const Byte *values, SizeU values_count);
+
+///
+/// @brief Finds first occurrence of `needle` in `haystack` (like `memmem`).
+/// @returns Pointer to the start of occurrence or NULL. Empty needle is found at start of haystack.
+///
+NOC_DEFINE const void *noc_memory_find_substring(const void *haystack, SizeU haystack_size, const void *needle, SizeU needle_size);
+
 ///
 /// @breaf Aligns specified size to page size of platform.
 /// @param size Size which should be aligned.
@@ -66,9 +118,9 @@ typedef struct NOC_Arena {
 #define NOC_ARENA_HAS_SPACE_FOR(ARENAPTR, SIZE)			\
     ((ARENAPTR)->occupied + (SIZE) <= (ARENAPTR)->capacity)
 
-NOC_NODISCARD NOC_DEFINE NOC_Arena noc_make_arena(SizeU size);
+NOC_DEFINE NOC_NODISCARD NOC_Arena noc_make_arena(SizeU size);
 NOC_DEFINE               void      noc_destroy_arena(NOC_Arena *arena);
-NOC_NODISCARD NOC_DEFINE void *    noc_arena_alloc(NOC_Arena *arena, SizeU size);
+NOC_DEFINE NOC_NODISCARD void *    noc_arena_alloc(NOC_Arena *arena, SizeU size);
 
 
 #if defined(NOC_DETECT_LANGUAGE_CXX)
@@ -9,6 +9,22 @@ NOC_DEFINE SizeU noc_get_page_size(void);
 NOC_DEFINE NOC_NODISCARD void *noc_native_allocate(SizeU size);
 NOC_DEFINE NOC_NODISCARD bool  noc_native_free    (void *data, SizeU size);
 
+//
+// NOTE(gr3yknigh1): Reserved range takes only address space. Pages should be committed before access and can be
+// decommitted to give physical memory back, without releasing the range. Release it with `noc_native_free`.
+// [2026/10/17]
+//
+NOC_DEFINE NOC_NODISCARD void *noc_native_reserve (SizeU size);
+NOC_DEFINE NOC_NODISCARD bool  noc_native_commit  (void *data, SizeU size);
+NOC_DEFINE NOC_NODISCARD bool  noc_native_decommit(void *data, SizeU size);
+
+//
+// NOTE(gr3yknigh1): Whole file is mapped as private copy-on-write pages: writes go to the process's own copy and
+// never reach the file. Returns NULL if file can't be opened or it's empty. [2026/10/17]
+//
+NOC_DEFINE NOC_NODISCARD void *noc_native_map_file  (Str8Z path, SizeU *size);
+NOC_DEFINE NOC_NODISCARD bool  noc_native_unmap_file(void *data, SizeU size);
+
 
 NOC_DEFINE NOC_NORETURN void noc_exit_process(Int32S exit_code);
 
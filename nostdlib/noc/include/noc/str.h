@@ -10,8 +10,22 @@ NOC_DEFINE SizeU noc_str8z_copy(Char8 *destination, Str8Z source);
 
 NOC_DEFINE SizeU noc_str8z_length(Str8Z s);
 
+//
+// NOTE(gr3yknigh1): Wide strings are taken by width of code unit (not by `Char16`), because `wchar_t` is 16 bits on
+// Windows and 32 bits on Linux. [2026/10/17]
+//
+NOC_DEFINE SizeU noc_str16z_length(const Int16U *s);
+NOC_DEFINE SizeU noc_str32z_length(const Int32U *s);
+
 NOC_DEFINE bool  noc_str8z_is_equals(const Char8 *const a, const Char8 *const b);
 
+///
+/// @brief Compares wide string with narrow one, code unit by code unit (each byte of `b` is widened with zeroes).
+/// @param length Count of code units in both strings.
+///
+NOC_DEFINE bool  noc_str16_is_equals_str8(const Int16U *a, const Char8 *b, SizeU length);
+NOC_DEFINE bool  noc_str32_is_equals_str8(const Int32U *a, const Char8 *b, SizeU length);
+
 NOC_DEFINE void *noc_str8z_insert(Str8Z dst, const Str8Z src, SizeU at);
 
 NOC_DEFINE void  noc_str8z_to_upper(Char8 *s);
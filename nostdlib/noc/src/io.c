@@ -100,3 +100,16 @@ noc_buf_writer_write_char8(NOC_Buf_Writer *writer, Char8 c)
 
     return true;
 }
+
+#if NOC_DETECT_PLATFORM_WINDOWS
+
+    #include "io_win32.c"
+
+#endif
+
+
+#if NOC_DETECT_PLATFORM_LINUX
+
+    #include "io_linux.c"
+
+#endif
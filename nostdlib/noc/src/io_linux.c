@@ -0,0 +1,639 @@
+#include <errno.h>       // errno
+#include <fcntl.h>       // open, AT_FDCWD
+#include <pthread.h>     // pthread_create, pthread_mutex_lock, pthread_cond_wait
+#include <sys/mman.h>    // mmap, munmap
+#include <sys/stat.h>    // stat, statx
+#include <sys/syscall.h> // __NR_io_uring_setup, __NR_io_uring_enter, __NR_io_uring_register
+#include <unistd.h>      // syscall, read, close
+
+#include <linux/io_uring.h>
+#include <linux/stat.h> // struct statx, STATX_SIZE
+
+#include "noc/noc.h"
+
+#define NOC_IO_THREADS_COUNT 4
+#define NOC_IO_URING_ENTRIES 256
+
+// NOTE(gr3yknigh1): Linux transfers at most this much bytes with single read. [2026/10/17]
+#define NOC_IO_MAX_READ_SIZE 0x7FFFF000
+
+typedef enum NOC_IO_Operation {
+    NOC_IO_OPERATION_GET_SIZE,
+    NOC_IO_OPERATION_READ,
+} NOC_IO_Operation;
+
+struct NOC_IO_Queue {
+    NOC_IO_Backend backend;
+
+    //
+    // io_uring:
+    //
+    int ring_descriptor;
+
+    void *sq_ring;
+    SizeU sq_ring_size;
+    void *cq_ring;
+    SizeU cq_ring_size;
+
+    struct io_uring_sqe *sqes;
+    SizeU sqes_size;
+
+    unsigned *sq_head;
+    unsigned *sq_tail;
+    unsigned *sq_mask;
+    unsigned *sq_array;
+    unsigned sq_entries;
+
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned *cq_mask;
+    struct io_uring_cqe *cqes;
+
+    struct statx statx_buffers[NOC_IO_URING_ENTRIES];
+    Int32S descriptors[NOC_IO_URING_ENTRIES];
+
+    // NOTE(gr3yknigh1): Number of current submission, it's stored in upper half of `user_data`. [2026/10/17]
+    unsigned batch_index;
+
+    //
+    // Threads:
+    //
+    pthread_t threads[NOC_IO_THREADS_COUNT];
+    pthread_mutex_t mutex;
+    pthread_cond_t work_condition;
+    pthread_cond_t done_condition;
+
+    NOC_IO_Operation operation;
+    NOC_IO_Request *requests;
+    SizeU requests_count;
+    SizeU next_index;
+    SizeU done_count;
+    SizeU threads_count;
+    bool is_stopping;
+};
+
+//
+// Blocking operations (threads backend):
+//
+
+static void
+noc_io_get_file_size_blocking(NOC_IO_Request *request)
+{
+    struct stat status;
+
+    if (stat(request->path, &status) != 0) {
+        request->error = errno;
+        return;
+    }
+
+    request->size = (SizeU)status.st_size;
+}
+
+static void
+noc_io_read_file_blocking(NOC_IO_Request *request)
+{
+    int descriptor = open(request->path, O_RDONLY | O_CLOEXEC);
+
+    if (descriptor < 0) {
+        request->error = errno;
+        return;
+    }
+
+    while (request->size < request->capacity) {
+        SizeU size = request->capacity - request->size;
+        ssize_t result = read(descriptor, request->buffer + request->size, size < NOC_IO_MAX_READ_SIZE ? size : NOC_IO_MAX_READ_SIZE);
+
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+
+        if (result < 0) {
+            request->error = errno;
+            break;
+        }
+
+        if (result == 0) {
+            break;
+        }
+
+        request->size += (SizeU)result;
+    }
+
+    close(descriptor);
+}
+
+static void *
+noc_io_thread_worker(void *parameter)
+{
+    NOC_IO_Queue *queue = (NOC_IO_Queue *)parameter;
+
+    pthread_mutex_lock(&queue->mutex);
+
+    for (;;) {
+        while (!queue->is_stopping && queue->next_index == queue->requests_count) {
+            pthread_cond_wait(&queue->work_condition, &queue->mutex);
+        }
+
+        if (queue->is_stopping) {
+            break;
+        }
+
+        NOC_IO_Request *request = queue->requests + queue->next_index++;
+        NOC_IO_Operation operation = queue->operation;
+
+        pthread_mutex_unlock(&queue->mutex);
+
+        if (operation == NOC_IO_OPERATION_GET_SIZE) {
+            noc_io_get_file_size_blocking(request);
+        } else {
+            noc_io_read_file_blocking(request);
+        }
+
+        pthread_mutex_lock(&queue->mutex);
+
+        if (++queue->done_count == queue->requests_count) {
+            pthread_cond_signal(&queue->done_condition);
+        }
+    }
+
+    pthread_mutex_unlock(&queue->mutex);
+
+    return NULL;
+}
+
+static bool
+noc_io_threads_init(NOC_IO_Queue *queue)
+{
+    if (pthread_mutex_init(&queue->mutex, NULL) != 0) {
+        return false;
+    }
+
+    pthread_cond_init(&queue->work_condition, NULL);
+    pthread_cond_init(&queue->done_condition, NULL);
+
+    for (; queue->threads_count < NOC_IO_THREADS_COUNT; ++queue->threads_count) {
+        if (pthread_create(queue->threads + queue->threads_count, NULL, noc_io_thread_worker, queue) != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void
+noc_io_threads_run(NOC_IO_Queue *queue, NOC_IO_Operation operation, NOC_IO_Request *requests, SizeU count)
+{
+    pthread_mutex_lock(&queue->mutex);
+
+    queue->operation = operation;
+    queue->requests = requests;
+    queue->requests_count = count;
+    queue->next_index = 0;
+    queue->done_count = 0;
+
+    pthread_cond_broadcast(&queue->work_condition);
+
+    while (queue->done_count != queue->requests_count) {
+        pthread_cond_wait(&queue->done_condition, &queue->mutex);
+    }
+
+    // NOTE(gr3yknigh1): Threads must not look at the requests after batch is done. [2026/10/17]
+    queue->requests = NULL;
+    queue->requests_count = 0;
+    queue->next_index = 0;
+
+    pthread_mutex_unlock(&queue->mutex);
+}
+
+static void
+noc_io_threads_destroy(NOC_IO_Queue *queue)
+{
+    pthread_mutex_lock(&queue->mutex);
+    queue->is_stopping = true;
+    pthread_cond_broadcast(&queue->work_condition);
+    pthread_mutex_unlock(&queue->mutex);
+
+    for (SizeU thread_index = 0; thread_index < queue->threads_count; ++thread_index) {
+        pthread_join(queue->threads[thread_index], NULL);
+    }
+
+    pthread_cond_destroy(&queue->work_condition);
+    pthread_cond_destroy(&queue->done_condition);
+    pthread_mutex_destroy(&queue->mutex);
+}
+
+//
+// io_uring backend:
+//
+
+static bool
+noc_io_uring_is_supported(int ring_descriptor)
+{
+    SizeU probe_size = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+    struct io_uring_probe *probe = (struct io_uring_probe *)noc_native_allocate(probe_size);
+
+    if (probe == NULL) {
+        return false;
+    }
+
+    bool result = syscall(__NR_io_uring_register, ring_descriptor, IORING_REGISTER_PROBE, probe, 256) == 0;
+
+    Int8U operations[] = { IORING_OP_STATX, IORING_OP_OPENAT, IORING_OP_READ, IORING_OP_CLOSE };
+
+    for (SizeU operation_index = 0; result && operation_index < NOC_STATIC_ARRAY_COUNT(operations); ++operation_index) {
+        Int8U operation = operations[operation_index];
+        result = operation <= probe->last_op && (probe->ops[operation].flags & IO_URING_OP_SUPPORTED);
+    }
+
+    bool is_freed = noc_native_free(probe, probe_size);
+    return result && is_freed;
+}
+
+static void
+noc_io_uring_destroy(NOC_IO_Queue *queue)
+{
+    if (queue->sqes != NULL) {
+        munmap(queue->sqes, queue->sqes_size);
+    }
+
+    if (queue->cq_ring != NULL && queue->cq_ring != queue->sq_ring) {
+        munmap(queue->cq_ring, queue->cq_ring_size);
+    }
+
+    if (queue->sq_ring != NULL) {
+        munmap(queue->sq_ring, queue->sq_ring_size);
+    }
+
+    close(queue->ring_descriptor);
+}
+
+static bool
+noc_io_uring_init(NOC_IO_Queue *queue)
+{
+    struct io_uring_params parameters;
+    noc_memory_zero(&parameters, sizeof(parameters));
+
+    int ring_descriptor = (int)syscall(__NR_io_uring_setup, NOC_IO_URING_ENTRIES, &parameters);
+
+    if (ring_descriptor < 0) {
+        return false;
+    }
+
+    queue->ring_descriptor = ring_descriptor;
+
+    if (!(parameters.features & IORING_FEAT_SINGLE_MMAP) || !noc_io_uring_is_supported(ring_descriptor)) {
+        close(ring_descriptor);
+        return false;
+    }
+
+    queue->sq_ring_size = parameters.sq_off.array + parameters.sq_entries * sizeof(unsigned);
+    queue->cq_ring_size = parameters.cq_off.cqes + parameters.cq_entries * sizeof(struct io_uring_cqe);
+
+    if (queue->cq_ring_size > queue->sq_ring_size) {
+        queue->sq_ring_size = queue->cq_ring_size;
+    }
+
+    queue->cq_ring_size = queue->sq_ring_size;
+
+    void *ring = mmap(NULL, queue->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_descriptor, IORING_OFF_SQ_RING);
+    if (ring == MAP_FAILED) {
+        close(ring_descriptor);
+        return false;
+    }
+
+    queue->sq_ring = queue->cq_ring = ring;
+
+    queue->sqes_size = parameters.sq_entries * sizeof(struct io_uring_sqe);
+    queue->sqes = (struct io_uring_sqe *)mmap(NULL, queue->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_descriptor, IORING_OFF_SQES);
+
+    if (queue->sqes == MAP_FAILED) {
+        queue->sqes = NULL;
+        noc_io_uring_destroy(queue);
+        return false;
+    }
+
+    Byte *sq_ring = (Byte *)queue->sq_ring;
+    queue->sq_head = (unsigned *)(sq_ring + parameters.sq_off.head);
+    queue->sq_tail = (unsigned *)(sq_ring + parameters.sq_off.tail);
+    queue->sq_mask = (unsigned *)(sq_ring + parameters.sq_off.ring_mask);
+    queue->sq_array = (unsigned *)(sq_ring + parameters.sq_off.array);
+    queue->sq_entries = parameters.sq_entries;
+
+    Byte *cq_ring = (Byte *)queue->cq_ring;
+    queue->cq_head = (unsigned *)(cq_ring + parameters.cq_off.head);
+    queue->cq_tail = (unsigned *)(cq_ring + parameters.cq_off.tail);
+    queue->cq_mask = (unsigned *)(cq_ring + parameters.cq_off.ring_mask);
+    queue->cqes = (struct io_uring_cqe *)(cq_ring + parameters.cq_off.cqes);
+
+    return true;
+}
+
+static struct io_uring_sqe *
+noc_io_uring_push(NOC_IO_Queue *queue, Int8U opcode, int descriptor, Int64U user_data)
+{
+    unsigned tail = *queue->sq_tail;
+    unsigned index = tail & *queue->sq_mask;
+
+    struct io_uring_sqe *sqe = queue->sqes + index;
+    noc_memory_zero(sqe, sizeof(*sqe));
+
+    sqe->opcode = opcode;
+    sqe->fd = descriptor;
+    sqe->user_data = ((Int64U)queue->batch_index << 32) | user_data;
+
+    queue->sq_array[index] = index;
+    __atomic_store_n(queue->sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+    return sqe;
+}
+
+//
+// NOTE(gr3yknigh1): Submits everything pushed and waits for all of it. Results are written to `results` by
+// `user_data` index, which should be index of the push in the batch.
+//
+// If submission fails, entries that kernel didn't take are dropped from the ring and get `-ECANCELED`, so they are
+// not submitted with the next batch. Taken, but not completed ones stay `-EINPROGRESS`: their completions may
+// arrive later, and are skipped by the batch index. [2026/10/17]
+//
+static bool
+noc_io_uring_submit_and_wait(NOC_IO_Queue *queue, unsigned count, Int32S *results)
+{
+    unsigned submitted_count = 0;
+    unsigned completed_count = 0;
+
+    for (unsigned index = 0; index < count; ++index) {
+        results[index] = -EINPROGRESS;
+    }
+
+    while (completed_count < count) {
+        unsigned to_submit = count - submitted_count;
+        unsigned to_wait = count - completed_count;
+        long result = syscall(__NR_io_uring_enter, queue->ring_descriptor, to_submit, to_wait, IORING_ENTER_GETEVENTS, NULL, 0);
+
+        if (result < 0 && errno != EINTR) {
+            __atomic_store_n(queue->sq_tail, __atomic_load_n(queue->sq_head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+
+            for (unsigned index = submitted_count; index < count; ++index) {
+                results[index] = -ECANCELED;
+            }
+
+            queue->batch_index += 1;
+            return false;
+        }
+
+        if (result > 0) {
+            submitted_count += (unsigned)result;
+        }
+
+        unsigned head = *queue->cq_head;
+        unsigned tail = __atomic_load_n(queue->cq_tail, __ATOMIC_ACQUIRE);
+
+        for (; head != tail; ++head) {
+            struct io_uring_cqe *cqe = queue->cqes + (head & *queue->cq_mask);
+
+            if ((unsigned)(cqe->user_data >> 32) == queue->batch_index) {
+                results[(Int32U)cqe->user_data] = cqe->res;
+                completed_count += 1;
+            }
+        }
+
+        __atomic_store_n(queue->cq_head, head, __ATOMIC_RELEASE);
+    }
+
+    queue->batch_index += 1;
+    return true;
+}
+
+static bool
+noc_io_uring_get_file_sizes(NOC_IO_Queue *queue, NOC_IO_Request *requests, SizeU count)
+{
+    Int32S results[NOC_IO_URING_ENTRIES];
+
+    for (SizeU base = 0; base < count; base += queue->sq_entries) {
+        unsigned chunk_count = (unsigned)(count - base < queue->sq_entries ? count - base : queue->sq_entries);
+
+        for (unsigned index = 0; index < chunk_count; ++index) {
+            struct io_uring_sqe *sqe = noc_io_uring_push(queue, IORING_OP_STATX, AT_FDCWD, index);
+            sqe->addr = (Int64U)requests[base + index].path;
+            sqe->len = STATX_SIZE;
+            sqe->off = (Int64U)(queue->statx_buffers + index);
+        }
+
+        if (!noc_io_uring_submit_and_wait(queue, chunk_count, results)) {
+            return false;
+        }
+
+        for (unsigned index = 0; index < chunk_count; ++index) {
+            NOC_IO_Request *request = requests + base + index;
+
+            if (results[index] < 0) {
+                request->error = -results[index];
+            } else {
+                request->size = (SizeU)queue->statx_buffers[index].stx_size;
+            }
+        }
+    }
+
+    return true;
+}
+
+//
+// NOTE(gr3yknigh1): Each chunk takes three submissions: opens, reads (repeated while some are short) and
+// closes. If some submission fails, descriptors opened so far are closed anyway. [2026/10/17]
+//
+static bool
+noc_io_uring_read_files(NOC_IO_Queue *queue, NOC_IO_Request *requests, SizeU count)
+{
+    Int32S results[NOC_IO_URING_ENTRIES];
+    bool is_finished[NOC_IO_URING_ENTRIES];
+
+    for (SizeU base = 0; base < count; base += queue->sq_entries) {
+        unsigned chunk_count = (unsigned)(count - base < queue->sq_entries ? count - base : queue->sq_entries);
+        NOC_IO_Request *chunk = requests + base;
+
+        for (unsigned index = 0; index < chunk_count; ++index) {
+            struct io_uring_sqe *sqe = noc_io_uring_push(queue, IORING_OP_OPENAT, AT_FDCWD, index);
+            sqe->addr = (Int64U)chunk[index].path;
+            sqe->open_flags = O_RDONLY | O_CLOEXEC;
+        }
+
+        if (!noc_io_uring_submit_and_wait(queue, chunk_count, results)) {
+            for (unsigned index = 0; index < chunk_count; ++index) {
+                if (results[index] >= 0) {
+                    close(results[index]);
+                }
+            }
+
+            return false;
+        }
+
+        for (unsigned index = 0; index < chunk_count; ++index) {
+            queue->descriptors[index] = results[index];
+            is_finished[index] = results[index] < 0;
+
+            if (results[index] < 0) {
+                chunk[index].error = -results[index];
+            }
+        }
+
+        bool is_read = true;
+
+        for (;;) {
+            unsigned pending_count = 0;
+            unsigned pending_indexes[NOC_IO_URING_ENTRIES];
+
+            for (unsigned index = 0; index < chunk_count; ++index) {
+                NOC_IO_Request *request = chunk + index;
+
+                if (is_finished[index] || request->size == request->capacity) {
+                    continue;
+                }
+
+                SizeU size = request->capacity - request->size;
+
+                struct io_uring_sqe *sqe = noc_io_uring_push(queue, IORING_OP_READ, queue->descriptors[index], pending_count);
+                sqe->addr = (Int64U)(request->buffer + request->size);
+                sqe->len = (Int32U)(size < NOC_IO_MAX_READ_SIZE ? size : NOC_IO_MAX_READ_SIZE);
+                sqe->off = request->size;
+
+                pending_indexes[pending_count++] = index;
+            }
+
+            if (pending_count == 0) {
+                break;
+            }
+
+            if (!noc_io_uring_submit_and_wait(queue, pending_count, results)) {
+                is_read = false;
+                break;
+            }
+
+            for (unsigned pending_index = 0; pending_index < pending_count; ++pending_index) {
+                unsigned index = pending_indexes[pending_index];
+                Int32S result = results[pending_index];
+
+                // NOTE(gr3yknigh1): Zero means that file is shorter than capacity. [2026/10/17]
+                if (result <= 0) {
+                    chunk[index].error = -result;
+                    is_finished[index] = true;
+                } else {
+                    chunk[index].size += (SizeU)result;
+                }
+            }
+        }
+
+        unsigned close_count = 0;
+
+        for (unsigned index = 0; index < chunk_count; ++index) {
+            if (queue->descriptors[index] >= 0) {
+                noc_io_uring_push(queue, IORING_OP_CLOSE, queue->descriptors[index], close_count++);
+            }
+        }
+
+        bool is_closed = close_count == 0 || noc_io_uring_submit_and_wait(queue, close_count, results);
+
+        // NOTE(gr3yknigh1): Closes, which kernel didn't take, are done here, so descriptors don't leak. [2026/10/17]
+        if (!is_closed) {
+            unsigned close_index = 0;
+
+            for (unsigned index = 0; index < chunk_count; ++index) {
+                if (queue->descriptors[index] >= 0 && results[close_index++] == -ECANCELED) {
+                    close(queue->descriptors[index]);
+                }
+            }
+        }
+
+        if (!is_read || !is_closed) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//
+// Queue:
+//
+
+NOC_NODISCARD NOC_IO_Queue *
+noc_io_queue_make(NOC_IO_Backend backend)
+{
+    NOC_IO_Queue *queue = (NOC_IO_Queue *)noc_native_allocate(sizeof(NOC_IO_Queue));
+
+    if (queue == NULL) {
+        return NULL;
+    }
+
+    if (backend != NOC_IO_BACKEND_THREADS && noc_io_uring_init(queue)) {
+        queue->backend = NOC_IO_BACKEND_IO_URING;
+        return queue;
+    }
+
+    queue->backend = NOC_IO_BACKEND_THREADS;
+
+    if (!noc_io_threads_init(queue)) {
+        noc_io_queue_destroy(queue);
+        return NULL;
+    }
+
+    return queue;
+}
+
+void
+noc_io_queue_destroy(NOC_IO_Queue *queue)
+{
+    if (queue == NULL) {
+        return;
+    }
+
+    if (queue->backend == NOC_IO_BACKEND_IO_URING) {
+        noc_io_uring_destroy(queue);
+    } else {
+        noc_io_threads_destroy(queue);
+    }
+
+    bool is_freed = noc_native_free(queue, sizeof(NOC_IO_Queue));
+    NOC_UNUSED(is_freed);
+}
+
+NOC_IO_Backend
+noc_io_queue_get_backend(const NOC_IO_Queue *queue)
+{
+    return queue->backend;
+}
+
+static bool
+noc_io_run(NOC_IO_Queue *queue, NOC_IO_Operation operation, NOC_IO_Request *requests, SizeU count)
+{
+    for (SizeU index = 0; index < count; ++index) {
+        requests[index].size = 0;
+        requests[index].error = 0;
+    }
+
+    bool result = true;
+
+    if (queue->backend == NOC_IO_BACKEND_IO_URING) {
+        result = operation == NOC_IO_OPERATION_GET_SIZE ? noc_io_uring_get_file_sizes(queue, requests, count)
+                                                        : noc_io_uring_read_files(queue, requests, count);
+    } else if (count > 0) {
+        noc_io_threads_run(queue, operation, requests, count);
+    }
+
+    for (SizeU index = 0; result && index < count; ++index) {
+        result = requests[index].error == 0;
+    }
+
+    return result;
+}
+
+bool
+noc_io_get_file_sizes(NOC_IO_Queue *queue, NOC_IO_Request *requests, SizeU count)
+{
+    return noc_io_run(queue, NOC_IO_OPERATION_GET_SIZE, requests, count);
+}
+
+bool
+noc_io_read_files(NOC_IO_Queue *queue, NOC_IO_Request *requests, SizeU count)
+{
+    return noc_io_run(queue, NOC_IO_OPERATION_READ, requests, count);
+}
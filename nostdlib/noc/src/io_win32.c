@@ -0,0 +1,164 @@
+#include <windows.h>
+
+#include "noc/noc.h"
+
+//
+// NOTE(gr3yknigh1): There is no io_uring analog which fits batch of whole-file reads as good, so requests are run on
+// the system thread pool: one work object per batch, which is submitted for each request. [2026/10/17]
+//
+
+typedef enum NOC_IO_Operation {
+    NOC_IO_OPERATION_GET_SIZE,
+    NOC_IO_OPERATION_READ,
+} NOC_IO_Operation;
+
+struct NOC_IO_Queue {
+    NOC_IO_Backend backend;
+
+    PTP_WORK work;
+
+    NOC_IO_Operation operation;
+    NOC_IO_Request *requests;
+    volatile LONG64 next_index;
+};
+
+static void
+noc_io_get_file_size_blocking(NOC_IO_Request *request)
+{
+    WIN32_FILE_ATTRIBUTE_DATA attributes;
+
+    if (!GetFileAttributesExA(request->path, GetFileExInfoStandard, &attributes)) {
+        request->error = (Int32S)GetLastError();
+        return;
+    }
+
+    request->size = ((SizeU)attributes.nFileSizeHigh << 32) | attributes.nFileSizeLow;
+}
+
+static void
+noc_io_read_file_blocking(NOC_IO_Request *request)
+{
+    HANDLE file = CreateFileA(
+        request->path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+
+    if (file == INVALID_HANDLE_VALUE) {
+        request->error = (Int32S)GetLastError();
+        return;
+    }
+
+    while (request->size < request->capacity) {
+        SizeU size = request->capacity - request->size;
+        DWORD read_size = 0;
+
+        if (!ReadFile(file, request->buffer + request->size, size < MAXDWORD ? (DWORD)size : MAXDWORD, &read_size, NULL)) {
+            request->error = (Int32S)GetLastError();
+            break;
+        }
+
+        if (read_size == 0) {
+            break;
+        }
+
+        request->size += read_size;
+    }
+
+    CloseHandle(file);
+}
+
+static VOID CALLBACK
+noc_io_work_callback(PTP_CALLBACK_INSTANCE instance, PVOID parameter, PTP_WORK work)
+{
+    NOC_UNUSED(instance);
+    NOC_UNUSED(work);
+
+    NOC_IO_Queue *queue = (NOC_IO_Queue *)parameter;
+    NOC_IO_Request *request = queue->requests + InterlockedIncrement64(&queue->next_index) - 1;
+
+    if (queue->operation == NOC_IO_OPERATION_GET_SIZE) {
+        noc_io_get_file_size_blocking(request);
+    } else {
+        noc_io_read_file_blocking(request);
+    }
+}
+
+NOC_NODISCARD NOC_IO_Queue *
+noc_io_queue_make(NOC_IO_Backend backend)
+{
+    NOC_UNUSED(backend);
+
+    NOC_IO_Queue *queue = (NOC_IO_Queue *)noc_native_allocate(sizeof(NOC_IO_Queue));
+
+    if (queue == NULL) {
+        return NULL;
+    }
+
+    queue->backend = NOC_IO_BACKEND_THREADS;
+    queue->work = CreateThreadpoolWork(noc_io_work_callback, queue, NULL);
+
+    if (queue->work == NULL) {
+        noc_io_queue_destroy(queue);
+        return NULL;
+    }
+
+    return queue;
+}
+
+void
+noc_io_queue_destroy(NOC_IO_Queue *queue)
+{
+    if (queue == NULL) {
+        return;
+    }
+
+    if (queue->work != NULL) {
+        CloseThreadpoolWork(queue->work);
+    }
+
+    bool is_freed = noc_native_free(queue, sizeof(NOC_IO_Queue));
+    NOC_UNUSED(is_freed);
+}
+
+NOC_IO_Backend
+noc_io_queue_get_backend(const NOC_IO_Queue *queue)
+{
+    return queue->backend;
+}
+
+static bool
+noc_io_run(NOC_IO_Queue *queue, NOC_IO_Operation operation, NOC_IO_Request *requests, SizeU count)
+{
+    queue->operation = operation;
+    queue->requests = requests;
+    queue->next_index = 0;
+
+    for (SizeU index = 0; index < count; ++index) {
+        requests[index].size = 0;
+        requests[index].error = 0;
+    }
+
+    for (SizeU index = 0; index < count; ++index) {
+        SubmitThreadpoolWork(queue->work);
+    }
+
+    WaitForThreadpoolWorkCallbacks(queue->work, FALSE);
+
+    bool result = true;
+
+    for (SizeU index = 0; result && index < count; ++index) {
+        result = requests[index].error == 0;
+    }
+
+    return result;
+}
+
+bool
+noc_io_get_file_sizes(NOC_IO_Queue *queue, NOC_IO_Request *requests, SizeU count)
+{
+    return noc_io_run(queue, NOC_IO_OPERATION_GET_SIZE, requests, count);
+}
+
+bool
+noc_io_read_files(NOC_IO_Queue *queue, NOC_IO_Request *requests, SizeU count)
+{
+    return noc_io_run(queue, NOC_IO_OPERATION_READ, requests, count);
+}
@@ -21,41 +21,979 @@ noc_free(void *p)
     free(p);
 }
 
+//
+// SIMD kernels:
+//
+// NOTE(gr3yknigh1): Kernels are compiled for all instruction sets and picked at runtime, so library is still built
+// for baseline x86-64 (SSE2). Each kernel expects more than two SSE2 vectors of data: it writes first and last
+// vectors unaligned, and everything in between with aligned stores. Big sizes go around the cache, with non-temporal
+// stores. [2026/10/17]
+//
+
+#if NOC_DETECT_ARCH_X86_64
+    #define NOC_MEMORY_SIMD 1
+
+    #include <immintrin.h>
+
+    #if NOC_DETECT_COMPILER_MSVC
+        #include <intrin.h>
+        #define NOC_MEMORY_TARGET_AVX2
+    #else
+        #include <cpuid.h>
+        #define NOC_MEMORY_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+
+#else
+    #define NOC_MEMORY_SIMD 0
+
+#endif
+
+#if NOC_MEMORY_SIMD
+
+//
+// NOTE(gr3yknigh1): With ERMS (enhanced `rep movsb`) microcode copies whole cache lines, which is faster than AVX2
+// loop for sizes that still fit in cache. [2026/10/17]
+//
+#define NOC_MEMORY_REP_MOVS_THRESHOLD 2048
+
+static bool noc_memory_has_erms = false;
+
+static void
+noc_memory_copy_rep_movsb(Byte *destination, const Byte *source, SizeU size)
+{
+    #if NOC_DETECT_COMPILER_MSVC
+        __movsb(destination, source, size);
+    #else
+        __asm__ __volatile__("rep movsb" : "+D"(destination), "+S"(source), "+c"(size) : : "memory");
+    #endif
+}
+
+//
+// NOTE(gr3yknigh1): Sizes up to two SSE2 vectors are written with overlapping stores, without dispatch. SSE2 is
+// baseline of x86-64, so it's always available. [2026/10/17]
+//
+static void
+noc_memory_set_small(Byte *buffer, SizeU size, Byte value)
+{
+    __m128i vector = _mm_set1_epi8((char)value);
+
+    if (size >= 16) {
+        _mm_storeu_si128((__m128i *)buffer, vector);
+        _mm_storeu_si128((__m128i *)(buffer + size - 16), vector);
+    } else if (size >= 8) {
+        _mm_storel_epi64((__m128i *)buffer, vector);
+        _mm_storel_epi64((__m128i *)(buffer + size - 8), vector);
+    } else if (size >= 4) {
+        _mm_storeu_si32(buffer, vector);
+        _mm_storeu_si32(buffer + size - 4, vector);
+    } else {
+        for (SizeU i = 0; i < size; ++i) {
+            buffer[i] = value;
+        }
+    }
+}
+
+static void
+noc_memory_copy_small(Byte *destination, const Byte *source, SizeU size)
+{
+    if (size >= 16) {
+        __m128i head = _mm_loadu_si128((const __m128i *)source);
+        __m128i tail = _mm_loadu_si128((const __m128i *)(source + size - 16));
+        _mm_storeu_si128((__m128i *)destination, head);
+        _mm_storeu_si128((__m128i *)(destination + size - 16), tail);
+    } else if (size >= 8) {
+        __m128i head = _mm_loadl_epi64((const __m128i *)source);
+        __m128i tail = _mm_loadl_epi64((const __m128i *)(source + size - 8));
+        _mm_storel_epi64((__m128i *)destination, head);
+        _mm_storel_epi64((__m128i *)(destination + size - 8), tail);
+    } else if (size >= 4) {
+        __m128i head = _mm_loadu_si32(source);
+        __m128i tail = _mm_loadu_si32(source + size - 4);
+        _mm_storeu_si32(destination, head);
+        _mm_storeu_si32(destination + size - 4, tail);
+    } else {
+        for (SizeU i = 0; i < size; ++i) {
+            destination[i] = source[i];
+        }
+    }
+}
+
+static Byte *
+noc_memory_align_up(Byte *pointer, SizeU alignment)
+{
+    return (Byte *)(((SizeU)pointer + alignment) & ~(alignment - 1));
+}
+
+static Byte *
+noc_memory_align_down(Byte *pointer, SizeU alignment)
+{
+    return (Byte *)((SizeU)pointer & ~(alignment - 1));
+}
+
+static void
+noc_memory_set_sse2(Byte *buffer, SizeU size, Byte value)
+{
+    __m128i vector = _mm_set1_epi8((char)value);
+    Byte *end = buffer + size;
+
+    _mm_storeu_si128((__m128i *)buffer, vector);
+    _mm_storeu_si128((__m128i *)(end - 16), vector);
+
+    Byte *cursor = noc_memory_align_up(buffer, 16);
+    Byte *aligned_end = noc_memory_align_down(end, 16);
+
+    if (size >= NOC_MEMORY_NON_TEMPORAL_THRESHOLD) {
+        for (; cursor + 64 <= aligned_end; cursor += 64) {
+            _mm_stream_si128((__m128i *)(cursor + 0), vector);
+            _mm_stream_si128((__m128i *)(cursor + 16), vector);
+            _mm_stream_si128((__m128i *)(cursor + 32), vector);
+            _mm_stream_si128((__m128i *)(cursor + 48), vector);
+        }
+        for (; cursor < aligned_end; cursor += 16) {
+            _mm_stream_si128((__m128i *)cursor, vector);
+        }
+        _mm_sfence();
+        return;
+    }
+
+    for (; cursor + 64 <= aligned_end; cursor += 64) {
+        _mm_store_si128((__m128i *)(cursor + 0), vector);
+        _mm_store_si128((__m128i *)(cursor + 16), vector);
+        _mm_store_si128((__m128i *)(cursor + 32), vector);
+        _mm_store_si128((__m128i *)(cursor + 48), vector);
+    }
+    for (; cursor < aligned_end; cursor += 16) {
+        _mm_store_si128((__m128i *)cursor, vector);
+    }
+}
+
+NOC_MEMORY_TARGET_AVX2 static void
+noc_memory_set_avx2(Byte *buffer, SizeU size, Byte value)
+{
+    __m256i vector = _mm256_set1_epi8((char)value);
+    Byte *end = buffer + size;
+
+    _mm256_storeu_si256((__m256i *)buffer, vector);
+    _mm256_storeu_si256((__m256i *)(end - 32), vector);
+
+    if (size <= 64) {
+        return;
+    }
+
+    if (size <= 128) {
+        _mm256_storeu_si256((__m256i *)(buffer + 32), vector);
+        _mm256_storeu_si256((__m256i *)(end - 64), vector);
+        return;
+    }
+
+    Byte *cursor = noc_memory_align_up(buffer, 32);
+    Byte *aligned_end = noc_memory_align_down(end, 32);
+
+    if (size >= NOC_MEMORY_NON_TEMPORAL_THRESHOLD) {
+        for (; cursor + 128 <= aligned_end; cursor += 128) {
+            _mm256_stream_si256((__m256i *)(cursor + 0), vector);
+            _mm256_stream_si256((__m256i *)(cursor + 32), vector);
+            _mm256_stream_si256((__m256i *)(cursor + 64), vector);
+            _mm256_stream_si256((__m256i *)(cursor + 96), vector);
+        }
+        for (; cursor < aligned_end; cursor += 32) {
+            _mm256_stream_si256((__m256i *)cursor, vector);
+        }
+        _mm_sfence();
+        return;
+    }
+
+    for (; cursor + 128 <= aligned_end; cursor += 128) {
+        _mm256_store_si256((__m256i *)(cursor + 0), vector);
+        _mm256_store_si256((__m256i *)(cursor + 32), vector);
+        _mm256_store_si256((__m256i *)(cursor + 64), vector);
+        _mm256_store_si256((__m256i *)(cursor + 96), vector);
+    }
+    for (; cursor < aligned_end; cursor += 32) {
+        _mm256_store_si256((__m256i *)cursor, vector);
+    }
+}
+
+static void
+noc_memory_copy_sse2(Byte *destination, const Byte *source, SizeU size)
+{
+    Byte *end = destination + size;
+
+    // NOTE(gr3yknigh1): Tail is loaded before the loop, so it's fine if head and tail vectors overlap. [2026/10/17]
+    __m128i head = _mm_loadu_si128((const __m128i *)source);
+    __m128i tail = _mm_loadu_si128((const __m128i *)(source + size - 16));
+
+    Byte *cursor = noc_memory_align_up(destination, 16);
+    Byte *aligned_end = noc_memory_align_down(end, 16);
+    const Byte *source_cursor = source + (cursor - destination);
+
+    if (size >= NOC_MEMORY_NON_TEMPORAL_THRESHOLD) {
+        for (; cursor + 64 <= aligned_end; cursor += 64, source_cursor += 64) {
+            __m128i a = _mm_loadu_si128((const __m128i *)(source_cursor + 0));
+            __m128i b = _mm_loadu_si128((const __m128i *)(source_cursor + 16));
+            __m128i c = _mm_loadu_si128((const __m128i *)(source_cursor + 32));
+            __m128i d = _mm_loadu_si128((const __m128i *)(source_cursor + 48));
+            _mm_stream_si128((__m128i *)(cursor + 0), a);
+            _mm_stream_si128((__m128i *)(cursor + 16), b);
+            _mm_stream_si128((__m128i *)(cursor + 32), c);
+            _mm_stream_si128((__m128i *)(cursor + 48), d);
+        }
+        for (; cursor < aligned_end; cursor += 16, source_cursor += 16) {
+            _mm_stream_si128((__m128i *)cursor, _mm_loadu_si128((const __m128i *)source_cursor));
+        }
+        _mm_sfence();
+    } else {
+        for (; cursor + 64 <= aligned_end; cursor += 64, source_cursor += 64) {
+            __m128i a = _mm_loadu_si128((const __m128i *)(source_cursor + 0));
+            __m128i b = _mm_loadu_si128((const __m128i *)(source_cursor + 16));
+            __m128i c = _mm_loadu_si128((const __m128i *)(source_cursor + 32));
+            __m128i d = _mm_loadu_si128((const __m128i *)(source_cursor + 48));
+            _mm_store_si128((__m128i *)(cursor + 0), a);
+            _mm_store_si128((__m128i *)(cursor + 16), b);
+            _mm_store_si128((__m128i *)(cursor + 32), c);
+            _mm_store_si128((__m128i *)(cursor + 48), d);
+        }
+        for (; cursor < aligned_end; cursor += 16, source_cursor += 16) {
+            _mm_store_si128((__m128i *)cursor, _mm_loadu_si128((const __m128i *)source_cursor));
+        }
+    }
+
+    _mm_storeu_si128((__m128i *)destination, head);
+    _mm_storeu_si128((__m128i *)(end - 16), tail);
+}
+
+NOC_MEMORY_TARGET_AVX2 static void
+noc_memory_copy_avx2(Byte *destination, const Byte *source, SizeU size)
+{
+    // NOTE(gr3yknigh1): Up to 8 vectors are copied without loop, all loads go before stores. [2026/10/17]
+    if (size <= 64) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)source);
+        __m256i b = _mm256_loadu_si256((const __m256i *)(source + size - 32));
+        _mm256_storeu_si256((__m256i *)destination, a);
+        _mm256_storeu_si256((__m256i *)(destination + size - 32), b);
+        return;
+    }
+
+    if (size <= 128) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)source);
+        __m256i b = _mm256_loadu_si256((const __m256i *)(source + 32));
+        __m256i c = _mm256_loadu_si256((const __m256i *)(source + size - 64));
+        __m256i d = _mm256_loadu_si256((const __m256i *)(source + size - 32));
+        _mm256_storeu_si256((__m256i *)destination, a);
+        _mm256_storeu_si256((__m256i *)(destination + 32), b);
+        _mm256_storeu_si256((__m256i *)(destination + size - 64), c);
+        _mm256_storeu_si256((__m256i *)(destination + size - 32), d);
+        return;
+    }
+
+    if (size <= 256) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)source);
+        __m256i b = _mm256_loadu_si256((const __m256i *)(source + 32));
+        __m256i c = _mm256_loadu_si256((const __m256i *)(source + 64));
+        __m256i d = _mm256_loadu_si256((const __m256i *)(source + 96));
+        __m256i e = _mm256_loadu_si256((const __m256i *)(source + size - 128));
+        __m256i f = _mm256_loadu_si256((const __m256i *)(source + size - 96));
+        __m256i g = _mm256_loadu_si256((const __m256i *)(source + size - 64));
+        __m256i h = _mm256_loadu_si256((const __m256i *)(source + size - 32));
+        _mm256_storeu_si256((__m256i *)destination, a);
+        _mm256_storeu_si256((__m256i *)(destination + 32), b);
+        _mm256_storeu_si256((__m256i *)(destination + 64), c);
+        _mm256_storeu_si256((__m256i *)(destination + 96), d);
+        _mm256_storeu_si256((__m256i *)(destination + size - 128), e);
+        _mm256_storeu_si256((__m256i *)(destination + size - 96), f);
+        _mm256_storeu_si256((__m256i *)(destination + size - 64), g);
+        _mm256_storeu_si256((__m256i *)(destination + size - 32), h);
+        return;
+    }
+
+    if (size >= NOC_MEMORY_REP_MOVS_THRESHOLD && size < NOC_MEMORY_NON_TEMPORAL_THRESHOLD && noc_memory_has_erms) {
+        noc_memory_copy_rep_movsb(destination, source, size);
+        return;
+    }
+
+    Byte *end = destination + size;
+
+    __m256i head = _mm256_loadu_si256((const __m256i *)source);
+    __m256i tail = _mm256_loadu_si256((const __m256i *)(source + size - 32));
+
+    Byte *cursor = noc_memory_align_up(destination, 32);
+    Byte *aligned_end = noc_memory_align_down(end, 32);
+    const Byte *source_cursor = source + (cursor - destination);
+
+    if (size >= NOC_MEMORY_NON_TEMPORAL_THRESHOLD) {
+        for (; cursor + 128 <= aligned_end; cursor += 128, source_cursor += 128) {
+            __m256i a = _mm256_loadu_si256((const __m256i *)(source_cursor + 0));
+            __m256i b = _mm256_loadu_si256((const __m256i *)(source_cursor + 32));
+            __m256i c = _mm256_loadu_si256((const __m256i *)(source_cursor + 64));
+            __m256i d = _mm256_loadu_si256((const __m256i *)(source_cursor + 96));
+            _mm256_stream_si256((__m256i *)(cursor + 0), a);
+            _mm256_stream_si256((__m256i *)(cursor + 32), b);
+            _mm256_stream_si256((__m256i *)(cursor + 64), c);
+            _mm256_stream_si256((__m256i *)(cursor + 96), d);
+        }
+        for (; cursor < aligned_end; cursor += 32, source_cursor += 32) {
+            _mm256_stream_si256((__m256i *)cursor, _mm256_loadu_si256((const __m256i *)source_cursor));
+        }
+        _mm_sfence();
+    } else {
+        for (; cursor + 128 <= aligned_end; cursor += 128, source_cursor += 128) {
+            __m256i a = _mm256_loadu_si256((const __m256i *)(source_cursor + 0));
+            __m256i b = _mm256_loadu_si256((const __m256i *)(source_cursor + 32));
+            __m256i c = _mm256_loadu_si256((const __m256i *)(source_cursor + 64));
+            __m256i d = _mm256_loadu_si256((const __m256i *)(source_cursor + 96));
+            _mm256_store_si256((__m256i *)(cursor + 0), a);
+            _mm256_store_si256((__m256i *)(cursor + 32), b);
+            _mm256_store_si256((__m256i *)(cursor + 64), c);
+            _mm256_store_si256((__m256i *)(cursor + 96), d);
+        }
+        for (; cursor < aligned_end; cursor += 32, source_cursor += 32) {
+            _mm256_store_si256((__m256i *)cursor, _mm256_loadu_si256((const __m256i *)source_cursor));
+        }
+    }
+
+    _mm256_storeu_si256((__m256i *)destination, head);
+    _mm256_storeu_si256((__m256i *)(end - 32), tail);
+}
+
+#endif // NOC_MEMORY_SIMD
+
+static NOC_Memory_SIMD_Level
+noc_memory_detect_simd_level(void)
+{
+#if NOC_MEMORY_SIMD
+
+    #if NOC_DETECT_COMPILER_MSVC
+        int info[4];
+
+        __cpuid(info, 0);
+        int max_leaf = info[0];
+
+        __cpuid(info, 1);
+        bool has_osxsave = (info[2] & (1 << 27)) != 0;
+        bool has_avx = (info[2] & (1 << 28)) != 0;
+
+        // NOTE(gr3yknigh1): OS should also save YMM registers on context switch (XCR0 bits 1 and 2). [2026/10/17]
+        if (max_leaf >= 7 && has_osxsave && has_avx && (_xgetbv(0) & 6) == 6) {
+            __cpuidex(info, 7, 0);
+
+            noc_memory_has_erms = (info[1] & (1 << 9)) != 0;
+
+            if (info[1] & (1 << 5)) {
+                return NOC_MEMORY_SIMD_LEVEL_AVX2;
+            }
+        }
+
+        return NOC_MEMORY_SIMD_LEVEL_SSE2;
+
+    #else
+        unsigned int eax, ebx, ecx, edx;
+        if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+            noc_memory_has_erms = (ebx & (1 << 9)) != 0;
+        }
+
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") ? NOC_MEMORY_SIMD_LEVEL_AVX2 : NOC_MEMORY_SIMD_LEVEL_SSE2;
+
+    #endif
+
+#else
+    return NOC_MEMORY_SIMD_LEVEL_NONE;
+
+#endif
+}
+
+//
+// NOTE(gr3yknigh1): Detection is idempotent, so threads, which are racing on first call, write the same value.
+// [2026/10/17]
+//
+static Int32S noc_memory_simd_level = -1;
+static Int32S noc_memory_simd_level_supported = -1;
+
+NOC_Memory_SIMD_Level
+noc_memory_get_simd_level(void)
+{
+    if (noc_memory_simd_level < 0) {
+        noc_memory_simd_level_supported = noc_memory_detect_simd_level();
+        noc_memory_simd_level = noc_memory_simd_level_supported;
+    }
+
+    return (NOC_Memory_SIMD_Level)noc_memory_simd_level;
+}
+
+static inline NOC_Memory_SIMD_Level
+noc_memory_load_simd_level(void)
+{
+    return noc_memory_simd_level >= 0 ? (NOC_Memory_SIMD_Level)noc_memory_simd_level : noc_memory_get_simd_level();
+}
+
+NOC_Memory_SIMD_Level
+noc_memory_set_simd_level(NOC_Memory_SIMD_Level level)
+{
+    noc_memory_get_simd_level();
+
+    if ((Int32S)level > noc_memory_simd_level_supported) {
+        level = (NOC_Memory_SIMD_Level)noc_memory_simd_level_supported;
+    }
+
+    noc_memory_simd_level = level;
+    return level;
+}
+
 void
 noc_memory_zero(void *buffer, SizeU size)
 {
-    while (size-- > 0) {
-        ((char *)buffer)[size] = 0;
-    }
+    noc_memory_set(buffer, size, 0);
 }
 
 void
 noc_memory_set(void *buffer, SizeU size, Byte value)
 {
-    while (size-- > 0) {
-        ((char *)buffer)[size] = value;
+#if NOC_MEMORY_SIMD
+    if (size <= 32) {
+        noc_memory_set_small((Byte *)buffer, size, value);
+        return;
+    }
+
+    switch (noc_memory_load_simd_level()) {
+    case NOC_MEMORY_SIMD_LEVEL_AVX2:
+        noc_memory_set_avx2((Byte *)buffer, size, value);
+        return;
+    case NOC_MEMORY_SIMD_LEVEL_SSE2:
+        noc_memory_set_sse2((Byte *)buffer, size, value);
+        return;
+    case NOC_MEMORY_SIMD_LEVEL_NONE:
+        break;
+    }
+#endif
+
+    for (SizeU i = 0; i < size; ++i) {
+        ((Byte *)buffer)[i] = value;
     }
 }
 
 void
 noc_memory_copy(void *destination, const void *source, SizeU size)
 {
+#if NOC_MEMORY_SIMD
+    if (size <= 32) {
+        noc_memory_copy_small((Byte *)destination, (const Byte *)source, size);
+        return;
+    }
+
+    switch (noc_memory_load_simd_level()) {
+    case NOC_MEMORY_SIMD_LEVEL_AVX2:
+        noc_memory_copy_avx2((Byte *)destination, (const Byte *)source, size);
+        return;
+    case NOC_MEMORY_SIMD_LEVEL_SSE2:
+        noc_memory_copy_sse2((Byte *)destination, (const Byte *)source, size);
+        return;
+    case NOC_MEMORY_SIMD_LEVEL_NONE:
+        break;
+    }
+#endif
+
+    for (SizeU i = 0; i < size; ++i) {
+        ((Byte *)destination)[i] = ((const Byte *)source)[i];
+    }
+}
+
+//
+// Comparison:
+//
+// NOTE(gr3yknigh1): Like set and copy kernels, comparison covers the tail with last (overlapping) vector instead of
+// byte loop. Loads are unaligned, because both buffers rarely have the same alignment. [2026/10/17]
+//
+
+#if NOC_MEMORY_SIMD
+
+static bool
+noc_memory_is_equals_small(const Byte *a, const Byte *b, SizeU size)
+{
+    if (size >= 8) {
+        __m128i head = _mm_xor_si128(_mm_loadl_epi64((const __m128i *)a), _mm_loadl_epi64((const __m128i *)b));
+        __m128i tail = _mm_xor_si128(_mm_loadl_epi64((const __m128i *)(a + size - 8)), _mm_loadl_epi64((const __m128i *)(b + size - 8)));
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(head, tail), _mm_setzero_si128())) == 0xFFFF;
+    }
+
+    if (size >= 4) {
+        __m128i head = _mm_xor_si128(_mm_loadu_si32(a), _mm_loadu_si32(b));
+        __m128i tail = _mm_xor_si128(_mm_loadu_si32(a + size - 4), _mm_loadu_si32(b + size - 4));
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(head, tail), _mm_setzero_si128())) == 0xFFFF;
+    }
+
+    // NOTE(gr3yknigh1): First, middle and last bytes cover every size up to 3. [2026/10/17]
+    return size == 0 || (a[0] == b[0] && a[size / 2] == b[size / 2] && a[size - 1] == b[size - 1]);
+}
+
+static bool
+noc_memory_is_equals_sse2(const Byte *a, const Byte *b, SizeU size)
+{
+    if (size < 16) {
+        return noc_memory_is_equals_small(a, b, size);
+    }
+
+    for (SizeU offset = 0; offset + 16 < size; offset += 16) {
+        __m128i a_vector = _mm_loadu_si128((const __m128i *)(a + offset));
+        __m128i b_vector = _mm_loadu_si128((const __m128i *)(b + offset));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(a_vector, b_vector)) != 0xFFFF) {
+            return false;
+        }
+    }
+
+    __m128i a_tail = _mm_loadu_si128((const __m128i *)(a + size - 16));
+    __m128i b_tail = _mm_loadu_si128((const __m128i *)(b + size - 16));
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(a_tail, b_tail)) == 0xFFFF;
+}
+
+NOC_MEMORY_TARGET_AVX2 static bool
+noc_memory_is_equals_avx2(const Byte *a, const Byte *b, SizeU size)
+{
+    if (size < 32) {
+        return noc_memory_is_equals_sse2(a, b, size);
+    }
+
+    for (SizeU offset = 0; offset + 32 < size; offset += 32) {
+        __m256i a_vector = _mm256_loadu_si256((const __m256i *)(a + offset));
+        __m256i b_vector = _mm256_loadu_si256((const __m256i *)(b + offset));
+        if ((Int32U)_mm256_movemask_epi8(_mm256_cmpeq_epi8(a_vector, b_vector)) != 0xFFFFFFFFU) {
+            return false;
+        }
+    }
+
+    __m256i a_tail = _mm256_loadu_si256((const __m256i *)(a + size - 32));
+    __m256i b_tail = _mm256_loadu_si256((const __m256i *)(b + size - 32));
+    return (Int32U)_mm256_movemask_epi8(_mm256_cmpeq_epi8(a_tail, b_tail)) == 0xFFFFFFFFU;
+}
+
+#endif // NOC_MEMORY_SIMD
+
+bool
+noc_memory_is_equals(const void *a, const void *b, SizeU size)
+{
+    if (a == b) {
+        return true;
+    }
+
+#if NOC_MEMORY_SIMD
+    switch (noc_memory_load_simd_level()) {
+    case NOC_MEMORY_SIMD_LEVEL_AVX2:
+        return noc_memory_is_equals_avx2((const Byte *)a, (const Byte *)b, size);
+    case NOC_MEMORY_SIMD_LEVEL_SSE2:
+        return noc_memory_is_equals_sse2((const Byte *)a, (const Byte *)b, size);
+    case NOC_MEMORY_SIMD_LEVEL_NONE:
+        break;
+    }
+#endif
+
     for (SizeU i = 0; i < size; ++i) {
-        ((Byte *)destination)[i] = ((Byte *)source)[i];
+        if (((const Byte *)a)[i] != ((const Byte *)b)[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//
+// Search:
+//
+// NOTE(gr3yknigh1): Search kernels load whole aligned blocks, which contain the buffer, and mask out bytes outside of
+// it. Aligned load never crosses page boundary, so it can't fault, but memory checkers may complain. [2026/10/17]
+//
+
+#if NOC_MEMORY_SIMD
+
+static inline Int32U
+noc_memory_bit_scan_forward(Int32U mask)
+{
+    #if NOC_DETECT_COMPILER_MSVC
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return (Int32U)index;
+    #else
+        return (Int32U)__builtin_ctz(mask);
+    #endif
+}
+
+static inline Int32U
+noc_memory_bit_scan_reverse(Int32U mask)
+{
+    #if NOC_DETECT_COMPILER_MSVC
+        unsigned long index;
+        _BitScanReverse(&index, mask);
+        return (Int32U)index;
+    #else
+        return 31 - (Int32U)__builtin_clz(mask);
+    #endif
+}
+
+//
+// NOTE(gr3yknigh1): Bits of `mask` for bytes before `begin` and starting from `end` are cleared. [2026/10/17]
+//
+static inline Int32U
+noc_memory_mask_block(Int32U mask, const Byte *block, SizeU block_size, const Byte *begin, const Byte *end)
+{
+    if (begin > block) {
+        mask &= ~0U << (begin - block);
+    }
+    if (end < block + block_size) {
+        mask &= (1U << (end - block)) - 1;
     }
+    return mask;
 }
 
+static const Byte *
+noc_memory_find_sse2(const Byte *buffer, SizeU size, Byte value)
+{
+    const Byte *end = buffer + size;
+    __m128i needle = _mm_set1_epi8((char)value);
+
+    for (const Byte *block = (const Byte *)((SizeU)buffer & ~(SizeU)15); block < end; block += 16) {
+        Int32U mask = (Int32U)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i *)block), needle));
+        mask = noc_memory_mask_block(mask, block, 16, buffer, end);
+
+        if (mask) {
+            return block + noc_memory_bit_scan_forward(mask);
+        }
+    }
+
+    return NULL;
+}
+
+NOC_MEMORY_TARGET_AVX2 static const Byte *
+noc_memory_find_avx2(const Byte *buffer, SizeU size, Byte value)
+{
+    const Byte *end = buffer + size;
+    __m256i needle = _mm256_set1_epi8((char)value);
+
+    const Byte *block = (const Byte *)((SizeU)buffer & ~(SizeU)31);
+
+    Int32U mask = (Int32U)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256((const __m256i *)block), needle));
+    mask = noc_memory_mask_block(mask, block, 32, buffer, end);
+
+    if (mask) {
+        return block + noc_memory_bit_scan_forward(mask);
+    }
+
+    // NOTE(gr3yknigh1): Two blocks per iteration, while both are inside of the buffer. [2026/10/17]
+    for (block += 32; block + 64 <= end; block += 64) {
+        __m256i a = _mm256_cmpeq_epi8(_mm256_load_si256((const __m256i *)block), needle);
+        __m256i b = _mm256_cmpeq_epi8(_mm256_load_si256((const __m256i *)(block + 32)), needle);
+        __m256i any = _mm256_or_si256(a, b);
+
+        if (!_mm256_testz_si256(any, any)) {
+            mask = (Int32U)_mm256_movemask_epi8(a);
+            if (mask) {
+                return block + noc_memory_bit_scan_forward(mask);
+            }
+            return block + 32 + noc_memory_bit_scan_forward((Int32U)_mm256_movemask_epi8(b));
+        }
+    }
+
+    for (; block < end; block += 32) {
+        mask = (Int32U)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256((const __m256i *)block), needle));
+        mask = noc_memory_mask_block(mask, block, 32, buffer, end);
+
+        if (mask) {
+            return block + noc_memory_bit_scan_forward(mask);
+        }
+    }
+
+    return NULL;
+}
+
+static const Byte *
+noc_memory_find_last_sse2(const Byte *buffer, SizeU size, Byte value)
+{
+    const Byte *end = buffer + size;
+    __m128i needle = _mm_set1_epi8((char)value);
+
+    for (const Byte *block = (const Byte *)((SizeU)(end - 1) & ~(SizeU)15); block + 16 > buffer; block -= 16) {
+        Int32U mask = (Int32U)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i *)block), needle));
+        mask = noc_memory_mask_block(mask, block, 16, buffer, end);
+
+        if (mask) {
+            return block + noc_memory_bit_scan_reverse(mask);
+        }
+    }
+
+    return NULL;
+}
+
+NOC_MEMORY_TARGET_AVX2 static const Byte *
+noc_memory_find_last_avx2(const Byte *buffer, SizeU size, Byte value)
+{
+    const Byte *end = buffer + size;
+    __m256i needle = _mm256_set1_epi8((char)value);
+
+    for (const Byte *block = (const Byte *)((SizeU)(end - 1) & ~(SizeU)31); block + 32 > buffer; block -= 32) {
+        Int32U mask = (Int32U)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256((const __m256i *)block), needle));
+        mask = noc_memory_mask_block(mask, block, 32, buffer, end);
+
+        if (mask) {
+            return block + noc_memory_bit_scan_reverse(mask);
+        }
+    }
+
+    return NULL;
+}
+
+static const Byte *
+noc_memory_find_any_sse2(const Byte *buffer, SizeU size, const Byte *values, SizeU values_count)
+{
+    const Byte *end = buffer + size;
+
+    __m128i needles[NOC_MEMORY_FIND_ANY_SIMD_LIMIT];
+    for (SizeU value_index = 0; value_index < values_count; ++value_index) {
+        needles[value_index] = _mm_set1_epi8((char)values[value_index]);
+    }
+
+    for (const Byte *block = (const Byte *)((SizeU)buffer & ~(SizeU)15); block < end; block += 16) {
+        __m128i data = _mm_load_si128((const __m128i *)block);
+        __m128i matches = _mm_cmpeq_epi8(data, needles[0]);
+
+        for (SizeU value_index = 1; value_index < values_count; ++value_index) {
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi8(data, needles[value_index]));
+        }
+
+        Int32U mask = noc_memory_mask_block((Int32U)_mm_movemask_epi8(matches), block, 16, buffer, end);
+        if (mask) {
+            return block + noc_memory_bit_scan_forward(mask);
+        }
+    }
+
+    return NULL;
+}
+
+NOC_MEMORY_TARGET_AVX2 static const Byte *
+noc_memory_find_any_avx2(const Byte *buffer, SizeU size, const Byte *values, SizeU values_count)
+{
+    const Byte *end = buffer + size;
+
+    __m256i needles[NOC_MEMORY_FIND_ANY_SIMD_LIMIT];
+    for (SizeU value_index = 0; value_index < values_count; ++value_index) {
+        needles[value_index] = _mm256_set1_epi8((char)values[value_index]);
+    }
+
+    for (const Byte *block = (const Byte *)((SizeU)buffer & ~(SizeU)31); block < end; block += 32) {
+        __m256i data = _mm256_load_si256((const __m256i *)block);
+        __m256i matches = _mm256_cmpeq_epi8(data, needles[0]);
+
+        for (SizeU value_index = 1; value_index < values_count; ++value_index) {
+            matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(data, needles[value_index]));
+        }
+
+        Int32U mask = noc_memory_mask_block((Int32U)_mm256_movemask_epi8(matches), block, 32, buffer, end);
+        if (mask) {
+            return block + noc_memory_bit_scan_forward(mask);
+        }
+    }
+
+    return NULL;
+}
+
+//
+// NOTE(gr3yknigh1): Compares first and last bytes of the needle at each position of the block, and checks the rest
+// only for candidates. Loads are unaligned here, so only positions, which whole vector fits, are checked with
+// SIMD. [2026/10/17]
+//
+static const Byte *
+noc_memory_find_substring_sse2(const Byte *haystack, SizeU haystack_size, const Byte *needle, SizeU needle_size, SizeU *checked_count)
+{
+    __m128i first = _mm_set1_epi8((char)needle[0]);
+    __m128i last = _mm_set1_epi8((char)needle[needle_size - 1]);
+
+    SizeU position = 0;
+    for (; position + 16 + needle_size - 1 <= haystack_size; position += 16) {
+        __m128i block_first = _mm_loadu_si128((const __m128i *)(haystack + position));
+        __m128i block_last = _mm_loadu_si128((const __m128i *)(haystack + position + needle_size - 1));
+
+        Int32U mask = (Int32U)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last)));
+
+        while (mask) {
+            const Byte *candidate = haystack + position + noc_memory_bit_scan_forward(mask);
+            if (noc_memory_is_equals_sse2(candidate + 1, needle + 1, needle_size - 2)) {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+    }
+
+    *checked_count = position;
+    return NULL;
+}
+
+NOC_MEMORY_TARGET_AVX2 static const Byte *
+noc_memory_find_substring_avx2(const Byte *haystack, SizeU haystack_size, const Byte *needle, SizeU needle_size, SizeU *checked_count)
+{
+    __m256i first = _mm256_set1_epi8((char)needle[0]);
+    __m256i last = _mm256_set1_epi8((char)needle[needle_size - 1]);
+
+    SizeU position = 0;
+    for (; position + 32 + needle_size - 1 <= haystack_size; position += 32) {
+        __m256i block_first = _mm256_loadu_si256((const __m256i *)(haystack + position));
+        __m256i block_last = _mm256_loadu_si256((const __m256i *)(haystack + position + needle_size - 1));
+
+        Int32U mask = (Int32U)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(block_first, first), _mm256_cmpeq_epi8(block_last, last)));
+
+        while (mask) {
+            const Byte *candidate = haystack + position + noc_memory_bit_scan_forward(mask);
+            if (noc_memory_is_equals_avx2(candidate + 1, needle + 1, needle_size - 2)) {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+    }
+
+    *checked_count = position;
+    return NULL;
+}
+
+#endif // NOC_MEMORY_SIMD
+
 const void *
 noc_memory_find(const void *buffer, SizeU size, Byte value)
 {
+    if (size == 0) {
+        return NULL;
+    }
+
+#if NOC_MEMORY_SIMD
+    switch (noc_memory_load_simd_level()) {
+    case NOC_MEMORY_SIMD_LEVEL_AVX2:
+        return noc_memory_find_avx2((const Byte *)buffer, size, value);
+    case NOC_MEMORY_SIMD_LEVEL_SSE2:
+        return noc_memory_find_sse2((const Byte *)buffer, size, value);
+    case NOC_MEMORY_SIMD_LEVEL_NONE:
+        break;
+    }
+#endif
+
+    for (SizeU i = 0; i < size; ++i) {
+        if (((const Byte *)buffer)[i] == value) {
+            return (const Byte *)buffer + i;
+        }
+    }
+    return NULL;
+}
+
+const void *
+noc_memory_find_last(const void *buffer, SizeU size, Byte value)
+{
+    if (size == 0) {
+        return NULL;
+    }
+
+#if NOC_MEMORY_SIMD
+    switch (noc_memory_load_simd_level()) {
+    case NOC_MEMORY_SIMD_LEVEL_AVX2:
+        return noc_memory_find_last_avx2((const Byte *)buffer, size, value);
+    case NOC_MEMORY_SIMD_LEVEL_SSE2:
+        return noc_memory_find_last_sse2((const Byte *)buffer, size, value);
+    case NOC_MEMORY_SIMD_LEVEL_NONE:
+        break;
+    }
+#endif
+
+    for (SizeU i = size; i > 0; --i) {
+        if (((const Byte *)buffer)[i - 1] == value) {
+            return (const Byte *)buffer + i - 1;
+        }
+    }
+    return NULL;
+}
+
+const void *
+noc_memory_find_any(const void *buffer, SizeU size, const Byte *values, SizeU values_count)
+{
+    if (size == 0 || values_count == 0) {
+        return NULL;
+    }
+
+    if (values_count == 1) {
+        return noc_memory_find(buffer, size, values[0]);
+    }
+
+#if NOC_MEMORY_SIMD
+    if (values_count <= NOC_MEMORY_FIND_ANY_SIMD_LIMIT) {
+        switch (noc_memory_load_simd_level()) {
+        case NOC_MEMORY_SIMD_LEVEL_AVX2:
+            return noc_memory_find_any_avx2((const Byte *)buffer, size, values, values_count);
+        case NOC_MEMORY_SIMD_LEVEL_SSE2:
+            return noc_memory_find_any_sse2((const Byte *)buffer, size, values, values_count);
+        case NOC_MEMORY_SIMD_LEVEL_NONE:
+            break;
+        }
+    }
+#endif
+
+    Int32U table[256 / 32] = {0};
+    for (SizeU value_index = 0; value_index < values_count; ++value_index) {
+        table[values[value_index] / 32] |= 1U << (values[value_index] % 32);
+    }
+
     for (SizeU i = 0; i < size; ++i) {
-        if (((Byte *)buffer)[i] == value) {
-            return buffer;
+        Byte byte = ((const Byte *)buffer)[i];
+        if (table[byte / 32] & (1U << (byte % 32))) {
+            return (const Byte *)buffer + i;
         }
     }
     return NULL;
 }
 
+const void *
+noc_memory_find_substring(const void *haystack, SizeU haystack_size, const void *needle, SizeU needle_size)
+{
+    if (needle_size == 0) {
+        return haystack;
+    }
+
+    if (needle_size > haystack_size) {
+        return NULL;
+    }
+
+    if (needle_size == 1) {
+        return noc_memory_find(haystack, haystack_size, ((const Byte *)needle)[0]);
+    }
+
+    SizeU position = 0;
+
+#if NOC_MEMORY_SIMD
+    const Byte *found = NULL;
+
+    switch (noc_memory_load_simd_level()) {
+    case NOC_MEMORY_SIMD_LEVEL_AVX2:
+        found = noc_memory_find_substring_avx2((const Byte *)haystack, haystack_size, (const Byte *)needle, needle_size, &position);
+        break;
+    case NOC_MEMORY_SIMD_LEVEL_SSE2:
+        found = noc_memory_find_substring_sse2((const Byte *)haystack, haystack_size, (const Byte *)needle, needle_size, &position);
+        break;
+    case NOC_MEMORY_SIMD_LEVEL_NONE:
+        break;
+    }
+
+    if (found != NULL) {
+        return found;
+    }
+#endif
+
+    // NOTE(gr3yknigh1): Rest of positions (or all of them, if there is no SIMD). [2026/10/17]
+    const Byte *last_position = (const Byte *)haystack + haystack_size - needle_size;
+
+    for (const Byte *candidate = (const Byte *)haystack + position; candidate <= last_position; ++candidate) {
+        candidate = (const Byte *)noc_memory_find(candidate, (SizeU)(last_position - candidate) + 1, ((const Byte *)needle)[0]);
+
+        if (candidate == NULL) {
+            break;
+        }
+
+        if (noc_memory_is_equals(candidate + 1, (const Byte *)needle + 1, needle_size - 1)) {
+            return candidate;
+        }
+    }
+
+    return NULL;
+}
+
 SizeU
 noc_align_to_page_size(SizeU size)
 {
@@ -1,6 +1,8 @@
 
-#include <unistd.h>  // getpagesize
+#include <unistd.h>  // getpagesize, close
+#include <fcntl.h>  // open
 #include <sys/mman.h>  // mmap, munmap
+#include <sys/stat.h>  // fstat
 
 #include <netinet/in.h> // ...
 #include <netdb.h>
@@ -19,8 +21,6 @@ typedef struct NOC_Native_Socket {
     int descriptor;
 } NOC_Native_Socket;
 
-static NOC_Native_Net_State global_native_net_state;
-
 
 SizeU
 noc_get_page_size(void)
@@ -46,6 +46,68 @@ noc_native_free(void *data, SizeU size)
     return result == 0;
 }
 
+NOC_NODISCARD void *
+noc_native_reserve(SizeU size)
+{
+    void *data = mmap(NULL, size, PROT_NONE, MAP_ANONYMOUS | MAP_PRIVATE | MAP_NORESERVE, -1, 0);
+    if (data == MAP_FAILED) {
+        return NULL;
+    }
+    return data;
+}
+
+NOC_NODISCARD bool
+noc_native_commit(void *data, SizeU size)
+{
+    int result = mprotect(data, size, PROT_READ | PROT_WRITE);
+    return result == 0;
+}
+
+NOC_NODISCARD bool
+noc_native_decommit(void *data, SizeU size)
+{
+    // NOTE(gr3yknigh1): MADV_DONTNEED drops the pages, so next commit gives zeroed memory [2026/10/17]
+    if (madvise(data, size, MADV_DONTNEED) != 0) {
+        return false;
+    }
+
+    int result = mprotect(data, size, PROT_NONE);
+    return result == 0;
+}
+
+NOC_NODISCARD void *
+noc_native_map_file(Str8Z path, SizeU *size)
+{
+    int descriptor = open(path, O_RDONLY);
+    if (descriptor < 0) {
+        return NULL;
+    }
+
+    struct stat status;
+    void *data = MAP_FAILED;
+
+    if (fstat(descriptor, &status) == 0 && status.st_size > 0) {
+        data = mmap(NULL, (SizeU)status.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, descriptor, 0);
+    }
+
+    // NOTE(gr3yknigh1): Mapping keeps reference to the file, descriptor isn't needed anymore [2026/10/17]
+    close(descriptor);
+
+    if (data == MAP_FAILED) {
+        return NULL;
+    }
+
+    *size = (SizeU)status.st_size;
+    return data;
+}
+
+NOC_NODISCARD bool
+noc_native_unmap_file(void *data, SizeU size)
+{
+    int result = munmap(data, size);
+    return result == 0;
+}
+
 NOC_NORETURN void
 noc_exit_process(Int32S exit_code)
 {
@@ -127,7 +189,7 @@ noc_native_socket_recv(NOC_Native_Socket *socket, Byte *buffer, SizeU capacity)
 	    break;
 	}
 
-	if (result == space_left) {
+	if ((SizeU)result == space_left) {
 	    // TODO(gr3yknigh1): reallocate! [2025/05/31]
 	    NOC_DIE_M("Reallocation of the buffer isn't implemented on socket recv.");
 	}
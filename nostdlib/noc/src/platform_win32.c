@@ -69,8 +69,11 @@ noc_native_allocate(SizeU size)
 NOC_NODISCARD bool
 noc_native_free(void *data, SizeU size)
 {
-    if (VirtualFree(data, size, MEM_RELEASE) == 0) {
-        //                      ^^^^^^^^^^^
+    // NOTE(gr3yknigh1): MEM_RELEASE requires zero size, whole reserved range is released [2026/10/17]
+    NOC_UNUSED(size);
+
+    if (VirtualFree(data, 0, MEM_RELEASE) == 0) {
+        //                   ^^^^^^^^^^^
         // NOTE(ilya.a): Might be more reasonable to use MEM_DECOMMIT instead
         // for MEM_RELEASE. Because in that case it's will be keep buffer
         // around, until we use it again. P.S. Also will be good to try protect
@@ -81,6 +84,65 @@ noc_native_free(void *data, SizeU size)
     return true;
 }
 
+NOC_NODISCARD void *
+noc_native_reserve(SizeU size)
+{
+    void *data = VirtualAlloc(NULL, size, MEM_RESERVE, PAGE_NOACCESS);
+    return data;
+}
+
+NOC_NODISCARD bool
+noc_native_commit(void *data, SizeU size)
+{
+    void *result = VirtualAlloc(data, size, MEM_COMMIT, PAGE_READWRITE);
+    return result != NULL;
+}
+
+NOC_NODISCARD bool
+noc_native_decommit(void *data, SizeU size)
+{
+    return VirtualFree(data, size, MEM_DECOMMIT) != 0;
+}
+
+NOC_NODISCARD void *
+noc_native_map_file(Str8Z path, SizeU *size)
+{
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return NULL;
+    }
+
+    void *data = NULL;
+
+    LARGE_INTEGER file_size = {0};
+    if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0) {
+        HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+
+        if (mapping != NULL) {
+            data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+
+            // NOTE(gr3yknigh1): View keeps mapping object alive [2026/10/17]
+            CloseHandle(mapping);
+        }
+    }
+
+    CloseHandle(file);
+
+    if (data == NULL) {
+        return NULL;
+    }
+
+    *size = (SizeU)file_size.QuadPart;
+    return data;
+}
+
+NOC_NODISCARD bool
+noc_native_unmap_file(void *data, SizeU size)
+{
+    NOC_UNUSED(size);
+    return UnmapViewOfFile(data) != 0;
+}
+
 NOC_NORETURN void
 noc_exit_process(Int32S exit_code)
 {
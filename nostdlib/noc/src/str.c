@@ -1,10 +1,26 @@
 #include "noc/str.h"
 
 #include "noc/noc.h"
+#include "noc/detect.h"
 
+#include <ctype.h>  // isprint
 #include <stdarg.h> // va_list va_start va_end va_arg
 #include <stdlib.h> // calloc
 
+#if NOC_DETECT_ARCH_X86_64
+    #define NOC_STR_SIMD 1
+
+    #include <emmintrin.h>
+
+    #if NOC_DETECT_COMPILER_MSVC
+        #include <intrin.h>
+    #endif
+
+#else
+    #define NOC_STR_SIMD 0
+
+#endif
+
 static void insert_and_shift(Char8 *str, Str8Z src, long src_index, long str_index);
 
 #define _HANDLE_LENGTH_MODIFIER(LENGTH_MOD, HANDLE_16_EXPR, HANDLE_32_EXPR, HANDLE_64_EXPR)               \
@@ -57,12 +73,12 @@ static Int8U fmt_sign_precede_charcount(const Format_Context *ctx, bool is_posit
 static bool fmt_is_justification_or_sign_char(Char8 c);
 static bool fmt_is_length_modifier_char(Char8 c);
 static bool fmt_is_precision_char(Char8 c);
-static Int32U fmt_handle_sign_precede(Format_Context *ctx, Byte *buffer,
+static Int32U fmt_handle_sign_precede(Format_Context *ctx, Char8 *buffer,
 				bool is_positive);
 
 static Int32U fmt_parse_i32_while_digit(const Char8 *s, Int32S *out_num);
 static Int32U fmt_count_while_digit(const Char8 *s);
-static Int32U fmt_emmit_char_in_buffer(Byte *write_buffer, Int32U count, Char8 c);
+static Int32U fmt_emmit_char_in_buffer(Char8 *write_buffer, Int32U count, Char8 c);
 
 static void sprintf_Int16S (Format_Context *ctx, Char8 **buffer_write_ptr, Int16S value);
 static void sprintf_Int32S (Format_Context *ctx, Char8 **buffer_write_ptr, Int32S value);
@@ -70,7 +86,6 @@ static void sprintf_Int64S (Format_Context *ctx, Char8 **buffer_write_ptr, Int64
 static void sprintf_Int16U (Format_Context *ctx, Char8 **buffer_write_ptr, Int16U value);
 static void sprintf_Int32U (Format_Context *ctx, Char8 **buffer_write_ptr, Int32U value);
 static void sprintf_Int64U (Format_Context *ctx, Char8 **buffer_write_ptr, Int64U value);
-static void sprintf_Float32(Format_Context *ctx, Char8 **buffer_write_ptr, Float32 value);
 static void sprintf_Float64(Format_Context *ctx, Char8 **buffer_write_ptr, Float64 value);
 static void sprintf_char   (Format_Context *ctx, Char8 **buffer_write_ptr, Char8 value);
 static void sprintf_cstr   (Format_Context *ctx, Char8 **buffer_write_ptr, Str8Z value);
@@ -176,9 +191,63 @@ noc_str8z_copy(Char8 *destination, Str8Z source)
     return result;
 }
 
+//
+// NOTE(gr3yknigh1): String routines use only SSE2, which is baseline of x86-64, so they don't go through dispatch of
+// `noc/memory.h` (strings here are mostly short paths and names, where call of dispatcher is noticeable). [2026/10/17]
+//
+
+#if NOC_STR_SIMD
+
+static inline Int32U
+noc_str_bit_scan_forward(Int32U mask)
+{
+    #if NOC_DETECT_COMPILER_MSVC
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return (Int32U)index;
+    #else
+        return (Int32U)__builtin_ctz(mask);
+    #endif
+}
+
+static inline __m128i
+noc_str_compare_zero(__m128i block, SizeU element_size)
+{
+    switch (element_size) {
+    case 2:  return _mm_cmpeq_epi16(block, _mm_setzero_si128());
+    case 4:  return _mm_cmpeq_epi32(block, _mm_setzero_si128());
+    default: return _mm_cmpeq_epi8(block, _mm_setzero_si128());
+    }
+}
+
+//
+// NOTE(gr3yknigh1): Scans aligned blocks, first of which is masked to start of the string. Aligned load never crosses
+// page boundary, so reading past the terminator can't fault. String should be aligned to its element. [2026/10/17]
+//
+static SizeU
+noc_str_find_terminator_sse2(const void *s, SizeU element_size)
+{
+    const Byte *block = (const Byte *)((SizeU)s & ~(SizeU)15);
+
+    Int32U mask = (Int32U)_mm_movemask_epi8(noc_str_compare_zero(_mm_load_si128((const __m128i *)block), element_size));
+    mask &= ~0U << ((const Byte *)s - block);
+
+    while (mask == 0) {
+        block += 16;
+        mask = (Int32U)_mm_movemask_epi8(noc_str_compare_zero(_mm_load_si128((const __m128i *)block), element_size));
+    }
+
+    return (SizeU)(block + noc_str_bit_scan_forward(mask) - (const Byte *)s) / element_size;
+}
+
+#endif // NOC_STR_SIMD
+
 SizeU
 noc_str8z_length(const Str8Z s)
 {
+#if NOC_STR_SIMD
+    return noc_str_find_terminator_sse2(s, sizeof(*s));
+#else
     const Char8 *cursor = s;
 
     while (*cursor != '\0') {
@@ -187,25 +256,172 @@ noc_str8z_length(const Str8Z s)
 
     SizeU result = cursor - s;
     return result;
+#endif
+}
+
+SizeU
+noc_str16z_length(const Int16U *s)
+{
+#if NOC_STR_SIMD
+    if (((SizeU)s & (sizeof(*s) - 1)) == 0) {
+        return noc_str_find_terminator_sse2(s, sizeof(*s));
+    }
+#endif
+
+    SizeU result = 0;
+    while (s[result] != 0) {
+        ++result;
+    }
+    return result;
 }
 
+SizeU
+noc_str32z_length(const Int32U *s)
+{
+#if NOC_STR_SIMD
+    if (((SizeU)s & (sizeof(*s) - 1)) == 0) {
+        return noc_str_find_terminator_sse2(s, sizeof(*s));
+    }
+#endif
+
+    SizeU result = 0;
+    while (s[result] != 0) {
+        ++result;
+    }
+    return result;
+}
+
+//
+// NOTE(gr3yknigh1): Length of strings is unknown, so 16 bytes are compared only if both loads stay within their
+// pages, otherwise it goes one byte at a time until the next page. [2026/10/17]
+//
+#define NOC_STR_PAGE_SIZE 4096
+
 bool
 noc_str8z_is_equals(const Str8Z a, const Str8Z b)
 {
+    if (a == NULL || b == NULL) {
+        return a == b;
+    }
+
     const Char8 *a_cursor = a;
     const Char8 *b_cursor = b;
-   
-    while (a_cursor != NULL && *a_cursor != 0 && b_cursor != NULL && *b_cursor != 0) {
+
+    for (;;) {
+#if NOC_STR_SIMD
+        if (((SizeU)a_cursor % NOC_STR_PAGE_SIZE) <= NOC_STR_PAGE_SIZE - 16 && ((SizeU)b_cursor % NOC_STR_PAGE_SIZE) <= NOC_STR_PAGE_SIZE - 16) {
+            __m128i a_block = _mm_loadu_si128((const __m128i *)a_cursor);
+            __m128i b_block = _mm_loadu_si128((const __m128i *)b_cursor);
+
+            Int32U different = ~(Int32U)_mm_movemask_epi8(_mm_cmpeq_epi8(a_block, b_block)) & 0xFFFF;
+            Int32U terminated = (Int32U)_mm_movemask_epi8(_mm_cmpeq_epi8(a_block, _mm_setzero_si128()));
+
+            if (different | terminated) {
+                Int32U index = noc_str_bit_scan_forward(different | terminated);
+                return a_cursor[index] == b_cursor[index];
+            }
+
+            a_cursor += 16;
+            b_cursor += 16;
+            continue;
+        }
+#endif
+
         if (*a_cursor != *b_cursor) {
             return false;
         }
 
-	a_cursor++;
-	b_cursor++;
+        if (*a_cursor == 0) {
+            return true;
+        }
+
+        a_cursor++;
+        b_cursor++;
     }
+}
 
-    if ((*a_cursor == 0 && *b_cursor != 0) || (*a_cursor != 0 && *b_cursor != 0)) {
-        return false;
+bool
+noc_str16_is_equals_str8(const Int16U *a, const Char8 *b, SizeU length)
+{
+    SizeU index = 0;
+
+#if NOC_STR_SIMD
+    if (length >= 16) {
+        for (;;) {
+            // NOTE(gr3yknigh1): Last block overlaps with previous one, instead of going through the scalar tail. [2026/10/17]
+            if (index + 16 > length) {
+                index = length - 16;
+            }
+
+            __m128i narrow = _mm_loadu_si128((const __m128i *)(b + index));
+            __m128i low = _mm_unpacklo_epi8(narrow, _mm_setzero_si128());
+            __m128i high = _mm_unpackhi_epi8(narrow, _mm_setzero_si128());
+
+            __m128i equals = _mm_and_si128(
+                _mm_cmpeq_epi16(low, _mm_loadu_si128((const __m128i *)(a + index))),
+                _mm_cmpeq_epi16(high, _mm_loadu_si128((const __m128i *)(a + index + 8))));
+
+            if (_mm_movemask_epi8(equals) != 0xFFFF) {
+                return false;
+            }
+
+            index += 16;
+            if (index >= length) {
+                return true;
+            }
+        }
+    }
+#endif
+
+    for (; index < length; ++index) {
+        if (a[index] != (Byte)b[index]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool
+noc_str32_is_equals_str8(const Int32U *a, const Char8 *b, SizeU length)
+{
+    SizeU index = 0;
+
+#if NOC_STR_SIMD
+    if (length >= 16) {
+        for (;;) {
+            if (index + 16 > length) {
+                index = length - 16;
+            }
+
+            __m128i narrow = _mm_loadu_si128((const __m128i *)(b + index));
+            __m128i low = _mm_unpacklo_epi8(narrow, _mm_setzero_si128());
+            __m128i high = _mm_unpackhi_epi8(narrow, _mm_setzero_si128());
+
+            __m128i equals = _mm_and_si128(
+                _mm_and_si128(
+                    _mm_cmpeq_epi32(_mm_unpacklo_epi16(low, _mm_setzero_si128()), _mm_loadu_si128((const __m128i *)(a + index))),
+                    _mm_cmpeq_epi32(_mm_unpackhi_epi16(low, _mm_setzero_si128()), _mm_loadu_si128((const __m128i *)(a + index + 4)))),
+                _mm_and_si128(
+                    _mm_cmpeq_epi32(_mm_unpacklo_epi16(high, _mm_setzero_si128()), _mm_loadu_si128((const __m128i *)(a + index + 8))),
+                    _mm_cmpeq_epi32(_mm_unpackhi_epi16(high, _mm_setzero_si128()), _mm_loadu_si128((const __m128i *)(a + index + 12)))));
+
+            if (_mm_movemask_epi8(equals) != 0xFFFF) {
+                return false;
+            }
+
+            index += 16;
+            if (index >= length) {
+                return true;
+            }
+        }
+    }
+#endif
+
+    for (; index < length; ++index) {
+        if (a[index] != (Byte)b[index]) {
+            return false;
+        }
     }
 
     return true;
@@ -332,14 +548,7 @@ noc_str8_view_is_equals(NOC_Str8_View a, NOC_Str8_View b)
         return false;
     }
 
-    // TODO(gr3yknigh1): Do vectorization [2025/01/03]
-    for (Int64U i = 0; i < a.length; ++i) {
-        if (a.data[i] != b.data[i]) {
-            return false;
-        }
-    }
-
-    return true;
+    return noc_memory_is_equals(a.data, b.data, a.length);
 }
 
 
@@ -592,9 +801,9 @@ fmt_is_precision_char(Char8 c)
 }
 
 static Int32U
-fmt_handle_sign_precede(Format_Context *ctx, Byte *buffer, bool is_positive)
+fmt_handle_sign_precede(Format_Context *ctx, Char8 *buffer, bool is_positive)
 {
-    Byte *buffer_write_ptr = buffer;
+    Char8 *buffer_write_ptr = buffer;
 
     if (ctx->sign_precede == SIGN_PRECEDE_FORCE && is_positive) {
         *buffer_write_ptr++ = '+';
@@ -641,7 +850,7 @@ fmt_parse_i32_while_digit(const Char8 *s, Int32S *out_num)
 }
 
 static Int32U
-fmt_emmit_char_in_buffer(Byte *write_buffer, Int32U count, Char8 c)
+fmt_emmit_char_in_buffer(Char8 *write_buffer, Int32U count, Char8 c)
 {
     for (Int32U i = 0; i < count; ++i) {
         *write_buffer++ = c;
@@ -662,7 +871,7 @@ NOC_DEFINE void
 noc_print_hex_dump_ex(void *buffer, SizeU buffer_size, FILE *output)
 {
     for (SizeU i = 0; i < buffer_size; i += 16) {
-        fprintf(output, "%06llx: ", i);
+        fprintf(output, "%06llx: ", (unsigned long long)i);
 
         for (SizeU j = 0; j < 16; j++) {
             if (i + j < buffer_size) {
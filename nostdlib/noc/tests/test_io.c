@@ -0,0 +1,260 @@
+#include <noc/check.h>
+
+#include <noc/io.h>
+#include <noc/memory.h>
+#include <noc/platform.h>
+
+#include <stdio.h> // fopen, fwrite, remove, snprintf
+
+#if defined(NOC_DETECT_PLATFORM_LINUX)
+    #include <dirent.h> // opendir, readdir, dirfd, closedir
+    #include <fcntl.h>  // open
+    #include <stdlib.h> // strtol
+    #include <string.h> // strcmp
+    #include <unistd.h> // dup, dup2, close, readlinkat
+#endif
+
+//
+// NOTE(gr3yknigh1): More files than io_uring queue has entries, so batch is split in chunks. Sizes cross the page
+// size, empty file included. [2026/10/17]
+//
+#define TEST_IO_FILES_COUNT 300
+#define TEST_IO_PATH_SIZE 64
+
+static char test_io_paths[TEST_IO_FILES_COUNT][TEST_IO_PATH_SIZE];
+
+static SizeU
+test_io_get_file_size(SizeU file_index)
+{
+    return (file_index * 37) % 9000;
+}
+
+static Byte
+test_io_get_byte(SizeU file_index, SizeU byte_index)
+{
+    return (Byte)(file_index * 7 + byte_index * 13);
+}
+
+static void
+test_io_write_files(void)
+{
+    for (SizeU file_index = 0; file_index < TEST_IO_FILES_COUNT; ++file_index) {
+        snprintf(test_io_paths[file_index], TEST_IO_PATH_SIZE, "test_io_%03u.bin", (unsigned)file_index);
+
+        FILE *file = fopen(test_io_paths[file_index], "wb");
+
+        for (SizeU byte_index = 0; byte_index < test_io_get_file_size(file_index); ++byte_index) {
+            fputc(test_io_get_byte(file_index, byte_index), file);
+        }
+
+        fclose(file);
+    }
+}
+
+static void
+test_io_remove_files(void)
+{
+    for (SizeU file_index = 0; file_index < TEST_IO_FILES_COUNT; ++file_index) {
+        remove(test_io_paths[file_index]);
+    }
+}
+
+static void
+test_io_run(NOC_TestCase *test_case, NOC_IO_Backend backend)
+{
+    NOC_IO_Queue *queue = noc_io_queue_make(backend);
+    NOC_TASSERT(test_case, queue != NULL);
+
+    static NOC_IO_Request requests[TEST_IO_FILES_COUNT];
+    noc_memory_zero(requests, sizeof(requests));
+
+    for (SizeU file_index = 0; file_index < TEST_IO_FILES_COUNT; ++file_index) {
+        requests[file_index].path = test_io_paths[file_index];
+    }
+
+    NOC_TASSERT(test_case, noc_io_get_file_sizes(queue, requests, TEST_IO_FILES_COUNT));
+
+    SizeU total_size = 0;
+
+    for (SizeU file_index = 0; file_index < TEST_IO_FILES_COUNT; ++file_index) {
+        NOC_TASSERT_EQ(test_case, requests[file_index].size, test_io_get_file_size(file_index));
+        total_size += requests[file_index].size;
+    }
+
+    Byte *storage = (Byte *)noc_native_allocate(total_size);
+    NOC_TASSERT(test_case, storage != NULL);
+
+    Byte *cursor = storage;
+
+    for (SizeU file_index = 0; file_index < TEST_IO_FILES_COUNT; ++file_index) {
+        requests[file_index].buffer = cursor;
+        requests[file_index].capacity = requests[file_index].size;
+        cursor += requests[file_index].size;
+    }
+
+    NOC_TASSERT(test_case, noc_io_read_files(queue, requests, TEST_IO_FILES_COUNT));
+
+    for (SizeU file_index = 0; file_index < TEST_IO_FILES_COUNT; ++file_index) {
+        NOC_IO_Request *request = requests + file_index;
+        NOC_TASSERT_EQ(test_case, request->size, test_io_get_file_size(file_index));
+
+        for (SizeU byte_index = 0; byte_index < request->size; ++byte_index) {
+            NOC_TASSERT_EQ(test_case, request->buffer[byte_index], test_io_get_byte(file_index, byte_index));
+        }
+    }
+
+    // NOTE(gr3yknigh1): Capacity bounds the read, file end bounds the size. [2026/10/17]
+    requests[0] = requests[TEST_IO_FILES_COUNT - 1];
+    requests[0].capacity = 100;
+    requests[1] = requests[TEST_IO_FILES_COUNT - 2];
+    requests[1].capacity += 100;
+    requests[2].path = "test_io_missing.bin";
+
+    NOC_TEXPECT(test_case, !noc_io_read_files(queue, requests, 3));
+    NOC_TEXPECT(test_case, requests[0].size == 100);
+    NOC_TEXPECT(test_case, requests[0].error == 0);
+    NOC_TEXPECT(test_case, requests[1].size == test_io_get_file_size(TEST_IO_FILES_COUNT - 2));
+    NOC_TEXPECT(test_case, requests[1].error == 0);
+    NOC_TEXPECT(test_case, requests[2].error != 0);
+
+    NOC_TEXPECT(test_case, !noc_io_get_file_sizes(queue, requests + 2, 1));
+    NOC_TEXPECT(test_case, requests[2].error != 0);
+
+    bool is_freed = noc_native_free(storage, total_size);
+    NOC_TEXPECT(test_case, is_freed);
+
+    noc_io_queue_destroy(queue);
+}
+
+static void
+test_io_threads(NOC_TestCase *test_case)
+{
+    test_io_run(test_case, NOC_IO_BACKEND_THREADS);
+}
+
+static void
+test_io_default(NOC_TestCase *test_case)
+{
+    test_io_run(test_case, NOC_IO_BACKEND_DEFAULT);
+}
+
+#if defined(NOC_DETECT_PLATFORM_LINUX)
+
+//
+// NOTE(gr3yknigh1): Ring descriptor is replaced with `/dev/null` for one call, so io_uring submission fails. Failed
+// call should leave no descriptors open and no requests in the ring, next call on the same queue reads other files
+// correctly. [2026/10/17]
+//
+#define TEST_IO_FAILURE_FILES_COUNT 16
+
+static SizeU
+test_io_count_descriptors(int *ring_descriptor)
+{
+    SizeU count = 0;
+
+    DIR *directory = opendir("/proc/self/fd");
+
+    if (directory == NULL) {
+        return 0;
+    }
+
+    for (struct dirent *entry = readdir(directory); entry != NULL; entry = readdir(directory)) {
+        char target[TEST_IO_PATH_SIZE];
+        ssize_t target_size = readlinkat(dirfd(directory), entry->d_name, target, TEST_IO_PATH_SIZE - 1);
+
+        if (target_size < 0) {
+            continue;
+        }
+
+        target[target_size] = 0;
+        count += 1;
+
+        if (ring_descriptor != NULL && strcmp(target, "anon_inode:[io_uring]") == 0) {
+            *ring_descriptor = (int)strtol(entry->d_name, NULL, 10);
+        }
+    }
+
+    closedir(directory);
+    return count;
+}
+
+static void
+test_io_uring_failure(NOC_TestCase *test_case)
+{
+    NOC_IO_Queue *queue = noc_io_queue_make(NOC_IO_BACKEND_IO_URING);
+    NOC_TASSERT(test_case, queue != NULL);
+
+    // NOTE(gr3yknigh1): Kernel may have io_uring disabled, then there is nothing to check. [2026/10/17]
+    if (noc_io_queue_get_backend(queue) != NOC_IO_BACKEND_IO_URING) {
+        noc_io_queue_destroy(queue);
+        return;
+    }
+
+    int ring_descriptor = -1;
+    SizeU descriptors_count = test_io_count_descriptors(&ring_descriptor);
+    NOC_TASSERT(test_case, ring_descriptor >= 0);
+
+    static Byte storage[2 * TEST_IO_FAILURE_FILES_COUNT][9000];
+    static NOC_IO_Request requests[2 * TEST_IO_FAILURE_FILES_COUNT];
+    noc_memory_zero(requests, sizeof(requests));
+
+    for (SizeU file_index = 0; file_index < 2 * TEST_IO_FAILURE_FILES_COUNT; ++file_index) {
+        requests[file_index].path = test_io_paths[file_index];
+        requests[file_index].buffer = storage[file_index];
+        requests[file_index].capacity = test_io_get_file_size(file_index);
+    }
+
+    int saved_ring_descriptor = dup(ring_descriptor);
+    int null_descriptor = open("/dev/null", O_RDONLY | O_CLOEXEC);
+    NOC_TASSERT(test_case, saved_ring_descriptor >= 0 && null_descriptor >= 0);
+
+    dup2(null_descriptor, ring_descriptor);
+    bool is_read = noc_io_read_files(queue, requests, TEST_IO_FAILURE_FILES_COUNT);
+    dup2(saved_ring_descriptor, ring_descriptor);
+
+    close(null_descriptor);
+    close(saved_ring_descriptor);
+
+    NOC_TEXPECT(test_case, !is_read);
+    NOC_TEXPECT(test_case, test_io_count_descriptors(NULL) == descriptors_count);
+
+    NOC_IO_Request *next_requests = requests + TEST_IO_FAILURE_FILES_COUNT;
+    NOC_TEXPECT(test_case, noc_io_read_files(queue, next_requests, TEST_IO_FAILURE_FILES_COUNT));
+
+    for (SizeU request_index = 0; request_index < TEST_IO_FAILURE_FILES_COUNT; ++request_index) {
+        SizeU file_index = TEST_IO_FAILURE_FILES_COUNT + request_index;
+        NOC_IO_Request *request = next_requests + request_index;
+        NOC_TASSERT_EQ(test_case, request->size, test_io_get_file_size(file_index));
+
+        for (SizeU byte_index = 0; byte_index < request->size; ++byte_index) {
+            NOC_TASSERT_EQ(test_case, request->buffer[byte_index], test_io_get_byte(file_index, byte_index));
+        }
+    }
+
+    NOC_TEXPECT(test_case, test_io_count_descriptors(NULL) == descriptors_count);
+
+    noc_io_queue_destroy(queue);
+}
+
+#endif // NOC_DETECT_PLATFORM_LINUX
+
+int
+main(void)
+{
+    test_io_write_files();
+
+    NOC_TestSuite *suite = NOC_TestSuiteMake("IO");
+
+    NOC_TestSuiteAddCase(suite, "Threads", test_io_threads);
+    NOC_TestSuiteAddCase(suite, "Default", test_io_default);
+#if defined(NOC_DETECT_PLATFORM_LINUX)
+    NOC_TestSuiteAddCase(suite, "IOUringFailure", test_io_uring_failure);
+#endif
+
+    int exit_code = NOC_TestSuiteExecute(suite);
+    NOC_TestSuiteDestroy(suite);
+
+    test_io_remove_files();
+
+    return exit_code;
+}
@@ -0,0 +1,229 @@
+#include <noc/check.h>
+
+#include <noc/memory.h>
+#include <noc/str.h>
+
+//
+// NOTE(gr3yknigh1): Strings are placed at every offset of the page-aligned storage, so each SIMD kernel goes through
+// its head, aligned body and tail. Last cases put strings right before the page boundary. [2026/10/17]
+//
+#define TEST_STR_PAGE_SIZE 4096
+#define TEST_STR_MAX_LENGTH 300
+#define TEST_STR_MAX_OFFSET 33
+
+static Byte test_str_storage[3 * TEST_STR_PAGE_SIZE];
+
+static Byte *
+test_str_get_page(void)
+{
+    return (Byte *)NOC_ALIGN_TO((SizeU)test_str_storage, TEST_STR_PAGE_SIZE);
+}
+
+static void
+test_str8z_length(NOC_TestCase *test_case)
+{
+    Char8 *page = (Char8 *)test_str_get_page();
+
+    for (SizeU offset = 0; offset < TEST_STR_MAX_OFFSET; ++offset) {
+        for (SizeU length = 0; length < TEST_STR_MAX_LENGTH; ++length) {
+            noc_memory_set(page, TEST_STR_PAGE_SIZE, 'x');
+            page[offset + length] = 0;
+
+            NOC_TASSERT_EQ(test_case, noc_str8z_length(page + offset), length);
+        }
+    }
+
+    noc_memory_set(page, TEST_STR_PAGE_SIZE, 'x');
+    page[TEST_STR_PAGE_SIZE - 1] = 0;
+
+    for (SizeU length = 0; length < TEST_STR_MAX_LENGTH; ++length) {
+        NOC_TASSERT_EQ(test_case, noc_str8z_length(page + TEST_STR_PAGE_SIZE - 1 - length), length);
+    }
+}
+
+static void
+test_str16z_length(NOC_TestCase *test_case)
+{
+    Int16U *page = (Int16U *)test_str_get_page();
+    SizeU page_count = TEST_STR_PAGE_SIZE / sizeof(*page);
+
+    for (SizeU offset = 0; offset < TEST_STR_MAX_OFFSET; ++offset) {
+        for (SizeU length = 0; length < TEST_STR_MAX_LENGTH; ++length) {
+            for (SizeU index = 0; index < page_count; ++index) {
+                // NOTE(gr3yknigh1): Code units with zero low or high byte must not be taken as terminator. [2026/10/17]
+                page[index] = index % 2 ? 0x0100 : 0x0041;
+            }
+            page[offset + length] = 0;
+
+            NOC_TASSERT_EQ(test_case, noc_str16z_length(page + offset), length);
+        }
+    }
+}
+
+static void
+test_str32z_length(NOC_TestCase *test_case)
+{
+    Int32U *page = (Int32U *)test_str_get_page();
+    SizeU page_count = TEST_STR_PAGE_SIZE / sizeof(*page);
+
+    for (SizeU offset = 0; offset < TEST_STR_MAX_OFFSET; ++offset) {
+        for (SizeU length = 0; length < TEST_STR_MAX_LENGTH && offset + length < page_count; ++length) {
+            for (SizeU index = 0; index < page_count; ++index) {
+                page[index] = index % 2 ? 0x00010000 : 0x00000041;
+            }
+            page[offset + length] = 0;
+
+            NOC_TASSERT_EQ(test_case, noc_str32z_length(page + offset), length);
+        }
+    }
+}
+
+static void
+test_memory_is_equals(NOC_TestCase *test_case)
+{
+    Byte *a = test_str_get_page();
+    Byte *b = a + TEST_STR_PAGE_SIZE;
+
+    NOC_Memory_SIMD_Level supported_level = noc_memory_get_simd_level();
+
+    for (Int32S level = NOC_MEMORY_SIMD_LEVEL_NONE; level <= (Int32S)supported_level; ++level) {
+        noc_memory_set_simd_level((NOC_Memory_SIMD_Level)level);
+
+        for (SizeU offset = 0; offset < TEST_STR_MAX_OFFSET; offset += 3) {
+            for (SizeU size = 0; size < TEST_STR_MAX_LENGTH; ++size) {
+                for (SizeU index = 0; index < size; ++index) {
+                    a[index] = (Byte)(index * 7);
+                    b[offset + index] = (Byte)(index * 7);
+                }
+
+                NOC_TASSERT(test_case, noc_memory_is_equals(a, b + offset, size));
+
+                for (SizeU index = 0; index < size; ++index) {
+                    b[offset + index] ^= 0x80;
+                    NOC_TASSERT(test_case, !noc_memory_is_equals(a, b + offset, size));
+                    b[offset + index] ^= 0x80;
+                }
+            }
+        }
+    }
+
+    noc_memory_set_simd_level(supported_level);
+}
+
+static void
+test_str8z_is_equals(NOC_TestCase *test_case)
+{
+    NOC_TEXPECT(test_case, noc_str8z_is_equals("", ""));
+    NOC_TEXPECT(test_case, noc_str8z_is_equals("assets/shaders/basic.glsl", "assets/shaders/basic.glsl"));
+    NOC_TEXPECT(test_case, !noc_str8z_is_equals("assets/shaders/basic.glsl", "assets/shaders/basic.gls"));
+    NOC_TEXPECT(test_case, !noc_str8z_is_equals("assets/shaders/basic.gls", "assets/shaders/basic.glsl"));
+    NOC_TEXPECT(test_case, !noc_str8z_is_equals("assets/shaders/basic.glsl", "assets/shaders/basiC.glsl"));
+    NOC_TEXPECT(test_case, !noc_str8z_is_equals("", "a"));
+    NOC_TEXPECT(test_case, !noc_str8z_is_equals("a", ""));
+
+    // NOTE(gr3yknigh1): Strings which end right before page boundary, so blocks are compared only while whole load
+    // stays in page. [2026/10/17]
+    Char8 *page = (Char8 *)test_str_get_page();
+    Char8 *a_end = page + TEST_STR_PAGE_SIZE;
+    Char8 *b_end = page + 2 * TEST_STR_PAGE_SIZE;
+
+    for (SizeU length = 0; length < 100; ++length) {
+        for (SizeU shift = 0; shift < 20; ++shift) {
+            Char8 *a = a_end - length - 1;
+            Char8 *b = b_end - length - 1 - shift;
+
+            for (SizeU index = 0; index < length; ++index) {
+                a[index] = b[index] = (Char8)('a' + index % 26);
+            }
+            a[length] = b[length] = 0;
+
+            NOC_TASSERT(test_case, noc_str8z_is_equals(a, b));
+
+            if (length > 0) {
+                b[length - 1] = '_';
+                NOC_TASSERT(test_case, !noc_str8z_is_equals(a, b));
+                NOC_TASSERT(test_case, !noc_str8z_is_equals(a, b + 1));
+            }
+        }
+    }
+}
+
+static void
+test_str16_is_equals_str8(NOC_TestCase *test_case)
+{
+    Int16U *wide = (Int16U *)test_str_get_page();
+    Char8 *narrow = (Char8 *)(test_str_get_page() + TEST_STR_PAGE_SIZE);
+
+    for (SizeU length = 0; length < TEST_STR_MAX_LENGTH; ++length) {
+        for (SizeU index = 0; index < length; ++index) {
+            narrow[index] = (Char8)(0x20 + index % 0x70);
+            wide[index] = (Int16U)(0x20 + index % 0x70);
+        }
+
+        NOC_TASSERT(test_case, noc_str16_is_equals_str8(wide, narrow, length));
+
+        for (SizeU index = 0; index < length; ++index) {
+            Int16U code_unit = wide[index];
+
+            // NOTE(gr3yknigh1): Same low byte, but not ASCII. [2026/10/17]
+            wide[index] = (Int16U)(code_unit | 0x0100);
+            NOC_TASSERT(test_case, !noc_str16_is_equals_str8(wide, narrow, length));
+
+            wide[index] = (Int16U)(code_unit + 1);
+            NOC_TASSERT(test_case, !noc_str16_is_equals_str8(wide, narrow, length));
+
+            wide[index] = code_unit;
+        }
+    }
+
+    narrow[0] = (Char8)0xC3;
+    wide[0] = 0x00C3;
+    NOC_TEXPECT(test_case, noc_str16_is_equals_str8(wide, narrow, 1));
+}
+
+static void
+test_str32_is_equals_str8(NOC_TestCase *test_case)
+{
+    Int32U *wide = (Int32U *)test_str_get_page();
+    Char8 *narrow = (Char8 *)(test_str_get_page() + 2 * TEST_STR_PAGE_SIZE);
+
+    for (SizeU length = 0; length < TEST_STR_MAX_LENGTH; ++length) {
+        for (SizeU index = 0; index < length; ++index) {
+            narrow[index] = (Char8)(0x20 + index % 0x70);
+            wide[index] = (Int32U)(0x20 + index % 0x70);
+        }
+
+        NOC_TASSERT(test_case, noc_str32_is_equals_str8(wide, narrow, length));
+
+        for (SizeU index = 0; index < length; ++index) {
+            Int32U code_unit = wide[index];
+
+            wide[index] = code_unit | 0x00010000;
+            NOC_TASSERT(test_case, !noc_str32_is_equals_str8(wide, narrow, length));
+
+            wide[index] = code_unit | 0x0100;
+            NOC_TASSERT(test_case, !noc_str32_is_equals_str8(wide, narrow, length));
+
+            wide[index] = code_unit;
+        }
+    }
+}
+
+int
+main(void)
+{
+    NOC_TestSuite *suite = NOC_TestSuiteMake("Str");
+
+    NOC_TestSuiteAddCase(suite, "Str8zLength", test_str8z_length);
+    NOC_TestSuiteAddCase(suite, "Str16zLength", test_str16z_length);
+    NOC_TestSuiteAddCase(suite, "Str32zLength", test_str32z_length);
+    NOC_TestSuiteAddCase(suite, "MemoryIsEquals", test_memory_is_equals);
+    NOC_TestSuiteAddCase(suite, "Str8zIsEquals", test_str8z_is_equals);
+    NOC_TestSuiteAddCase(suite, "Str16IsEqualsStr8", test_str16_is_equals_str8);
+    NOC_TestSuiteAddCase(suite, "Str32IsEqualsStr8", test_str32_is_equals_str8);
+
+    int exit_code = NOC_TestSuiteExecute(suite);
+    NOC_TestSuiteDestroy(suite);
+
+    return exit_code;
+}